@@ -0,0 +1,133 @@
+/*
+    Copyright (c) 2002-2026 Tampere University.
+
+    This file is part of TTA-Based Codesign Environment (TCE).
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+ */
+/**
+ * Host call I/O library.
+ *
+ * Implements the file access system calls of Newlib and bulk memory
+ * operations with the host call operations. Each call waits until
+ * HOST_BUSY reports that the call is done, so that the cycle cost model
+ * of the simulator shows in the cycle counts.
+ */
+#include <hostio.h>
+#include <errno.h>
+#include <fcntl.h>
+#include "tceops.h"
+
+#undef errno
+extern int errno;
+
+/* The open flags of HOST_OPEN. */
+#define HOSTIO_READ      0x01
+#define HOSTIO_WRITE     0x02
+#define HOSTIO_APPEND    0x04
+#define HOSTIO_CREATE    0x08
+#define HOSTIO_TRUNCATE  0x10
+#define HOSTIO_EXCLUSIVE 0x20
+
+static void
+hostio_wait(void) {
+    unsigned int busy;
+    do {
+        _TCE_HOST_BUSY(0, busy);
+    } while (busy);
+}
+
+int
+_open(const char* file, int flags, int mode) {
+    int hostFlags = 0;
+    int fd;
+    (void)mode;
+
+    switch (flags & O_ACCMODE) {
+    case O_RDONLY: hostFlags = HOSTIO_READ; break;
+    case O_WRONLY: hostFlags = HOSTIO_WRITE; break;
+    default: hostFlags = HOSTIO_READ | HOSTIO_WRITE; break;
+    }
+    if (flags & O_APPEND)
+        hostFlags |= HOSTIO_APPEND;
+    if (flags & O_CREAT)
+        hostFlags |= HOSTIO_CREATE;
+    if (flags & O_TRUNC)
+        hostFlags |= HOSTIO_TRUNCATE;
+    if (flags & O_EXCL)
+        hostFlags |= HOSTIO_EXCLUSIVE;
+
+    _TCE_HOST_OPEN((unsigned int)file, hostFlags, fd);
+    hostio_wait();
+    if (fd < 0)
+        errno = ENOENT;
+    return fd;
+}
+
+int
+_close(int file) {
+    int result;
+    _TCE_HOST_CLOSE(file, result);
+    hostio_wait();
+    if (result < 0)
+        errno = EBADF;
+    return result;
+}
+
+int
+_read(int file, char* ptr, int len) {
+    int result;
+    _TCE_HOST_READ(file, (unsigned int)ptr, len, result);
+    hostio_wait();
+    if (result < 0)
+        errno = EIO;
+    return result;
+}
+
+int
+_write(int file, char* ptr, int len) {
+    int result;
+    _TCE_HOST_WRITE(file, (unsigned int)ptr, len, result);
+    hostio_wait();
+    if (result < 0)
+        errno = EIO;
+    return result;
+}
+
+int
+_lseek(int file, int ptr, int dir) {
+    int result;
+    _TCE_HOST_LSEEK(file, ptr, dir, result);
+    hostio_wait();
+    if (result < 0)
+        errno = EINVAL;
+    return result;
+}
+
+void
+hostio_memcpy(void* dst, const void* src, size_t n) {
+    _TCE_HOST_MEMCPY((unsigned int)dst, (unsigned int)src, n);
+    hostio_wait();
+}
+
+void
+hostio_memset(void* dst, int c, size_t n) {
+    _TCE_HOST_MEMSET((unsigned int)dst, c, n);
+    hostio_wait();
+}
@@ -0,0 +1,52 @@
+/*
+    Copyright (c) 2002-2026 Tampere University.
+
+    This file is part of TTA-Based Codesign Environment (TCE).
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+ */
+/**
+ * Host call I/O library.
+ *
+ * Performs file input/output and bulk memory operations with the host
+ * call operations (HOST_READ, HOST_WRITE, etc.) of the host_io OSAL
+ * module, which the simulator executes natively in a single operation.
+ * The target machine must have a function unit with the host call
+ * operations.
+ *
+ * Linking the library with -lhostio replaces the file access stubs of
+ * Newlib, so that the stdio functions read and write files in the
+ * directory given to the simulator in TTASIM_HOSTIO_DIR.
+ */
+#ifndef _HOSTIO_H
+#define _HOSTIO_H
+
+#include <stddef.h>
+
+/**
+ * Copies n bytes from src to dst. The blocks must not overlap.
+ */
+void hostio_memcpy(void* dst, const void* src, size_t n);
+
+/**
+ * Fills n bytes at dst with the byte c.
+ */
+void hostio_memset(void* dst, int c, size_t n);
+
+#endif
@@ -298,13 +298,12 @@ private:
      */
     void 
     updateDictionary(const Program& program) {        
-        Instruction* instruction = &program.firstInstruction();
-        while (instruction != &NullInstruction::instance()) {
-            InstructionBitVector* instructionBits = bemInstructionBits(
-                *instruction);
-            addToDictionary(*instructionBits);
-            instruction = &program.nextInstruction(*instruction);
-        }   
+        InstructionBitsList instructionBits =
+            bemInstructionBits(programInstructions(program));
+        for (std::size_t i = 0; i < instructionBits.size(); i++) {
+            addToDictionary(*instructionBits[i]);
+            delete instructionBits[i];
+        }
     }
 
 
@@ -313,19 +312,19 @@ private:
      */
     void 
     addInstructions() {
-        Instruction* instruction = &currentProgram().firstInstruction();
-        while (instruction != &NullInstruction::instance()) {
-            InstructionBitVector* bemBits = bemInstructionBits(*instruction);
+        InstructionList instructions =
+            programInstructions(currentProgram());
+        InstructionBitsList bemBits = bemInstructionBits(instructions);
+        for (std::size_t i = 0; i < instructions.size(); i++) {
             unsigned int code = MapTools::valueForKey<unsigned int>(
-                dictionary_, *bemBits);
+                dictionary_, *bemBits[i]);
+            delete bemBits[i];
             InstructionBitVector* compressedInstruction = 
                 new InstructionBitVector();
             static_cast<BitVector*>(compressedInstruction)->pushBack(
                 code, static_cast<int>(
                     MathTools::requiredBits(dictionary_.size() - 1)));
-            addInstruction(*instruction, compressedInstruction);
-            instruction = &currentProgram().nextInstruction(*instruction);  
-            
+            addInstruction(*instructions[i], compressedInstruction);
         }
     }
 
@@ -180,10 +180,10 @@ private:
      */
     void 
     updateDictionary(const Program& program) {
-        Instruction* instruction = &program.firstInstruction();
-        while (instruction != &NullInstruction::instance()) {
-            InstructionBitVector* instructionBits = bemInstructionBits(
-                *instruction);
+        InstructionBitsList programBits =
+            bemInstructionBits(programInstructions(program));
+        for (std::size_t n = 0; n < programBits.size(); n++) {
+            InstructionBitVector* instructionBits = programBits[n];
             unsigned int begin = firstMoveSlotIndex();
             unsigned int end = begin;
             for (int i = 0; i < moveSlotCount(); i++) {
@@ -192,7 +192,6 @@ private:
                 addToDictionary(moveSlot, i);
                 begin = end + 1;
             }
-            instruction = &program.nextInstruction(*instruction);
             delete instructionBits;
         }   
     }
@@ -218,9 +217,11 @@ private:
      */
     void 
     addInstructions() {
-        Instruction* instruction = &currentProgram().firstInstruction();
-        while (instruction != &NullInstruction::instance()) {
-            InstructionBitVector* bemBits = bemInstructionBits(*instruction);
+        InstructionList instructions =
+            programInstructions(currentProgram());
+        InstructionBitsList programBits = bemInstructionBits(instructions);
+        for (std::size_t n = 0; n < instructions.size(); n++) {
+            InstructionBitVector* bemBits = programBits[n];
             InstructionBitVector* compressedInstruction = 
                 new InstructionBitVector();
             // Take a BitVector pointer to the compressed instruction because
@@ -248,8 +249,7 @@ private:
 
                 begin = end + 1;
             }
-            addInstruction(*instruction, compressedInstruction);
-            instruction = &currentProgram().nextInstruction(*instruction);
+            addInstruction(*instructions[n], compressedInstruction);
             delete bemBits;
         }
     }
@@ -31,6 +31,8 @@
  * @author Jari Mntyneva 2006 (jari.mantyneva-no.spam-tut.fi)
  * @note rating: red
  */
+#include <algorithm>
+
 #include "FUCostEstimationPlugin.hh"
 #include "Application.hh"
 #include "DataObject.hh"
@@ -394,6 +396,74 @@ public:
             
         return true;
     }
+
+    /**
+     * Estimates the energy of executing the given operation once.
+     *
+     * Selects the energy from the matching cost database entries like
+     * estimateEnergy() does.
+     */
+    virtual bool estimateOperationEnergy(
+        const TTAMachine::FunctionUnit& fu,
+        const IDF::FUImplementationLocation&,
+        const std::string& operation,
+        EnergyInMilliJoules& energy,
+        HDB::HDBManager& hdb) {
+
+        try {
+            initializeEstimator(hdb);
+            CostDBTypes::EntryTable results = createSearch(fu);
+            energy = 0.0;
+            CostDBTypes::EntryTable::const_iterator i = results.begin();
+            for (;i < results.end(); i++) {
+                EnergyInMilliJoules tempEnergy = 0.0;
+                for (int n = 0; n < (*i)->statisticsCount(); n++) {
+                    if ((*i)->statistics(n).energyOperation(operation) >
+                        tempEnergy) {
+                        tempEnergy +=
+                            (*i)->statistics(n).energyOperation(operation);
+                    }
+                }
+                energy += tempEnergy;
+            }
+        } catch (const Exception& e) {
+            debugLog(e.errorMessage());
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * Estimates the energy of one idle cycle of the FU.
+     *
+     * Selects the energy from the matching cost database entries like
+     * estimateEnergy() does.
+     */
+    virtual bool estimateIdleEnergy(
+        const TTAMachine::FunctionUnit& fu,
+        const IDF::FUImplementationLocation&,
+        EnergyInMilliJoules& energy,
+        HDB::HDBManager& hdb) {
+
+        try {
+            initializeEstimator(hdb);
+            CostDBTypes::EntryTable results = createSearch(fu);
+            energy = 0.0;
+            CostDBTypes::EntryTable::const_iterator i = results.begin();
+            for (;i < results.end(); i++) {
+                EnergyInMilliJoules tempEnergy = 0.0;
+                for (int n = 0; n < (*i)->statisticsCount(); n++) {
+                    tempEnergy = std::max(
+                        tempEnergy, (*i)->statistics(n).energyIdle());
+                }
+                energy += tempEnergy;
+            }
+        } catch (const Exception& e) {
+            debugLog(e.errorMessage());
+            return false;
+        }
+        return true;
+    }
 private:
     /// Registry of cost databases.
     CostDatabaseRegistry* costDatabaseRegistry_;
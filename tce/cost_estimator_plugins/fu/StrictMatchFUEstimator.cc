@@ -309,6 +309,50 @@ public:
         return true;
     }
 
+    /**
+     * Estimates the energy of executing the given operation once.
+     *
+     * Fetches the 'operation_execution_energy operation_name' entry used
+     * by estimateEnergy().
+     */
+    virtual bool estimateOperationEnergy(
+        const TTAMachine::FunctionUnit&,
+        const IDF::FUImplementationLocation& implementation,
+        const std::string& operation,
+        EnergyInMilliJoules& energy,
+        HDB::HDBManager& hdb) {
+
+        try {
+            energy = hdb.fuCostEstimationData(
+                std::string("operation_execution_energy ") + operation,
+                implementation.id(), name_).doubleValue();
+        } catch (const Exception& e) {
+            debugLog(e.errorMessage());
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * Estimates the energy of one idle cycle of the FU.
+     *
+     * Fetches the 'fu_idle_energy' entry used by estimateEnergy().
+     */
+    virtual bool estimateIdleEnergy(
+        const TTAMachine::FunctionUnit&,
+        const IDF::FUImplementationLocation& implementation,
+        EnergyInMilliJoules& energy,
+        HDB::HDBManager& hdb) {
+
+        try {
+            energy = hdb.fuCostEstimationData(
+                "fu_idle_energy", implementation.id(), name_).doubleValue();
+        } catch (const Exception& e) {
+            debugLog(e.errorMessage());
+            return false;
+        }
+        return true;
+    }
 };
 
 EXPORT_FU_COST_ESTIMATOR_PLUGIN(StrictMatchFUEstimator)
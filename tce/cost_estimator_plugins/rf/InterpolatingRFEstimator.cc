@@ -31,6 +31,8 @@
  * @author Jari Mntyneva 2006 (jari.mantyneva-no.spam-tut.fi)
  * @note rating: red
  */
+#include <algorithm>
+
 #include "RFCostEstimationPlugin.hh"
 #include "Application.hh"
 #include "DataObject.hh"
@@ -400,6 +402,74 @@ public:
         return true;
     }
 
+    /**
+     * Estimates the energy of a cycle with the given count of concurrent
+     * reads and writes.
+     *
+     * Selects the energy from the matching cost database entries like
+     * estimateEnergy() does.
+     */
+    bool estimateAccessEnergy(
+        const TTAMachine::BaseRegisterFile& rf,
+        const IDF::RFImplementationLocation&,
+        std::size_t reads,
+        std::size_t writes,
+        EnergyInMilliJoules& energy,
+        HDB::HDBManager& hdb) {
+
+        try {
+            initializeEstimator(hdb);
+            CostDBTypes::EntryTable results = createSearch(rf);
+            energy = 0.0;
+            CostDBTypes::EntryTable::const_iterator i = results.begin();
+            for (;i < results.end(); i++) {
+                EnergyInMilliJoules energyTemp = 0.0;
+                for (int n = 0; n < (*i)->statisticsCount(); n++) {
+                    energyTemp = std::max(
+                        energyTemp,
+                        (*i)->statistics(n).energyReadWrite(reads, writes));
+                }
+                energy += energyTemp;
+            }
+        } catch (const Exception& e) {
+            debugLog(e.errorMessage());
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * Estimates the energy of one idle cycle of the RF.
+     *
+     * Selects the energy from the matching cost database entries like
+     * estimateEnergy() does.
+     */
+    bool estimateIdleEnergy(
+        const TTAMachine::BaseRegisterFile& rf,
+        const IDF::RFImplementationLocation&,
+        EnergyInMilliJoules& energy,
+        HDB::HDBManager& hdb) {
+
+        try {
+            initializeEstimator(hdb);
+            CostDBTypes::EntryTable results = createSearch(rf);
+            energy = 0.0;
+            CostDBTypes::EntryTable::const_iterator i = results.begin();
+            for (;i < results.end(); i++) {
+                EnergyInMilliJoules energyTemp = 0.0;
+                for (int n = 0; n < (*i)->statisticsCount(); n++) {
+                    energyTemp = std::max(
+                        energyTemp, (*i)->statistics(n).energyIdle());
+                }
+                energy += energyTemp;
+            }
+        } catch (const Exception& e) {
+            debugLog(e.errorMessage());
+            return false;
+        }
+        return true;
+    }
+
 private:
     /// Registry of cost databases.
     CostDatabaseRegistry* costDatabaseRegistry_;
@@ -328,7 +328,53 @@ public:
         return true;
     }
 
+    /**
+     * Estimates the energy of a cycle with the given count of concurrent
+     * reads and writes.
+     *
+     * Fetches the 'rf_access_energy Nr Nw' entry used by estimateEnergy().
+     */
+    bool estimateAccessEnergy(
+        const TTAMachine::BaseRegisterFile&,
+        const IDF::RFImplementationLocation& implementation,
+        std::size_t reads,
+        std::size_t writes,
+        EnergyInMilliJoules& energy,
+        HDB::HDBManager& hdb) {
+
+        try {
+            energy = hdb.rfCostEstimationData(
+                std::string("rf_access_energy ") +
+                Conversion::toString(reads) + " " +
+                Conversion::toString(writes),
+                implementation.id(), name_).doubleValue();
+        } catch (const Exception& e) {
+            debugLog(e.errorMessage());
+            return false;
+        }
+        return true;
+    }
 
+    /**
+     * Estimates the energy of one idle cycle of the RF.
+     *
+     * Fetches the 'rf_idle_energy' entry used by estimateEnergy().
+     */
+    bool estimateIdleEnergy(
+        const TTAMachine::BaseRegisterFile&,
+        const IDF::RFImplementationLocation& implementation,
+        EnergyInMilliJoules& energy,
+        HDB::HDBManager& hdb) {
+
+        try {
+            energy = hdb.rfCostEstimationData(
+                "rf_idle_energy", implementation.id(), name_).doubleValue();
+        } catch (const Exception& e) {
+            debugLog(e.errorMessage());
+            return false;
+        }
+        return true;
+    }
 };
 
 EXPORT_RF_COST_ESTIMATOR_PLUGIN(StrictMatchRFEstimator)
@@ -573,12 +573,15 @@ DefaultDecoderGenerator::verifyCompatibility() const {
         }
     }
 
-    // check that there are 3 delay slots in the transport pipeline
-    if (gcu->delaySlots() != 3) {
+    // check that there are 3 delay slots in the transport pipeline, or 4
+    // if the instruction fetch is pipelined
+    if (gcu->delaySlots() != 3 &&
+        !NetlistGenerator::hasPipelinedFetch(machine_)) {
         throw InvalidData(
             __FILE__, __LINE__, __func__,
             TCEString("Decoder generator supports only 4-stage transport ")+
-            "pipeline of GCU. Given machine has " + 
+            "pipeline of GCU, or 5-stage with pipelined instruction fetch. "
+            "Given machine has " + 
             Conversion::toString(gcu->delaySlots()+1) + " stages");
     }
 
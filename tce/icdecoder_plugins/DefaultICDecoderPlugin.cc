@@ -183,6 +183,62 @@ public:
 
         return false;
     }
+
+    /**
+     * Estimates the delay of a socket.
+     *
+     * The delay of a path estimated by estimateICDelayOfPath() is the sum
+     * of the delays of its sockets and bus, so the estimator can combine
+     * them to find the longest path.
+     *
+     * @param socket The socket of which delay is estimated.
+     * @param machineImplementation Implementation of the machine.
+     * @param socketImplementation Not used.
+     * @param delay Result delay of the socket.
+     * @return True if the estimation succeeded.
+     */
+    virtual bool estimateICDelayOfSocket(
+        HDB::HDBRegistry& hdbRegistry,
+        const TTAMachine::Socket& socket,
+        const IDF::MachineImplementation& machineImplementation,
+        const IDF::SocketImplementationLocation&,
+        DelayInNanoSeconds& delay) {
+        try {
+            HDB::HDBManager& hdb =
+                hdbRegistry.hdb(machineImplementation.icDecoderHDB());
+            delay = delayOfSocket(hdb, socket);
+            return true;
+        } catch (const Exception& e) {
+            debugLog(e.errorMessage());
+            return false;
+        }
+    }
+
+    /**
+     * Estimates the delay of a bus.
+     *
+     * @param bus The bus of which delay is estimated.
+     * @param machineImplementation Implementation of the machine.
+     * @param busImplementation Not used.
+     * @param delay Result delay of the bus.
+     * @return True if the estimation succeeded.
+     */
+    virtual bool estimateICDelayOfBus(
+        HDB::HDBRegistry& hdbRegistry,
+        const TTAMachine::Bus& bus,
+        const IDF::MachineImplementation& machineImplementation,
+        const IDF::BusImplementationLocation&,
+        DelayInNanoSeconds& delay) {
+        try {
+            HDB::HDBManager& hdb =
+                hdbRegistry.hdb(machineImplementation.icDecoderHDB());
+            delay = delayOfBus(hdb, bus);
+            return true;
+        } catch (const Exception& e) {
+            debugLog(e.errorMessage());
+            return false;
+        }
+    }
       
     /**
      * Estimates the area of an IC path.
@@ -1103,6 +1159,12 @@ public:
                     "Language not set to VHDL when HW debugger is in use.";
                 throw Exception(__FILE__, __LINE__, __func__, errorMsg);
             }
+            if (NetlistGenerator::hasPipelinedFetch(ttamachine_)) {
+                std::string errorMsg =
+                    "HW debugger does not support pipelined instruction "
+                    "fetch.";
+                throw Exception(__FILE__, __LINE__, __func__, errorMsg);
+            }
             copier.instantiateHDLTemplate(
                 templateDir + DS + "debugfetch.vhdl.tmpl",
                 dstDirectory, "ifetch.vhdl");
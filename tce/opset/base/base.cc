@@ -1650,6 +1650,114 @@ END_TRIGGER;
 END_OPERATION(LEDS)
 
 
+//////////////////////////////////////////////////////////////////////////////
+// LDW2 - load 2 consecutive words from memory
+//////////////////////////////////////////////////////////////////////////////
+OPERATION(LDW2)
+
+TRIGGER
+    UIntWord address = UINT(1);
+    if (address % 4 != 0)
+        RUNTIME_ERROR_WITH_INT(
+            "Memory access alignment error, address: ", address);
+    for (int i = 0; i < 2; ++i) {
+        UIntWord data;
+        MEMORY.readBE(address + 4 * i, 4, data);
+        IO(2 + i) = data;
+    }
+END_TRIGGER;
+
+END_OPERATION(LDW2)
+
+//////////////////////////////////////////////////////////////////////////////
+// STW2 - store 2 consecutive words to memory
+//////////////////////////////////////////////////////////////////////////////
+OPERATION(STW2)
+
+TRIGGER
+    UIntWord address = UINT(1);
+    if (address % 4 != 0)
+        RUNTIME_ERROR_WITH_INT(
+            "Memory access alignment error, address: ", address);
+    for (int i = 0; i < 2; ++i) {
+        MEMORY.writeBE(address + 4 * i, 4, UINT(2 + i));
+    }
+END_TRIGGER;
+
+END_OPERATION(STW2)
+
+//////////////////////////////////////////////////////////////////////////////
+// LDW4 - load 4 consecutive words from memory
+//////////////////////////////////////////////////////////////////////////////
+OPERATION(LDW4)
+
+TRIGGER
+    UIntWord address = UINT(1);
+    if (address % 4 != 0)
+        RUNTIME_ERROR_WITH_INT(
+            "Memory access alignment error, address: ", address);
+    for (int i = 0; i < 4; ++i) {
+        UIntWord data;
+        MEMORY.readBE(address + 4 * i, 4, data);
+        IO(2 + i) = data;
+    }
+END_TRIGGER;
+
+END_OPERATION(LDW4)
+
+//////////////////////////////////////////////////////////////////////////////
+// STW4 - store 4 consecutive words to memory
+//////////////////////////////////////////////////////////////////////////////
+OPERATION(STW4)
+
+TRIGGER
+    UIntWord address = UINT(1);
+    if (address % 4 != 0)
+        RUNTIME_ERROR_WITH_INT(
+            "Memory access alignment error, address: ", address);
+    for (int i = 0; i < 4; ++i) {
+        MEMORY.writeBE(address + 4 * i, 4, UINT(2 + i));
+    }
+END_TRIGGER;
+
+END_OPERATION(STW4)
+
+//////////////////////////////////////////////////////////////////////////////
+// LDW8 - load 8 consecutive words from memory
+//////////////////////////////////////////////////////////////////////////////
+OPERATION(LDW8)
+
+TRIGGER
+    UIntWord address = UINT(1);
+    if (address % 4 != 0)
+        RUNTIME_ERROR_WITH_INT(
+            "Memory access alignment error, address: ", address);
+    for (int i = 0; i < 8; ++i) {
+        UIntWord data;
+        MEMORY.readBE(address + 4 * i, 4, data);
+        IO(2 + i) = data;
+    }
+END_TRIGGER;
+
+END_OPERATION(LDW8)
+
+//////////////////////////////////////////////////////////////////////////////
+// STW8 - store 8 consecutive words to memory
+//////////////////////////////////////////////////////////////////////////////
+OPERATION(STW8)
+
+TRIGGER
+    UIntWord address = UINT(1);
+    if (address % 4 != 0)
+        RUNTIME_ERROR_WITH_INT(
+            "Memory access alignment error, address: ", address);
+    for (int i = 0; i < 8; ++i) {
+        MEMORY.writeBE(address + 4 * i, 4, UINT(2 + i));
+    }
+END_TRIGGER;
+
+END_OPERATION(STW8)
+
 //////////////////////////////////////////////////////////////////////////////
 // BCAST2 - broadcast to two vector lanes
 //////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,524 @@
+/*
+    Copyright (c) 2002-2026 Tampere University.
+
+    This file is part of TTA-Based Codesign Environment (TCE).
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+ */
+/**
+ * @file host_io.cc
+ *
+ * Behavior definitions of the host call operations.
+ *
+ * The host call operations perform file input/output and bulk memory
+ * operations of the simulated program natively in the simulator, instead
+ * of executing them as simulated code a MAU at a time. The operations
+ * work on memories with 8-bit MAUs only.
+ *
+ * Files can be opened only inside the directory given in the environment
+ * variable TTASIM_HOSTIO_DIR. Symbolic links inside the directory are not
+ * followed. File descriptors 0, 1 and 2 are the standard input of the
+ * simulator and its console output.
+ *
+ * The operations complete in a single trigger. Their cycle cost is
+ * modeled with HOST_BUSY, which reports whether the latest host call is
+ * still in progress. The cost is TTASIM_HOSTIO_CALL_CYCLES cycles per call
+ * plus TTASIM_HOSTIO_MAU_CYCLES cycles per transferred MAU, both zero by
+ * default.
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "OSAL.hh"
+#include "OperationGlobals.hh"
+#include "Memory.hh"
+#include "Conversion.hh"
+#include "Exception.hh"
+
+/// Number of MAUs transferred between the memory and the host at a time.
+const std::size_t HOST_IO_BLOCK_SIZE = 1 << 16;
+
+/// The flags of HOST_OPEN.
+const int HOST_OPEN_READ = 0x01;
+const int HOST_OPEN_WRITE = 0x02;
+const int HOST_OPEN_APPEND = 0x04;
+const int HOST_OPEN_CREATE = 0x08;
+const int HOST_OPEN_TRUNCATE = 0x10;
+const int HOST_OPEN_EXCLUSIVE = 0x20;
+
+/**
+ * Returns true if the path names stay inside the directory they are
+ * relative to.
+ *
+ * Absolute paths and references to parent directories are rejected. The
+ * check is textual, symbolic links are handled by openSandboxed().
+ */
+static bool
+isSandboxedPath(const std::string& path) {
+    if (path.empty() || path[0] == '/') {
+        return false;
+    }
+    std::size_t start = 0;
+    while (start <= path.size()) {
+        std::size_t end = path.find('/', start);
+        if (end == std::string::npos) {
+            end = path.size();
+        }
+        if (path.substr(start, end - start) == "..") {
+            return false;
+        }
+        start = end + 1;
+    }
+    return true;
+}
+
+/**
+ * Opens a file inside the given directory.
+ *
+ * The directories on the path are opened one at a time relative to the
+ * previous one and no symbolic link is followed, so the opened file is
+ * always inside the directory even if the directory contains links that
+ * point out of it.
+ *
+ * @param directory The directory the path is relative to.
+ * @param path The path of the file.
+ * @param flags The open flags of the host.
+ * @return The host file descriptor, or -1 on an error.
+ */
+static int
+openSandboxed(
+    const std::string& directory, const std::string& path, int flags) {
+    if (!isSandboxedPath(path)) {
+        return -1;
+    }
+    int parent = ::open(directory.c_str(), O_RDONLY | O_DIRECTORY);
+    if (parent < 0) {
+        return -1;
+    }
+    std::size_t start = 0;
+    std::size_t end = path.find('/');
+    while (end != std::string::npos) {
+        const std::string name = path.substr(start, end - start);
+        if (name != "" && name != ".") {
+            const int child = ::openat(
+                parent, name.c_str(), O_RDONLY | O_DIRECTORY | O_NOFOLLOW);
+            ::close(parent);
+            if (child < 0) {
+                return -1;
+            }
+            parent = child;
+        }
+        start = end + 1;
+        end = path.find('/', start);
+    }
+    const std::string name = path.substr(start);
+    int file = -1;
+    if (name != "" && name != ".") {
+        file = ::openat(parent, name.c_str(), flags | O_NOFOLLOW, 0644);
+    }
+    ::close(parent);
+    return file;
+}
+
+/**
+ * Reads a null terminated string from the memory.
+ *
+ * @exception OutOfRange If the string is not inside the memory.
+ */
+static std::string
+readString(Memory& memory, Word address) {
+    std::string result;
+    for (;;) {
+        UIntWord character;
+        memory.read(address + result.size(), 1, character);
+        if (character == 0) {
+            return result;
+        }
+        result += static_cast<char>(character);
+    }
+}
+
+/**
+ * Converts the flags of HOST_OPEN to the flags of the host.
+ */
+static int
+hostOpenFlags(int flags) {
+    int hostFlags = 0;
+    if ((flags & HOST_OPEN_READ) && (flags & HOST_OPEN_WRITE)) {
+        hostFlags = O_RDWR;
+    } else if (flags & HOST_OPEN_WRITE) {
+        hostFlags = O_WRONLY;
+    } else {
+        hostFlags = O_RDONLY;
+    }
+    if (flags & HOST_OPEN_APPEND) {
+        hostFlags |= O_APPEND;
+    }
+    if (flags & HOST_OPEN_CREATE) {
+        hostFlags |= O_CREAT;
+    }
+    if (flags & HOST_OPEN_TRUNCATE) {
+        hostFlags |= O_TRUNC;
+    }
+    if (flags & HOST_OPEN_EXCLUSIVE) {
+        hostFlags |= O_EXCL;
+    }
+    return hostFlags;
+}
+
+/**
+ * Writes MAUs of the memory to a host file or to the simulator console.
+ *
+ * @param hostFile The host file descriptor, or -1 for the console.
+ * @return The number of written MAUs, or -1 on an error.
+ * @exception OutOfRange If the data is not inside the memory.
+ */
+static int
+writeToHost(Memory& memory, Word address, int length, int hostFile) {
+    std::vector<Memory::MAU> maus(HOST_IO_BLOCK_SIZE);
+    std::vector<char> buffer(HOST_IO_BLOCK_SIZE);
+    int written = 0;
+    while (written < length) {
+        const int count = std::min(
+            static_cast<std::size_t>(length - written), HOST_IO_BLOCK_SIZE);
+        memory.readBlock(address + written, &maus[0], count);
+        std::copy(maus.begin(), maus.begin() + count, buffer.begin());
+        if (hostFile < 0) {
+            OUTPUT_STREAM.write(&buffer[0], count);
+        } else if (::write(hostFile, &buffer[0], count) != count) {
+            return -1;
+        }
+        written += count;
+    }
+    if (hostFile < 0) {
+        OUTPUT_STREAM << std::flush;
+    }
+    return written;
+}
+
+/**
+ * Reads MAUs to the memory from a host file or from the standard input.
+ *
+ * @param hostFile The host file descriptor, or -1 for the standard input.
+ * @return The number of read MAUs, or -1 on an error.
+ * @exception OutOfRange If the data does not fit in the memory.
+ */
+static int
+readFromHost(Memory& memory, Word address, int length, int hostFile) {
+    std::vector<Memory::MAU> maus(HOST_IO_BLOCK_SIZE);
+    std::vector<char> buffer(HOST_IO_BLOCK_SIZE);
+    int read = 0;
+    while (read < length) {
+        const int requested = std::min(
+            static_cast<std::size_t>(length - read), HOST_IO_BLOCK_SIZE);
+        int count = 0;
+        if (hostFile < 0) {
+            std::cin.read(&buffer[0], requested);
+            count = std::cin.gcount();
+        } else {
+            count = ::read(hostFile, &buffer[0], requested);
+            if (count < 0) {
+                return -1;
+            }
+        }
+        for (int i = 0; i < count; ++i) {
+            maus[i] = static_cast<unsigned char>(buffer[i]);
+        }
+        memory.writeBlock(address + read, &maus[0], count);
+        read += count;
+        if (count < requested) {
+            break;
+        }
+    }
+    return read;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// HOST_IO - State definition for the host call operations.
+//
+// Keeps the files opened by the simulated program and the completion cycle
+// of the latest host call.
+//////////////////////////////////////////////////////////////////////////////
+
+DEFINE_STATE(HOST_IO)
+    /// The directory the files are opened in, empty if file access is
+    /// disabled.
+    std::string directory;
+    /// The host file descriptors indexed by the simulated ones.
+    std::map<int, int> files;
+    /// The next simulated file descriptor.
+    int nextFile;
+    /// The cost of a host call in cycles.
+    double callCycles;
+    /// The cost of transferring a MAU in cycles.
+    double mauCycles;
+    /// The cycle in which the latest host call completes.
+    CycleCount readyCycle;
+
+INIT_STATE(HOST_IO)
+    const char* directoryFromEnv = getenv("TTASIM_HOSTIO_DIR");
+    directory = directoryFromEnv == NULL ? "" : directoryFromEnv;
+    nextFile = 3;
+
+    callCycles = 0.0;
+    const char* callCyclesFromEnv = getenv("TTASIM_HOSTIO_CALL_CYCLES");
+    if (callCyclesFromEnv != NULL) {
+        callCycles = Conversion::toDouble(callCyclesFromEnv);
+    }
+    mauCycles = 0.0;
+    const char* mauCyclesFromEnv = getenv("TTASIM_HOSTIO_MAU_CYCLES");
+    if (mauCyclesFromEnv != NULL) {
+        mauCycles = Conversion::toDouble(mauCyclesFromEnv);
+    }
+    readyCycle = 0;
+END_INIT_STATE;
+
+FINALIZE_STATE(HOST_IO)
+    for (std::map<int, int>::iterator i = files.begin(); i != files.end();
+         ++i) {
+        ::close(i->second);
+    }
+END_FINALIZE_STATE;
+
+    /**
+     * Starts the modeled execution of a host call.
+     *
+     * @param cycle The cycle in which the call is triggered.
+     * @param maus The number of MAUs the call transfers.
+     */
+    void startCall(CycleCount cycle, int maus) {
+        readyCycle = cycle + static_cast<CycleCount>(
+            callCycles + mauCycles * std::max(maus, 0));
+    }
+
+    /**
+     * Returns the host file descriptor of a simulated one.
+     *
+     * @return The host file descriptor, -1 for the console or the standard
+     *         input, or -2 if the descriptor is not open.
+     */
+    int hostFile(int file) {
+        if (file >= 0 && file <= 2) {
+            return -1;
+        }
+        std::map<int, int>::const_iterator i = files.find(file);
+        return i == files.end() ? -2 : i->second;
+    }
+
+END_DEFINE_STATE
+
+//////////////////////////////////////////////////////////////////////////////
+// HOST_OPEN - Opens a file in the host directory.
+//////////////////////////////////////////////////////////////////////////////
+
+OPERATION_WITH_STATE(HOST_OPEN, HOST_IO)
+
+TRIGGER
+    IO(3) = -1;
+    STATE.startCall(CYCLE_COUNT, 0);
+    std::string path;
+    try {
+        path = readString(MEMORY, UINT(1));
+    } catch (const OutOfRange&) {
+        RUNTIME_ERROR("File name is out of the address space.");
+    }
+    if (STATE.directory == "") {
+        return true;
+    }
+    const int hostFile =
+        openSandboxed(STATE.directory, path, hostOpenFlags(INT(2)));
+    if (hostFile < 0) {
+        return true;
+    }
+    STATE.files[STATE.nextFile] = hostFile;
+    IO(3) = STATE.nextFile++;
+END_TRIGGER;
+
+END_OPERATION_WITH_STATE(HOST_OPEN)
+
+//////////////////////////////////////////////////////////////////////////////
+// HOST_CLOSE - Closes a file opened with HOST_OPEN.
+//////////////////////////////////////////////////////////////////////////////
+
+OPERATION_WITH_STATE(HOST_CLOSE, HOST_IO)
+
+TRIGGER
+    STATE.startCall(CYCLE_COUNT, 0);
+    const int hostFile = STATE.hostFile(INT(1));
+    if (hostFile == -1) {
+        IO(2) = 0;
+    } else if (hostFile == -2) {
+        IO(2) = -1;
+    } else {
+        STATE.files.erase(INT(1));
+        IO(2) = ::close(hostFile) == 0 ? 0 : -1;
+    }
+END_TRIGGER;
+
+END_OPERATION_WITH_STATE(HOST_CLOSE)
+
+//////////////////////////////////////////////////////////////////////////////
+// HOST_READ - Reads a block of data from a file to the memory.
+//////////////////////////////////////////////////////////////////////////////
+
+OPERATION_WITH_STATE(HOST_READ, HOST_IO)
+
+TRIGGER
+    if (MAU_SIZE != 8) {
+        RUNTIME_ERROR("Host calls support only 8-bit MAUs.");
+    }
+    const int hostFile = STATE.hostFile(INT(1));
+    int result = -1;
+    if (hostFile != -2) {
+        try {
+            result = readFromHost(MEMORY, UINT(2), INT(3), hostFile);
+        } catch (const OutOfRange&) {
+            RUNTIME_ERROR("Read buffer is out of the address space.");
+        }
+    }
+    STATE.startCall(CYCLE_COUNT, result);
+    IO(4) = result;
+END_TRIGGER;
+
+END_OPERATION_WITH_STATE(HOST_READ)
+
+//////////////////////////////////////////////////////////////////////////////
+// HOST_WRITE - Writes a block of data from the memory to a file.
+//////////////////////////////////////////////////////////////////////////////
+
+OPERATION_WITH_STATE(HOST_WRITE, HOST_IO)
+
+TRIGGER
+    if (MAU_SIZE != 8) {
+        RUNTIME_ERROR("Host calls support only 8-bit MAUs.");
+    }
+    const int hostFile = STATE.hostFile(INT(1));
+    int result = -1;
+    if (hostFile != -2) {
+        try {
+            result = writeToHost(MEMORY, UINT(2), INT(3), hostFile);
+        } catch (const OutOfRange&) {
+            RUNTIME_ERROR("Write buffer is out of the address space.");
+        }
+    }
+    STATE.startCall(CYCLE_COUNT, result);
+    IO(4) = result;
+END_TRIGGER;
+
+END_OPERATION_WITH_STATE(HOST_WRITE)
+
+//////////////////////////////////////////////////////////////////////////////
+// HOST_LSEEK - Sets the position of a file opened with HOST_OPEN.
+//////////////////////////////////////////////////////////////////////////////
+
+OPERATION_WITH_STATE(HOST_LSEEK, HOST_IO)
+
+TRIGGER
+    STATE.startCall(CYCLE_COUNT, 0);
+    const int hostFile = STATE.hostFile(INT(1));
+    if (hostFile < 0) {
+        IO(4) = -1;
+        return true;
+    }
+    int whence = SEEK_SET;
+    if (INT(3) == 1) {
+        whence = SEEK_CUR;
+    } else if (INT(3) == 2) {
+        whence = SEEK_END;
+    }
+    const off_t position = ::lseek(hostFile, INT(2), whence);
+    IO(4) = position < 0 ? -1 : static_cast<int>(position);
+END_TRIGGER;
+
+END_OPERATION_WITH_STATE(HOST_LSEEK)
+
+//////////////////////////////////////////////////////////////////////////////
+// HOST_MEMCPY - Copies a block of memory.
+//////////////////////////////////////////////////////////////////////////////
+
+OPERATION_WITH_STATE(HOST_MEMCPY, HOST_IO)
+
+TRIGGER
+    const Word destination = UINT(1);
+    const Word source = UINT(2);
+    const int length = INT(3);
+    std::vector<Memory::MAU> maus(
+        std::min(static_cast<std::size_t>(std::max(length, 0)),
+                 HOST_IO_BLOCK_SIZE));
+    try {
+        for (int copied = 0; copied < length; copied += maus.size()) {
+            const int count = std::min(
+                static_cast<std::size_t>(length - copied), maus.size());
+            MEMORY.readBlock(source + copied, &maus[0], count);
+            MEMORY.writeBlock(destination + copied, &maus[0], count);
+        }
+    } catch (const OutOfRange&) {
+        RUNTIME_ERROR("Copied block is out of the address space.");
+    }
+    STATE.startCall(CYCLE_COUNT, length);
+END_TRIGGER;
+
+END_OPERATION_WITH_STATE(HOST_MEMCPY)
+
+//////////////////////////////////////////////////////////////////////////////
+// HOST_MEMSET - Fills a block of memory with a MAU value.
+//////////////////////////////////////////////////////////////////////////////
+
+OPERATION_WITH_STATE(HOST_MEMSET, HOST_IO)
+
+TRIGGER
+    const Word destination = UINT(1);
+    const int length = INT(3);
+    const UIntWord mask = MAU_SIZE < 32 ? (1u << MAU_SIZE) - 1 : ~0u;
+    const std::vector<Memory::MAU> maus(
+        std::min(static_cast<std::size_t>(std::max(length, 0)),
+                 HOST_IO_BLOCK_SIZE),
+        UINT(2) & mask);
+    try {
+        for (int filled = 0; filled < length; filled += maus.size()) {
+            const int count = std::min(
+                static_cast<std::size_t>(length - filled), maus.size());
+            MEMORY.writeBlock(destination + filled, &maus[0], count);
+        }
+    } catch (const OutOfRange&) {
+        RUNTIME_ERROR("Filled block is out of the address space.");
+    }
+    STATE.startCall(CYCLE_COUNT, length);
+END_TRIGGER;
+
+END_OPERATION_WITH_STATE(HOST_MEMSET)
+
+//////////////////////////////////////////////////////////////////////////////
+// HOST_BUSY - Tells whether the latest host call is still in progress.
+//////////////////////////////////////////////////////////////////////////////
+
+OPERATION_WITH_STATE(HOST_BUSY, HOST_IO)
+
+TRIGGER
+    IO(2) = CYCLE_COUNT < STATE.readyCycle ? 1 : 0;
+END_TRIGGER;
+
+END_OPERATION_WITH_STATE(HOST_BUSY)
@@ -32,6 +32,10 @@
  */
 
 #include <algorithm>
+#include <map>
+#include <sstream>
+#include <vector>
+#include <boost/scoped_ptr.hpp>
 #include "boost/format.hpp"
 
 #include "Estimator.hh"
@@ -48,10 +52,17 @@
 #include "FUEntry.hh"
 #include "RFEntry.hh"
 #include "Segment.hh"
+#include "Bus.hh"
+#include "Socket.hh"
 #include "FUPort.hh"
 #include "RFPort.hh"
 #include "ControlUnit.hh"
 #include "FullyConnectedCheck.hh"
+#include "ExecutionTrace.hh"
+#include "ObjectState.hh"
+#include "RFArchitecture.hh"
+#include "Conversion.hh"
+#include "StringTools.hh"
 #include "MachineCheckResults.hh"
 
 using namespace HDB;
@@ -351,6 +362,265 @@ Estimator::rfCostFunctionPluginOfImplementation(
     throw 1;
 }
 
+/**
+ * Constructor.
+ */
+Estimator::UnitCosts::UnitCosts() :
+    hasArea(false), area(0.0), hasComputationDelay(false),
+    computationDelay(0.0), hasIdleEnergy(false), idleEnergy(0.0) {
+}
+
+/**
+ * Returns the cached estimates of the given FU implementation.
+ *
+ * The estimates of an implementation depend on the architecture of the
+ * unit, so they are cached separately for each distinct architecture the
+ * implementation is used with. The estimates are created empty on the
+ * first use.
+ *
+ * @param architecture The FU architecture.
+ * @param implementationEntry The implementation information of the FU.
+ * @return The estimates.
+ * @exception Exception If the implementation has no HDB entry.
+ */
+Estimator::UnitCosts&
+Estimator::functionUnitCosts(
+    const TTAMachine::FunctionUnit& architecture,
+    const IDF::FUImplementationLocation& implementationEntry) {
+    return fuCosts_[
+        implementationEntry.hdbFile() + "\n" +
+        Conversion::toString(implementationEntry.id()) + "\n" +
+        architectureKey(architecture)];
+}
+
+/**
+ * Returns the cached estimates of the given RF implementation.
+ *
+ * @see functionUnitCosts()
+ * @param architecture The RF architecture.
+ * @param implementationEntry The implementation information of the RF.
+ * @return The estimates.
+ * @exception Exception If the implementation has no HDB entry.
+ */
+Estimator::UnitCosts&
+Estimator::registerFileCosts(
+    const TTAMachine::BaseRegisterFile& architecture,
+    const IDF::RFImplementationLocation& implementationEntry) {
+    // register guards referring to the RF count in its architecture
+    HDB::RFArchitecture rfArchitecture(&architecture);
+    return rfCosts_[
+        implementationEntry.hdbFile() + "\n" +
+        Conversion::toString(implementationEntry.id()) + "\n" +
+        Conversion::toString(rfArchitecture.hasGuardSupport()) + "\n" +
+        architectureKey(architecture)];
+}
+
+/**
+ * Returns a string that identifies the architecture of the given unit.
+ *
+ * Two units have the same key if they have the same ports, operations and
+ * other properties, even if they are in different machines. The names of
+ * the unit and of the sockets its ports are connected to are not part of
+ * the key, only the directions in which the ports are connected.
+ *
+ * @param unit The unit.
+ * @return The key.
+ */
+std::string
+Estimator::architectureKey(const TTAMachine::Unit& unit) {
+    std::ostringstream key;
+    boost::scoped_ptr<ObjectState> state(unit.saveState());
+    writeStateKey(*state, true, key);
+    for (int i = 0; i < unit.portCount(); ++i) {
+        const TTAMachine::Port& port = *unit.port(i);
+        key << "\n" << port.name() << " "
+            << (port.inputSocket() != NULL) << (port.outputSocket() != NULL);
+    }
+    return key.str();
+}
+
+/**
+ * Writes the given object state tree to a key string.
+ *
+ * @param state The object state.
+ * @param isUnit True if the state is the state of the unit itself.
+ * @param key The stream to write the key to.
+ */
+void
+Estimator::writeStateKey(
+    const ObjectState& state, bool isUnit, std::ostream& key) {
+    key << "<" << state.name();
+    for (int i = 0; i < state.attributeCount(); ++i) {
+        const ObjectState::Attribute& attribute = *state.attribute(i);
+        if ((isUnit && attribute.name == TTAMachine::Component::OSKEY_NAME) ||
+            attribute.name == TTAMachine::Port::OSKEY_FIRST_SOCKET ||
+            attribute.name == TTAMachine::Port::OSKEY_SECOND_SOCKET) {
+            continue;
+        }
+        key << " " << attribute.name << "=\"" << attribute.value << "\"";
+    }
+    key << ">" << state.stringValue();
+    for (int i = 0; i < state.childCount(); ++i) {
+        writeStateKey(*state.child(i), false, key);
+    }
+    key << "</>";
+}
+
+/**
+ * Estimates the energy of the given FU from its operation trigger counts.
+ *
+ * The energies of executing each operation once and of an idle cycle are
+ * cached, so that the energy of a new trace can be computed from the
+ * trigger counts without the plugin once the operations have been
+ * estimated.
+ *
+ * @param architecture The FU architecture.
+ * @param implementationEntry The implementation information of FU.
+ * @param traceDB The simulation trace database.
+ * @param energy The energy is stored here.
+ * @return False if the plugin cannot estimate the energies of single
+ *         operations.
+ * @exception Exception If the trace or the HDB could not be accessed.
+ */
+bool
+Estimator::functionUnitEnergyOfAccesses(
+    const TTAMachine::FunctionUnit& architecture,
+    const IDF::FUImplementationLocation& implementationEntry,
+    const ExecutionTrace& traceDB,
+    EnergyInMilliJoules& energy) {
+
+    UnitCosts& costs = functionUnitCosts(architecture, implementationEntry);
+    // the plugin is loaded only if an energy is not in the cache
+    FUCostEstimationPlugin* plugin = NULL;
+
+    boost::scoped_ptr<ExecutionTrace::FUOperationTriggerCountList>
+        operationTriggers(
+            traceDB.functionUnitOperationTriggerCounts(architecture.name()));
+    EnergyInMilliJoules totalEnergy = 0.0;
+    ClockCycleCount cyclesWithFUAccess = 0;
+    for (ExecutionTrace::FUOperationTriggerCountList::const_iterator i =
+             operationTriggers->begin(); i != operationTriggers->end(); ++i) {
+        const ExecutionTrace::OperationID operation =
+            StringTools::stringToLower(i->get<0>());
+        const ExecutionTrace::OperationTriggerCount count = i->get<1>();
+
+        std::map<std::string, EnergyInMilliJoules>::const_iterator cached =
+            costs.operationEnergies.find(operation);
+        EnergyInMilliJoules operationEnergy = 0.0;
+        if (cached != costs.operationEnergies.end()) {
+            operationEnergy = cached->second;
+        } else {
+            if (plugin == NULL) {
+                plugin = &fuCostFunctionPluginOfImplementation(
+                    implementationEntry);
+            }
+            if (!plugin->estimateOperationEnergy(
+                    architecture, implementationEntry, operation,
+                    operationEnergy, HDBRegistry::instance().hdb(
+                        implementationEntry.hdbFile()))) {
+                return false;
+            }
+            costs.operationEnergies[operation] = operationEnergy;
+        }
+        totalEnergy += operationEnergy * count;
+        cyclesWithFUAccess += count;
+    }
+
+    if (!costs.hasIdleEnergy) {
+        if (plugin == NULL) {
+            plugin = &fuCostFunctionPluginOfImplementation(
+                implementationEntry);
+        }
+        if (!plugin->estimateIdleEnergy(
+                architecture, implementationEntry, costs.idleEnergy,
+                HDBRegistry::instance().hdb(implementationEntry.hdbFile()))) {
+            return false;
+        }
+        costs.hasIdleEnergy = true;
+    }
+    totalEnergy += costs.idleEnergy *
+        (traceDB.simulatedCycleCount() - cyclesWithFUAccess);
+
+    energy = totalEnergy;
+    return true;
+}
+
+/**
+ * Estimates the energy of the given RF from its access counts.
+ *
+ * The energies of each count of concurrent reads and writes and of an idle
+ * cycle are cached like in functionUnitEnergyOfAccesses().
+ *
+ * @param architecture The RF architecture.
+ * @param implementationEntry The implementation information of RF.
+ * @param traceDB The simulation trace database.
+ * @param energy The energy is stored here.
+ * @return False if the plugin cannot estimate the energies of single
+ *         accesses.
+ * @exception Exception If the trace or the HDB could not be accessed.
+ */
+bool
+Estimator::registerFileEnergyOfAccesses(
+    const TTAMachine::BaseRegisterFile& architecture,
+    const IDF::RFImplementationLocation& implementationEntry,
+    const ExecutionTrace& traceDB,
+    EnergyInMilliJoules& energy) {
+
+    UnitCosts& costs = registerFileCosts(architecture, implementationEntry);
+    // the plugin is loaded only if an energy is not in the cache
+    RFCostEstimationPlugin* plugin = NULL;
+
+    boost::scoped_ptr<ExecutionTrace::ConcurrentRFAccessCountList> accessList(
+        traceDB.registerFileAccessCounts(architecture.name()));
+    EnergyInMilliJoules totalEnergy = 0.0;
+    ClockCycleCount cyclesWithRFAccess = 0;
+    for (ExecutionTrace::ConcurrentRFAccessCountList::const_iterator i =
+             accessList->begin(); i != accessList->end(); ++i) {
+        const std::pair<std::size_t, std::size_t> access(
+            i->get<0>(), i->get<1>());
+        const ClockCycleCount count = i->get<2>();
+
+        std::map<std::pair<std::size_t, std::size_t>, EnergyInMilliJoules>::
+            const_iterator cached = costs.accessEnergies.find(access);
+        EnergyInMilliJoules accessEnergy = 0.0;
+        if (cached != costs.accessEnergies.end()) {
+            accessEnergy = cached->second;
+        } else {
+            if (plugin == NULL) {
+                plugin = &rfCostFunctionPluginOfImplementation(
+                    implementationEntry);
+            }
+            if (!plugin->estimateAccessEnergy(
+                    architecture, implementationEntry, access.first,
+                    access.second, accessEnergy, HDBRegistry::instance().hdb(
+                        implementationEntry.hdbFile()))) {
+                return false;
+            }
+            costs.accessEnergies[access] = accessEnergy;
+        }
+        totalEnergy += accessEnergy * count;
+        cyclesWithRFAccess += count;
+    }
+
+    if (!costs.hasIdleEnergy) {
+        if (plugin == NULL) {
+            plugin = &rfCostFunctionPluginOfImplementation(
+                implementationEntry);
+        }
+        if (!plugin->estimateIdleEnergy(
+                architecture, implementationEntry, costs.idleEnergy,
+                HDBRegistry::instance().hdb(implementationEntry.hdbFile()))) {
+            return false;
+        }
+        costs.hasIdleEnergy = true;
+    }
+    totalEnergy += costs.idleEnergy *
+        (traceDB.simulatedCycleCount() - cyclesWithRFAccess);
+
+    energy = totalEnergy;
+    return true;
+}
+
 /**
  * Estimates the area of the given function unit.
  *
@@ -365,6 +635,10 @@ Estimator::functionUnitArea(
     const TTAMachine::FunctionUnit& architecture,
     const IDF::FUImplementationLocation& implementationEntry) {
     try {
+        UnitCosts& costs = functionUnitCosts(architecture, implementationEntry);
+        if (costs.hasArea) {
+            return costs.area;
+        }
         AreaInGates area = 0.0;
         HDB::HDBManager& hdb = HDBRegistry::instance().hdb(
             implementationEntry.hdbFile());
@@ -376,6 +650,8 @@ Estimator::functionUnitArea(
                     "Plugin was unable to estimate area of function unit '") +
                 architecture.name() + ".");
         }
+        costs.area = area;
+        costs.hasArea = true;
         return area;
     } catch (const Exception& e) {
         throw CannotEstimateCost(
@@ -399,6 +675,10 @@ Estimator::registerFileArea(
     const TTAMachine::BaseRegisterFile& architecture,
     const IDF::RFImplementationLocation& implementationEntry) {
     try {
+        UnitCosts& costs = registerFileCosts(architecture, implementationEntry);
+        if (costs.hasArea) {
+            return costs.area;
+        }
         AreaInGates area = 0.0;
         HDB::HDBManager& hdb = HDBRegistry::instance().hdb(
             implementationEntry.hdbFile());
@@ -408,6 +688,8 @@ Estimator::registerFileArea(
                 __FILE__, __LINE__, __func__,
                 std::string("Plugin was unable to estimate area."));
         }
+        costs.area = area;
+        costs.hasArea = true;
         return area;
     } catch (const Exception& e) {
         throw CannotEstimateCost(
@@ -512,6 +794,11 @@ Estimator::functionUnitEnergy(
     const IDF::FUImplementationLocation& implementationEntry,
     const TTAProgram::Program& program, const ExecutionTrace& traceDB) {
     try {
+        EnergyInMilliJoules energy = 0.0;
+        if (functionUnitEnergyOfAccesses(
+                architecture, implementationEntry, traceDB, energy)) {
+            return energy;
+        }
         AreaInGates area = 0.0;
         HDB::HDBManager& hdb = HDBRegistry::instance().hdb(
             implementationEntry.hdbFile());
@@ -553,6 +840,11 @@ Estimator::registerFileEnergy(
     const IDF::RFImplementationLocation& implementationEntry,
     const TTAProgram::Program& program, const ExecutionTrace& traceDB) {
     try {
+        EnergyInMilliJoules energy = 0.0;
+        if (registerFileEnergyOfAccesses(
+                architecture, implementationEntry, traceDB, energy)) {
+            return energy;
+        }
         AreaInGates area = 0.0;
         HDB::HDBManager& hdb = HDBRegistry::instance().hdb(
             implementationEntry.hdbFile());
@@ -680,6 +972,13 @@ Estimator::functionUnitPortWriteDelay(
     const TTAMachine::FUPort& port,
     const IDF::FUImplementationLocation& implementationEntry) {
     try {
+        UnitCosts& costs = functionUnitCosts(
+            *port.parentUnit(), implementationEntry);
+        std::map<std::string, DelayInNanoSeconds>::const_iterator cached =
+            costs.portWriteDelays.find(port.name());
+        if (cached != costs.portWriteDelays.end()) {
+            return cached->second;
+        }
         DelayInNanoSeconds delay = 0.0;
         HDB::HDBManager& hdb = HDBRegistry::instance().hdb(
             implementationEntry.hdbFile());
@@ -692,6 +991,7 @@ Estimator::functionUnitPortWriteDelay(
                     "%s::%s.") % port.parentUnit()->name() % port.name()).
                 str());
         }
+        costs.portWriteDelays[port.name()] = delay;
         return delay;
     } catch (const Exception& e) {
         throw CannotEstimateCost(
@@ -719,6 +1019,13 @@ Estimator::functionUnitPortReadDelay(
     const TTAMachine::FUPort& port,
     const IDF::FUImplementationLocation& implementationEntry) {
     try {
+        UnitCosts& costs = functionUnitCosts(
+            *port.parentUnit(), implementationEntry);
+        std::map<std::string, DelayInNanoSeconds>::const_iterator cached =
+            costs.portReadDelays.find(port.name());
+        if (cached != costs.portReadDelays.end()) {
+            return cached->second;
+        }
         DelayInNanoSeconds delay = 0.0;
         HDB::HDBManager& hdb = HDBRegistry::instance().hdb(
             implementationEntry.hdbFile());
@@ -731,6 +1038,7 @@ Estimator::functionUnitPortReadDelay(
                     "%s::%s.") % port.parentUnit()->name() % port.name()).
                 str());
         }
+        costs.portReadDelays[port.name()] = delay;
         return delay;
     } catch (const Exception& e) {
         throw CannotEstimateCost(
@@ -757,6 +1065,13 @@ Estimator::registerFilePortWriteDelay(
     const TTAMachine::RFPort& port,
     const IDF::RFImplementationLocation& implementationEntry) {
     try {
+        UnitCosts& costs = registerFileCosts(
+            *port.parentUnit(), implementationEntry);
+        std::map<std::string, DelayInNanoSeconds>::const_iterator cached =
+            costs.portWriteDelays.find(port.name());
+        if (cached != costs.portWriteDelays.end()) {
+            return cached->second;
+        }
         DelayInNanoSeconds delay = 0.0;
         HDB::HDBManager& hdb = HDBRegistry::instance().hdb(
             implementationEntry.hdbFile());
@@ -769,6 +1084,7 @@ Estimator::registerFilePortWriteDelay(
                     "%s::%s.") % port.parentUnit()->name() % port.name()).
                 str());
         }
+        costs.portWriteDelays[port.name()] = delay;
         return delay;
     } catch (const Exception& e) {
         throw CannotEstimateCost(
@@ -794,6 +1110,13 @@ Estimator::registerFilePortReadDelay(
     const TTAMachine::RFPort& port,
     const IDF::RFImplementationLocation& implementationEntry) {
     try {
+        UnitCosts& costs = registerFileCosts(
+            *port.parentUnit(), implementationEntry);
+        std::map<std::string, DelayInNanoSeconds>::const_iterator cached =
+            costs.portReadDelays.find(port.name());
+        if (cached != costs.portReadDelays.end()) {
+            return cached->second;
+        }
         DelayInNanoSeconds delay = 0.0;
         HDB::HDBManager& hdb = HDBRegistry::instance().hdb(
             implementationEntry.hdbFile());
@@ -806,6 +1129,7 @@ Estimator::registerFilePortReadDelay(
                     "%s::%s.") % port.parentUnit()->name() % port.name()).
                 str());
         }
+        costs.portReadDelays[port.name()] = delay;
         return delay;
     } catch (const Exception& e) {
         throw CannotEstimateCost(
@@ -835,6 +1159,10 @@ Estimator::functionUnitMaximumComputationDelay(
     const TTAMachine::FunctionUnit& architecture,
     const IDF::FUImplementationLocation& implementationEntry) {
     try {
+        UnitCosts& costs = functionUnitCosts(architecture, implementationEntry);
+        if (costs.hasComputationDelay) {
+            return costs.computationDelay;
+        }
         DelayInNanoSeconds delay = 0.0;
         HDB::HDBManager& hdb = HDBRegistry::instance().hdb(
             implementationEntry.hdbFile());
@@ -847,6 +1175,8 @@ Estimator::functionUnitMaximumComputationDelay(
                     "Plugin was unable to estimate computation delay of FU ") +
                 architecture.name());
         }
+        costs.computationDelay = delay;
+        costs.hasComputationDelay = true;
         return delay;
     } catch (const Exception& e) {
         throw CannotEstimateCost(
@@ -877,6 +1207,10 @@ Estimator::registerFileMaximumComputationDelay(
     const TTAMachine::BaseRegisterFile& architecture,
     const IDF::RFImplementationLocation& implementationEntry) {
     try {
+        UnitCosts& costs = registerFileCosts(architecture, implementationEntry);
+        if (costs.hasComputationDelay) {
+            return costs.computationDelay;
+        }
         DelayInNanoSeconds delay = 0.0;
         HDB::HDBManager& hdb = HDBRegistry::instance().hdb(
             implementationEntry.hdbFile());
@@ -889,6 +1223,8 @@ Estimator::registerFileMaximumComputationDelay(
                     "Plugin was unable to estimate computation delay of RF ") +
                 architecture.name());
         }
+        costs.computationDelay = delay;
+        costs.hasComputationDelay = true;
         return delay;
     } catch (const Exception& e) {
         throw CannotEstimateCost(
@@ -918,213 +1254,12 @@ Estimator::longestPath(
     //#define LONGEST_PATH_DEBUGGING
 
     DelayInNanoSeconds maximumICDelay = 0.0;
-
-    // find all the paths in IC
-    TransportPathList* icPaths = findAllICPaths(machine);
-
-    // find if there is bus that is fully connected
-    std::string fBusName = "";
-    TTAMachine::Machine::BusNavigator busNav = machine.busNavigator();
-    TTAMachine::Machine::SocketNavigator sNav = machine.socketNavigator();
-    for (int i = 0; i < busNav.count(); ++i) {
-        const TTAMachine::Bus& bus = *busNav.item(i);
-        const TTAMachine::Segment& segment = *bus.segment(0);
-
-        // check if bus is fully connected
-        if (segment.connectionCount() == sNav.count()) {
-            fBusName = bus.name();
-            break;
-        }
+    if (!longestICPathOfComponents(
+            machine, machineImplementation, maximumICDelay)) {
+        // the plugin can only estimate whole paths
+        maximumICDelay = longestICPathOfPaths(machine, machineImplementation);
     }
 
-    // calculate delays for all the paths in the machine
-    for (TransportPathList::iterator i = icPaths->begin(); 
-        i != icPaths->end(); ++i) {
-
-        // if fully connected bus was found, check only paths that contain it
-        if (fBusName != "" && fBusName != (i->bus()).name()) {
-            continue;
-        }
-
-        DelayInNanoSeconds readDelay = 0, writeDelay = 0, busDelay = 0,
-            pathDelay = 0;
-
-        TransportPath& path = *i;
-        
-        // calculate the port->socket, socket->port part by using FU/RF plugins
-        const TTAMachine::Port& sourcePort = path.sourcePort();
-
-        if (dynamic_cast<const TTAMachine::FUPort*>(&sourcePort) != NULL) {
-
-            const TTAMachine::FUPort& sourceFUPort = 
-                dynamic_cast<const TTAMachine::FUPort&>(sourcePort);
-            const TTAMachine::FunctionUnit& fu = *sourceFUPort.parentUnit();
-            if (!machineImplementation.hasFUImplementation(fu.name())) {
-                throw CannotEstimateCost(
-                    __FILE__, __LINE__, __func__, 
-                    (boost::format(
-                        "Implementation information missing for function unit "
-                        "'%s'.") % fu.name()).str());
-            }
-            // read delay
-            readDelay = functionUnitPortReadDelay(
-                sourceFUPort, machineImplementation.fuImplementation(
-                    fu.name()));
-        } else if (dynamic_cast<const TTAMachine::RFPort*>(&sourcePort) 
-                   != NULL) {
-            const TTAMachine::RFPort& sourceRFPort = 
-                dynamic_cast<const TTAMachine::RFPort&>(sourcePort);
-            const TTAMachine::BaseRegisterFile& rf = 
-                *sourceRFPort.parentUnit();
-            if (machineImplementation.hasRFImplementation(rf.name())) {
-                // read delay
-                readDelay = registerFilePortReadDelay( 
-                    sourceRFPort, machineImplementation.rfImplementation(
-                        rf.name()));
-            } else if (machineImplementation.hasIUImplementation(rf.name())) {
-                // read delay
-                readDelay = registerFilePortReadDelay( 
-                    sourceRFPort, machineImplementation.iuImplementation(
-                        rf.name()));
-            } else {
-                throw CannotEstimateCost(
-                    __FILE__, __LINE__, __func__, 
-                    (boost::format(
-                        "Implementation information missing for register file "
-                        "'%s'.") % rf.name()).str());
-            }
-        } else if (dynamic_cast<const TTAMachine::BaseFUPort*>(
-                       &sourcePort) != NULL) {
-            // @todo What to do with the GCU port?
-            readDelay = 0.0;
-        } else {
-            throw CannotEstimateCost(
-                __FILE__, __LINE__, __func__, "Unsupported port type.");
-        }
-
-        const TTAMachine::Port& destinationPort = path.destinationPort();
-
-        if (dynamic_cast<const TTAMachine::FUPort*>(&destinationPort) 
-            != NULL) {
-
-            const TTAMachine::FUPort& destinationFUPort = 
-                dynamic_cast<const TTAMachine::FUPort&>(destinationPort);
-            
-            const TTAMachine::FunctionUnit& fu = 
-                *destinationFUPort.parentUnit();
-
-            if (dynamic_cast<const TTAMachine::ControlUnit*>(&fu) != NULL) {
-                // @todo gcu port
-                writeDelay = 0.0;
-            } else if (!machineImplementation.hasFUImplementation(fu.name())) {
-                throw CannotEstimateCost(
-                    __FILE__, __LINE__, __func__, 
-                    (boost::format(
-                        "Implementation information missing for function "
-                        "unit '%s'.") % fu.name()).str());
-            } else {
-                // write delay
-                writeDelay = functionUnitPortWriteDelay( 
-                    destinationFUPort, machineImplementation.fuImplementation(
-                        fu.name()));
-            }
-        } else if (dynamic_cast<const TTAMachine::RFPort*>(&destinationPort) 
-                   != NULL) {
-            const TTAMachine::RFPort& destinationRFPort = 
-                dynamic_cast<const TTAMachine::RFPort&>(destinationPort);
-
-            const TTAMachine::BaseRegisterFile& rf = 
-                *destinationRFPort.parentUnit();
-            if (!machineImplementation.hasRFImplementation(rf.name())) {
-                throw CannotEstimateCost(
-                    __FILE__, __LINE__, __func__, 
-                    (boost::format(
-                        "Implementation information missing for register file "
-                        "'%s'.") % rf.name()).str());
-            }
-
-            // write delay
-            writeDelay += registerFilePortWriteDelay( 
-                destinationRFPort, machineImplementation.rfImplementation(
-                    rf.name()));
-        } else if (dynamic_cast<const TTAMachine::BaseFUPort*>(
-                       &destinationPort) != NULL) {
-            // @todo What to do with the GCU port?
-            writeDelay = 0.0;
-        } else {
-            throw CannotEstimateCost(
-                __FILE__, __LINE__, __func__, "Unsupported port type.");
-        }
-        
-
-        if (!machineImplementation.hasICDecoderPluginName() ||
-            !machineImplementation.hasICDecoderPluginFile() ||
-            !machineImplementation.hasICDecoderHDB()) {
-            throw CannotEstimateCost(
-                __FILE__, __LINE__, __func__, 
-                "Missing IC&decoder plugin information.");
-        }        
-
-        // Find out if there are idf entries to sockets and bus
-
-        IDF::SocketImplementationLocation* sourceSocketImplementation = NULL;
-        if (!machineImplementation.hasSocketImplementation(
-                path.sourceSocket().name())) {
-            sourceSocketImplementation = 
-                &IDF::NullUnitImplementationLocation::instance();
-        } else {
-            sourceSocketImplementation =
-                &machineImplementation.socketImplementation(
-                    path.sourceSocket().name());
-        }
-        IDF::SocketImplementationLocation* destinationSocketImplementation =
-            NULL;
-        if (!machineImplementation.hasSocketImplementation(
-                path.destinationSocket().name())) {
-            destinationSocketImplementation = 
-                &IDF::NullUnitImplementationLocation::instance();
-        } else {
-            destinationSocketImplementation =
-                &machineImplementation.socketImplementation(
-                    path.destinationSocket().name());
-        }
-        IDF::BusImplementationLocation* busImplementation = NULL;
-        if (!machineImplementation.hasBusImplementation(path.bus().name())) {
-            busImplementation = 
-                &IDF::NullUnitImplementationLocation::instance();
-        } else {
-            busImplementation = 
-                &machineImplementation.busImplementation(path.bus().name());
-        }
-
-        // calculate the socket->bus->socket part by using a ICDecoder plugin
-        busDelay = 
-            estimateSocketToSocketDelayOfPath(
-                machineImplementation.icDecoderPluginFile(), 
-                machineImplementation.icDecoderPluginName(),
-                path,
-                machineImplementation,
-                *sourceSocketImplementation,
-                *busImplementation,
-                *destinationSocketImplementation);
-
-        // the total delay of the path
-        pathDelay = readDelay + busDelay + writeDelay;
-
-        maximumICDelay = std::max(maximumICDelay, pathDelay);
-
-#ifdef LONGEST_PATH_DEBUGGING
-        const TTAMachine::Bus& bus = path.bus();
-        Application::logStream() 
-            << sourcePort.parentUnit()->name() << "::" 
-            << sourcePort.name() << " (" << readDelay << "), " 
-            << bus.name() << " (" << busDelay << "), "
-            << destinationPort.parentUnit()->name() << "::" 
-            << destinationPort.name() << " (" << writeDelay << ") = "
-            << pathDelay << std::endl;
-#endif
-    } // end of a for statement to calculate delays for all paths
-
     // find out if the longest path is in a function unit
     DelayInNanoSeconds maximumFUDelay = 0.0;
 
@@ -1210,12 +1345,375 @@ Estimator::longestPath(
 #endif
     }
        
-    delete icPaths;
-    icPaths = NULL;
-
     return std::max(maximumICDelay, std::max(maximumFUDelay, maximumRFDelay));
 }
 
+/**
+ * Calculates the longest path in the interconnection network by combining
+ * the delays of its components.
+ *
+ * A path goes from a port through an output socket, a bus and an input
+ * socket to another port, and its delay is the sum of the delays of these
+ * components. The longest path through a bus is thus the longest
+ * port-and-output-socket delay on the bus, plus the bus delay, plus the
+ * longest input-socket-and-port delay on the bus. Each port, socket and bus
+ * is estimated only once, which makes the calculation linear in the count
+ * of connections instead of enumerating every path of the machine.
+ *
+ * @param machine Machine to calculate the longest path for.
+ * @param machineImplementation Implementation identifier for the machine.
+ * @param delay The delay of the longest path is stored here.
+ * @return False in case the IC&decoder plugin cannot estimate the delays of
+ *         single sockets and buses.
+ * @exception CannotEstimateCost In case a delay could not be estimated.
+ * @exception IllegalMachine In case the machine has features that are not
+ *                           supported yet.
+ */
+bool
+Estimator::longestICPathOfComponents(
+    const TTAMachine::Machine& machine,
+    const IDF::MachineImplementation& machineImplementation,
+    DelayInNanoSeconds& delay) {
+
+    typedef std::vector<const TTAMachine::Socket*> SocketList;
+    // the port and socket part of the paths through each socket
+    std::map<const TTAMachine::Socket*, DelayInNanoSeconds> socketDelays;
+    ICDecoderEstimatorPlugin* plugin = NULL;
+
+    const TTAMachine::Bus* fullyConnectedBus = findFullyConnectedBus(machine);
+    DelayInNanoSeconds maximumICDelay = 0.0;
+    TTAMachine::Machine::BusNavigator busNav = machine.busNavigator();
+    for (int bi = 0; bi < busNav.count(); ++bi) {
+        const TTAMachine::Bus& bus = *busNav.item(bi);
+        if (bus.segmentCount() > 1) {
+            throw IllegalMachine(
+                __FILE__, __LINE__, __func__,
+                "Segmented buses not supported yet.");
+        }
+
+        SocketList outputSockets, inputSockets;
+        const TTAMachine::Segment& segment = *bus.segment(0);
+        for (int ci = 0; ci < segment.connectionCount(); ++ci) {
+            const TTAMachine::Socket& socket = *segment.connection(ci);
+            if (socket.direction() == TTAMachine::Socket::INPUT) {
+                inputSockets.push_back(&socket);
+            } else if (socket.direction() == TTAMachine::Socket::OUTPUT) {
+                outputSockets.push_back(&socket);
+            } else {
+                throw IllegalMachine(
+                    __FILE__, __LINE__, __func__,
+                    "Unsupported socket direction.");
+            }
+        }
+
+        // if fully connected bus was found, check only paths that contain it
+        if (fullyConnectedBus != NULL && fullyConnectedBus != &bus) {
+            continue;
+        }
+
+        if (plugin == NULL) {
+            if (!machineImplementation.hasICDecoderPluginName() ||
+                !machineImplementation.hasICDecoderPluginFile() ||
+                !machineImplementation.hasICDecoderHDB()) {
+                throw CannotEstimateCost(
+                    __FILE__, __LINE__, __func__,
+                    "Missing IC&decoder plugin information.");
+            }
+            try {
+                plugin = &icDecoderEstimatorPluginRegistry_.plugin(
+                    machineImplementation.icDecoderPluginFile(),
+                    machineImplementation.icDecoderPluginName());
+            } catch (const Exception& e) {
+                throw CannotEstimateCost(
+                    __FILE__, __LINE__, __func__,
+                    std::string(
+                        "Error while using ICDecoder estimation plugin. ") +
+                    e.errorMessage());
+            }
+        }
+
+        // the longest port and socket delay on both sides of the bus
+        DelayInNanoSeconds sourceDelay = -1.0, destinationDelay = -1.0;
+        SocketList* sides[] = { &outputSockets, &inputSockets };
+        DelayInNanoSeconds* sideDelays[] = { &sourceDelay, &destinationDelay };
+        for (int side = 0; side < 2; ++side) {
+            for (SocketList::const_iterator i = sides[side]->begin();
+                 i != sides[side]->end(); ++i) {
+                const TTAMachine::Socket& socket = **i;
+                if (socket.portCount() == 0) {
+                    continue;
+                }
+                std::map<const TTAMachine::Socket*, DelayInNanoSeconds>::
+                    const_iterator cached = socketDelays.find(&socket);
+                DelayInNanoSeconds socketDelay = 0.0;
+                if (cached != socketDelays.end()) {
+                    socketDelay = cached->second;
+                } else {
+                    if (!estimateSocketDelay(
+                            *plugin, socket, machineImplementation,
+                            socketDelay)) {
+                        return false;
+                    }
+                    DelayInNanoSeconds portDelay = 0.0;
+                    for (int pi = 0; pi < socket.portCount(); ++pi) {
+                        const TTAMachine::Port& port = *socket.port(pi);
+                        portDelay = std::max(
+                            portDelay, side == 0 ?
+                            portReadDelay(port, machineImplementation) :
+                            portWriteDelay(port, machineImplementation));
+                    }
+                    socketDelay += portDelay;
+                    socketDelays[&socket] = socketDelay;
+                }
+                *sideDelays[side] = std::max(*sideDelays[side], socketDelay);
+            }
+        }
+        if (sourceDelay < 0.0 || destinationDelay < 0.0) {
+            // no paths go through the bus
+            continue;
+        }
+
+        DelayInNanoSeconds busDelay = 0.0;
+        if (!estimateBusDelay(
+                *plugin, bus, machineImplementation, busDelay)) {
+            return false;
+        }
+        DelayInNanoSeconds pathDelay = sourceDelay + busDelay +
+            destinationDelay;
+        maximumICDelay = std::max(maximumICDelay, pathDelay);
+
+#ifdef LONGEST_PATH_DEBUGGING
+        Application::logStream()
+            << "longest path through " << bus.name() << ": "
+            << sourceDelay << " + " << busDelay << " + "
+            << destinationDelay << " = " << pathDelay << std::endl;
+#endif
+    }
+    delay = maximumICDelay;
+    return true;
+}
+
+/**
+ * Calculates the longest path in the interconnection network by estimating
+ * every transport path of the machine.
+ *
+ * Used with IC&decoder plugins that estimate only whole paths.
+ *
+ * @param machine Machine to calculate the longest path for.
+ * @param machineImplementation Implementation identifier for the machine.
+ * @return The delay of the longest path.
+ * @exception CannotEstimateCost In case a delay could not be estimated.
+ * @exception IllegalMachine In case the machine has features that are not
+ *                           supported yet.
+ */
+DelayInNanoSeconds
+Estimator::longestICPathOfPaths(
+    const TTAMachine::Machine& machine,
+    const IDF::MachineImplementation& machineImplementation) {
+
+    DelayInNanoSeconds maximumICDelay = 0.0;
+
+    // find all the paths in IC
+    boost::scoped_ptr<TransportPathList> icPaths(findAllICPaths(machine));
+
+    const TTAMachine::Bus* fullyConnectedBus = findFullyConnectedBus(machine);
+
+    // calculate delays for all the paths in the machine
+    for (TransportPathList::iterator i = icPaths->begin();
+        i != icPaths->end(); ++i) {
+
+        // if fully connected bus was found, check only paths that contain it
+        if (fullyConnectedBus != NULL && fullyConnectedBus != &i->bus()) {
+            continue;
+        }
+
+        TransportPath& path = *i;
+
+        // calculate the port->socket, socket->port part by using FU/RF plugins
+        DelayInNanoSeconds readDelay = portReadDelay(
+            path.sourcePort(), machineImplementation);
+        DelayInNanoSeconds writeDelay = portWriteDelay(
+            path.destinationPort(), machineImplementation);
+
+        if (!machineImplementation.hasICDecoderPluginName() ||
+            !machineImplementation.hasICDecoderPluginFile() ||
+            !machineImplementation.hasICDecoderHDB()) {
+            throw CannotEstimateCost(
+                __FILE__, __LINE__, __func__,
+                "Missing IC&decoder plugin information.");
+        }
+
+        // calculate the socket->bus->socket part by using a ICDecoder plugin
+        DelayInNanoSeconds busDelay = estimateSocketToSocketDelayOfPath(
+            machineImplementation.icDecoderPluginFile(),
+            machineImplementation.icDecoderPluginName(),
+            path,
+            machineImplementation,
+            socketImplementationOf(path.sourceSocket(), machineImplementation),
+            busImplementationOf(path.bus(), machineImplementation),
+            socketImplementationOf(
+                path.destinationSocket(), machineImplementation));
+
+        // the total delay of the path
+        DelayInNanoSeconds pathDelay = readDelay + busDelay + writeDelay;
+
+        maximumICDelay = std::max(maximumICDelay, pathDelay);
+
+#ifdef LONGEST_PATH_DEBUGGING
+        const TTAMachine::Port& sourcePort = path.sourcePort();
+        const TTAMachine::Port& destinationPort = path.destinationPort();
+        const TTAMachine::Bus& bus = path.bus();
+        Application::logStream()
+            << sourcePort.parentUnit()->name() << "::"
+            << sourcePort.name() << " (" << readDelay << "), "
+            << bus.name() << " (" << busDelay << "), "
+            << destinationPort.parentUnit()->name() << "::"
+            << destinationPort.name() << " (" << writeDelay << ") = "
+            << pathDelay << std::endl;
+#endif
+    } // end of a for statement to calculate delays for all paths
+
+    return maximumICDelay;
+}
+
+/**
+ * Finds a bus that is connected to all sockets of the machine.
+ *
+ * When such a bus exists, the other buses cannot have longer paths and
+ * only the paths through it are considered.
+ *
+ * @param machine The machine.
+ * @return The first fully connected bus, or NULL if there is none.
+ */
+const TTAMachine::Bus*
+Estimator::findFullyConnectedBus(const TTAMachine::Machine& machine) {
+    TTAMachine::Machine::BusNavigator busNav = machine.busNavigator();
+    TTAMachine::Machine::SocketNavigator sNav = machine.socketNavigator();
+    for (int i = 0; i < busNav.count(); ++i) {
+        const TTAMachine::Bus& bus = *busNav.item(i);
+        const TTAMachine::Segment& segment = *bus.segment(0);
+
+        // check if bus is fully connected
+        if (segment.connectionCount() == sNav.count()) {
+            return &bus;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Estimates the delay of reading the given port to a socket.
+ *
+ * @param port The source port of a transport.
+ * @param machineImplementation Implementation identifier for the machine.
+ * @return The read delay of the port.
+ * @exception CannotEstimateCost In case the delay could not be estimated.
+ */
+DelayInNanoSeconds
+Estimator::portReadDelay(
+    const TTAMachine::Port& port,
+    const IDF::MachineImplementation& machineImplementation) {
+
+    if (dynamic_cast<const TTAMachine::FUPort*>(&port) != NULL) {
+
+        const TTAMachine::FUPort& sourceFUPort =
+            dynamic_cast<const TTAMachine::FUPort&>(port);
+        const TTAMachine::FunctionUnit& fu = *sourceFUPort.parentUnit();
+        if (!machineImplementation.hasFUImplementation(fu.name())) {
+            throw CannotEstimateCost(
+                __FILE__, __LINE__, __func__,
+                (boost::format(
+                    "Implementation information missing for function unit "
+                    "'%s'.") % fu.name()).str());
+        }
+        return functionUnitPortReadDelay(
+            sourceFUPort, machineImplementation.fuImplementation(fu.name()));
+    } else if (dynamic_cast<const TTAMachine::RFPort*>(&port) != NULL) {
+        const TTAMachine::RFPort& sourceRFPort =
+            dynamic_cast<const TTAMachine::RFPort&>(port);
+        const TTAMachine::BaseRegisterFile& rf = *sourceRFPort.parentUnit();
+        if (machineImplementation.hasRFImplementation(rf.name())) {
+            return registerFilePortReadDelay(
+                sourceRFPort, machineImplementation.rfImplementation(
+                    rf.name()));
+        } else if (machineImplementation.hasIUImplementation(rf.name())) {
+            return registerFilePortReadDelay(
+                sourceRFPort, machineImplementation.iuImplementation(
+                    rf.name()));
+        } else {
+            throw CannotEstimateCost(
+                __FILE__, __LINE__, __func__,
+                (boost::format(
+                    "Implementation information missing for register file "
+                    "'%s'.") % rf.name()).str());
+        }
+    } else if (dynamic_cast<const TTAMachine::BaseFUPort*>(&port) != NULL) {
+        // @todo What to do with the GCU port?
+        return 0.0;
+    } else {
+        throw CannotEstimateCost(
+            __FILE__, __LINE__, __func__, "Unsupported port type.");
+    }
+    return 0.0;
+}
+
+/**
+ * Estimates the delay of writing the given port from a socket.
+ *
+ * @param port The destination port of a transport.
+ * @param machineImplementation Implementation identifier for the machine.
+ * @return The write delay of the port.
+ * @exception CannotEstimateCost In case the delay could not be estimated.
+ */
+DelayInNanoSeconds
+Estimator::portWriteDelay(
+    const TTAMachine::Port& port,
+    const IDF::MachineImplementation& machineImplementation) {
+
+    if (dynamic_cast<const TTAMachine::FUPort*>(&port) != NULL) {
+
+        const TTAMachine::FUPort& destinationFUPort =
+            dynamic_cast<const TTAMachine::FUPort&>(port);
+        const TTAMachine::FunctionUnit& fu = *destinationFUPort.parentUnit();
+
+        if (dynamic_cast<const TTAMachine::ControlUnit*>(&fu) != NULL) {
+            // @todo gcu port
+            return 0.0;
+        } else if (!machineImplementation.hasFUImplementation(fu.name())) {
+            throw CannotEstimateCost(
+                __FILE__, __LINE__, __func__,
+                (boost::format(
+                    "Implementation information missing for function "
+                    "unit '%s'.") % fu.name()).str());
+        }
+        return functionUnitPortWriteDelay(
+            destinationFUPort, machineImplementation.fuImplementation(
+                fu.name()));
+    } else if (dynamic_cast<const TTAMachine::RFPort*>(&port) != NULL) {
+        const TTAMachine::RFPort& destinationRFPort =
+            dynamic_cast<const TTAMachine::RFPort&>(port);
+        const TTAMachine::BaseRegisterFile& rf =
+            *destinationRFPort.parentUnit();
+        if (!machineImplementation.hasRFImplementation(rf.name())) {
+            throw CannotEstimateCost(
+                __FILE__, __LINE__, __func__,
+                (boost::format(
+                    "Implementation information missing for register file "
+                    "'%s'.") % rf.name()).str());
+        }
+        return registerFilePortWriteDelay(
+            destinationRFPort, machineImplementation.rfImplementation(
+                rf.name()));
+    } else if (dynamic_cast<const TTAMachine::BaseFUPort*>(&port) != NULL) {
+        // @todo What to do with the GCU port?
+        return 0.0;
+    } else {
+        throw CannotEstimateCost(
+            __FILE__, __LINE__, __func__, "Unsupported port type.");
+    }
+    return 0.0;
+}
+
 /**
  * Finds all paths in the interconnection network of the given machine.
  *
@@ -1345,5 +1843,93 @@ Estimator::estimateSocketToSocketDelayOfPath(
     }
     return delay;
 }
+
+/**
+ * Estimates the delay of the given socket with an IC&decoder plugin.
+ *
+ * @param plugin The IC&decoder estimator plugin to use.
+ * @param socket The socket to estimate.
+ * @param machineImplementation Implementation of the machine.
+ * @param delay The delay is stored here.
+ * @return False in case the plugin does not estimate single sockets.
+ * @exception CannotEstimateCost In case the plugin failed.
+ */
+bool
+Estimator::estimateSocketDelay(
+    ICDecoderEstimatorPlugin& plugin,
+    const TTAMachine::Socket& socket,
+    const IDF::MachineImplementation& machineImplementation,
+    DelayInNanoSeconds& delay) {
+    try {
+        return plugin.estimateICDelayOfSocket(
+            HDBRegistry::instance(), socket, machineImplementation,
+            socketImplementationOf(socket, machineImplementation), delay);
+    } catch (const Exception& e) {
+        throw CannotEstimateCost(
+            __FILE__, __LINE__, __func__,
+            std::string("Error while using ICDecoder estimation plugin. ") +
+            e.errorMessage());
+    }
+    return false;
+}
+
+/**
+ * Estimates the delay of the given bus with an IC&decoder plugin.
+ *
+ * @param plugin The IC&decoder estimator plugin to use.
+ * @param bus The bus to estimate.
+ * @param machineImplementation Implementation of the machine.
+ * @param delay The delay is stored here.
+ * @return False in case the plugin does not estimate single buses.
+ * @exception CannotEstimateCost In case the plugin failed.
+ */
+bool
+Estimator::estimateBusDelay(
+    ICDecoderEstimatorPlugin& plugin,
+    const TTAMachine::Bus& bus,
+    const IDF::MachineImplementation& machineImplementation,
+    DelayInNanoSeconds& delay) {
+    try {
+        return plugin.estimateICDelayOfBus(
+            HDBRegistry::instance(), bus, machineImplementation,
+            busImplementationOf(bus, machineImplementation), delay);
+    } catch (const Exception& e) {
+        throw CannotEstimateCost(
+            __FILE__, __LINE__, __func__,
+            std::string("Error while using ICDecoder estimation plugin. ") +
+            e.errorMessage());
+    }
+    return false;
+}
+
+/**
+ * Returns the implementation location of the given socket.
+ *
+ * @return The location, or a null location if the socket has none.
+ */
+const IDF::SocketImplementationLocation&
+Estimator::socketImplementationOf(
+    const TTAMachine::Socket& socket,
+    const IDF::MachineImplementation& machineImplementation) {
+    if (!machineImplementation.hasSocketImplementation(socket.name())) {
+        return IDF::NullUnitImplementationLocation::instance();
+    }
+    return machineImplementation.socketImplementation(socket.name());
+}
+
+/**
+ * Returns the implementation location of the given bus.
+ *
+ * @return The location, or a null location if the bus has none.
+ */
+const IDF::BusImplementationLocation&
+Estimator::busImplementationOf(
+    const TTAMachine::Bus& bus,
+    const IDF::MachineImplementation& machineImplementation) {
+    if (!machineImplementation.hasBusImplementation(bus.name())) {
+        return IDF::NullUnitImplementationLocation::instance();
+    }
+    return machineImplementation.busImplementation(bus.name());
+}
 }
 
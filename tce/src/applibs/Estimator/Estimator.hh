@@ -34,6 +34,10 @@
 #define TTA_COST_ESTIMATOR_HH
 
 #include <set>
+#include <map>
+#include <string>
+#include <utility>
+#include <ostream>
 
 #include "Exception.hh"
 #include "CostEstimatorTypes.hh"
@@ -50,6 +54,7 @@
 
 class ExecutionTrace;
 class UtilizationStats;
+class ObjectState;
 class FUCostEstimationPlugin;
 class RFCostEstimationPlugin;
 
@@ -60,6 +65,9 @@ namespace TTAMachine {
     class FUPort;
     class RFPort;
     class Port;
+    class Unit;
+    class Socket;
+    class Bus;
 }
 
 namespace TTAProgram {
@@ -81,6 +89,12 @@ namespace CostEstimator {
  * of single plugins, the situation is not exceptional, but they provide
  * estimation as a "capability", thus they signal explicitly whether they
  * can estimate a cost or not by returning true or false, respectively.
+ *
+ * The area and delay estimates of FU and RF implementations are cached for
+ * each architecture the implementation is used with, so that components
+ * reused in many explored machines are estimated only once. Energies are
+ * cached per operation execution or register file access when the plugin
+ * can estimate them separately, and multiplied by the counts in the trace.
  */
 class Estimator {
 public:
@@ -183,6 +197,46 @@ private:
     static TransportPathList* findAllICPaths(
         const TTAMachine::Machine& machine);
 
+    static const TTAMachine::Bus* findFullyConnectedBus(
+        const TTAMachine::Machine& machine);
+
+    bool longestICPathOfComponents(
+        const TTAMachine::Machine& machine,
+        const IDF::MachineImplementation& machineImplementation,
+        DelayInNanoSeconds& delay);
+
+    DelayInNanoSeconds longestICPathOfPaths(
+        const TTAMachine::Machine& machine,
+        const IDF::MachineImplementation& machineImplementation);
+
+    DelayInNanoSeconds portReadDelay(
+        const TTAMachine::Port& port,
+        const IDF::MachineImplementation& machineImplementation);
+
+    DelayInNanoSeconds portWriteDelay(
+        const TTAMachine::Port& port,
+        const IDF::MachineImplementation& machineImplementation);
+
+    bool estimateSocketDelay(
+        ICDecoderEstimatorPlugin& plugin,
+        const TTAMachine::Socket& socket,
+        const IDF::MachineImplementation& machineImplementation,
+        DelayInNanoSeconds& delay);
+
+    bool estimateBusDelay(
+        ICDecoderEstimatorPlugin& plugin,
+        const TTAMachine::Bus& bus,
+        const IDF::MachineImplementation& machineImplementation,
+        DelayInNanoSeconds& delay);
+
+    static const IDF::SocketImplementationLocation& socketImplementationOf(
+        const TTAMachine::Socket& socket,
+        const IDF::MachineImplementation& machineImplementation);
+
+    static const IDF::BusImplementationLocation& busImplementationOf(
+        const TTAMachine::Bus& bus,
+        const IDF::MachineImplementation& machineImplementation);
+
     DelayInNanoSeconds estimateSocketToSocketDelayOfPath(
         const std::string pluginPath, const std::string pluginName,
         const TransportPath& path,
@@ -198,12 +252,69 @@ private:
     RFCostEstimationPlugin& rfCostFunctionPluginOfImplementation(
         const IDF::RFImplementationLocation& implementation);
 
+    /// Cached estimates of an FU or RF implementation with one architecture.
+    struct UnitCosts {
+        UnitCosts();
+        /// True if the area has been estimated.
+        bool hasArea;
+        /// The area.
+        AreaInGates area;
+        /// True if the maximum computation delay has been estimated.
+        bool hasComputationDelay;
+        /// The maximum computation delay.
+        DelayInNanoSeconds computationDelay;
+        /// Read delays of the ports indexed by port name.
+        std::map<std::string, DelayInNanoSeconds> portReadDelays;
+        /// Write delays of the ports indexed by port name.
+        std::map<std::string, DelayInNanoSeconds> portWriteDelays;
+        /// Energies of executing FU operations once indexed by operation.
+        std::map<std::string, EnergyInMilliJoules> operationEnergies;
+        /// Energies of RF cycles indexed by concurrent reads and writes.
+        std::map<std::pair<std::size_t, std::size_t>, EnergyInMilliJoules>
+        accessEnergies;
+        /// True if the idle energy has been estimated.
+        bool hasIdleEnergy;
+        /// Energy of an idle cycle.
+        EnergyInMilliJoules idleEnergy;
+    };
+    /// Cached estimates indexed by implementation and architecture.
+    typedef std::map<std::string, UnitCosts> UnitCostMap;
+
+    UnitCosts& functionUnitCosts(
+        const TTAMachine::FunctionUnit& architecture,
+        const IDF::FUImplementationLocation& implementationEntry);
+
+    UnitCosts& registerFileCosts(
+        const TTAMachine::BaseRegisterFile& architecture,
+        const IDF::RFImplementationLocation& implementationEntry);
+
+    static std::string architectureKey(const TTAMachine::Unit& unit);
+
+    static void writeStateKey(
+        const ObjectState& state, bool isUnit, std::ostream& key);
+
+    bool functionUnitEnergyOfAccesses(
+        const TTAMachine::FunctionUnit& architecture,
+        const IDF::FUImplementationLocation& implementationEntry,
+        const ExecutionTrace& traceDB,
+        EnergyInMilliJoules& energy);
+
+    bool registerFileEnergyOfAccesses(
+        const TTAMachine::BaseRegisterFile& architecture,
+        const IDF::RFImplementationLocation& implementationEntry,
+        const ExecutionTrace& traceDB,
+        EnergyInMilliJoules& energy);
+
     /// all accessed FU estimation plugins are stored in this registry
     FUCostEstimationPluginRegistry fuEstimatorPluginRegistry_;
     /// all accessed RF estimation plugins are stored in this registry
     RFCostEstimationPluginRegistry rfEstimatorPluginRegistry_;
     /// all accessed IC&decoder plugins are stored in this registry
     ICDecoderCostEstimationPluginRegistry icDecoderEstimatorPluginRegistry_;
+    /// estimates of the FU implementations used so far
+    UnitCostMap fuCosts_;
+    /// estimates of the RF implementations used so far
+    UnitCostMap rfCosts_;
 };
 
 }
@@ -157,4 +157,52 @@ FUCostEstimationPlugin::estimateMaximumComputationDelay(
     return false;
 }
 
+/**
+ * Estimates the energy of executing the given operation once.
+ *
+ * Plugins may implement this together with estimateIdleEnergy() when the
+ * energy estimated by estimateEnergy() is the sum of the operation
+ * energies times their trigger counts and the idle energy times the cycles
+ * without triggers. The estimator can then cache the energies per
+ * implementation and compute the energy of new traces without the plugin.
+ * The default implementation returns false, in which case estimateEnergy()
+ * is used.
+ *
+ * @param architecture The FU architecture.
+ * @param implementation (The location of) the implementation of FU.
+ * @param operation The name of the operation in lower case.
+ * @param energy The variable to store the energy estimate into.
+ * @return True only if the energy could be estimated successfully.
+ */
+bool
+FUCostEstimationPlugin::estimateOperationEnergy(
+    const TTAMachine::FunctionUnit&,
+    const IDF::FUImplementationLocation&,
+    const std::string&,
+    EnergyInMilliJoules&,
+    HDB::HDBManager&) {
+
+    return false;
+}
+
+/**
+ * Estimates the energy of the given FU in a cycle it is not triggered.
+ *
+ * See estimateOperationEnergy(). The default implementation returns false.
+ *
+ * @param architecture The FU architecture.
+ * @param implementation (The location of) the implementation of FU.
+ * @param energy The variable to store the energy estimate into.
+ * @return True only if the energy could be estimated successfully.
+ */
+bool
+FUCostEstimationPlugin::estimateIdleEnergy(
+    const TTAMachine::FunctionUnit&,
+    const IDF::FUImplementationLocation&,
+    EnergyInMilliJoules&,
+    HDB::HDBManager&) {
+
+    return false;
+}
+
 }
@@ -99,6 +99,19 @@ public:
         const IDF::FUImplementationLocation& implementation,
         DelayInNanoSeconds& computationDelay,
         HDB::HDBManager& hdb);
+
+    virtual bool estimateOperationEnergy(
+        const TTAMachine::FunctionUnit& architecture,
+        const IDF::FUImplementationLocation& implementation,
+        const std::string& operation,
+        EnergyInMilliJoules& energy,
+        HDB::HDBManager& hdb);
+
+    virtual bool estimateIdleEnergy(
+        const TTAMachine::FunctionUnit& architecture,
+        const IDF::FUImplementationLocation& implementation,
+        EnergyInMilliJoules& energy,
+        HDB::HDBManager& hdb);
 };
 
 /**
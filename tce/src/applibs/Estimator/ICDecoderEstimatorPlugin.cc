@@ -89,6 +89,58 @@ ICDecoderEstimatorPlugin::estimateICDelayOfPath(
     return false;
 }
 
+/**
+ * Estimates the delay of a single socket in the interconnection network.
+ *
+ * Plugins may implement this together with estimateICDelayOfBus() when the
+ * delay of a path is the sum of the delays of its source socket, bus and
+ * destination socket. The estimator then finds the longest path of the
+ * machine without estimating every path separately. The default
+ * implementation returns false, in which case estimateICDelayOfPath() is
+ * used for all paths.
+ *
+ * @param hdbRegistry The registry for accessing HDBs.
+ * @param socket The socket.
+ * @param machineImplementation The implementation of the machine.
+ * @param socketImplementation The implementation identification of the
+ *                             socket.
+ * @param delay The calculated delay should be stored in this argument.
+ * @return True in case the delay can be estimated, false if it cannot.
+ */
+bool
+ICDecoderEstimatorPlugin::estimateICDelayOfSocket(
+    HDB::HDBRegistry&,
+    const TTAMachine::Socket&,
+    const IDF::MachineImplementation&,
+    const IDF::SocketImplementationLocation&,
+    DelayInNanoSeconds&) {
+
+    return false;
+}
+
+/**
+ * Estimates the delay of a single bus in the interconnection network.
+ *
+ * See estimateICDelayOfSocket(). The default implementation returns false.
+ *
+ * @param hdbRegistry The registry for accessing HDBs.
+ * @param bus The bus.
+ * @param machineImplementation The implementation of the machine.
+ * @param busImplementation The implementation identification of the bus.
+ * @param delay The calculated delay should be stored in this argument.
+ * @return True in case the delay can be estimated, false if it cannot.
+ */
+bool
+ICDecoderEstimatorPlugin::estimateICDelayOfBus(
+    HDB::HDBRegistry&,
+    const TTAMachine::Bus&,
+    const IDF::MachineImplementation&,
+    const IDF::BusImplementationLocation&,
+    DelayInNanoSeconds&) {
+
+    return false;
+}
+
 /**
  * Estimates the area of the IC of the given machine.
  *
@@ -41,6 +41,8 @@
 namespace TTAMachine {
     class Machine;
     class ControlUnit;
+    class Socket;
+    class Bus;
 }
 namespace TTAProgram {
     class Program;
@@ -78,6 +80,20 @@ public:
         destinationSocketImplementation,
         DelayInNanoSeconds& delay);    
 
+    virtual bool estimateICDelayOfSocket(
+        HDB::HDBRegistry& hdbRegistry,
+        const TTAMachine::Socket& socket,
+        const IDF::MachineImplementation& machineImplementation,
+        const IDF::SocketImplementationLocation& socketImplementation,
+        DelayInNanoSeconds& delay);
+
+    virtual bool estimateICDelayOfBus(
+        HDB::HDBRegistry& hdbRegistry,
+        const TTAMachine::Bus& bus,
+        const IDF::MachineImplementation& machineImplementation,
+        const IDF::BusImplementationLocation& busImplementation,
+        DelayInNanoSeconds& delay);
+
     virtual bool estimateICArea(
         HDB::HDBRegistry& hdbRegistry,
         const TTAMachine::Machine& machine,
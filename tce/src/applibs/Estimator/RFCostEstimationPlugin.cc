@@ -155,4 +155,54 @@ RFCostEstimationPlugin::estimateMaximumComputationDelay(
     return false;
 }
 
+/**
+ * Estimates the energy of a cycle in which the given RF is accessed by
+ * the given count of concurrent reads and writes.
+ *
+ * Plugins may implement this together with estimateIdleEnergy() when the
+ * energy estimated by estimateEnergy() is the sum of the access energies
+ * times their counts and the idle energy times the cycles without
+ * accesses. The estimator can then cache the energies per implementation
+ * and compute the energy of new traces without the plugin. The default
+ * implementation returns false, in which case estimateEnergy() is used.
+ *
+ * @param architecture The RF architecture.
+ * @param implementation (The location of) the implementation of RF.
+ * @param reads The count of concurrent reads.
+ * @param writes The count of concurrent writes.
+ * @param energy The variable to store the energy estimate into.
+ * @return True only if the energy could be estimated successfully.
+ */
+bool
+RFCostEstimationPlugin::estimateAccessEnergy(
+    const TTAMachine::BaseRegisterFile&,
+    const IDF::RFImplementationLocation&,
+    std::size_t,
+    std::size_t,
+    EnergyInMilliJoules&,
+    HDB::HDBManager&) {
+
+    return false;
+}
+
+/**
+ * Estimates the energy of the given RF in a cycle it is not accessed.
+ *
+ * See estimateAccessEnergy(). The default implementation returns false.
+ *
+ * @param architecture The RF architecture.
+ * @param implementation (The location of) the implementation of RF.
+ * @param energy The variable to store the energy estimate into.
+ * @return True only if the energy could be estimated successfully.
+ */
+bool
+RFCostEstimationPlugin::estimateIdleEnergy(
+    const TTAMachine::BaseRegisterFile&,
+    const IDF::RFImplementationLocation&,
+    EnergyInMilliJoules&,
+    HDB::HDBManager&) {
+
+    return false;
+}
+
 }
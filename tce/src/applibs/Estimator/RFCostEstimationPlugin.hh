@@ -35,6 +35,7 @@
 #define TTA_RF_COST_ESTIMATION_PLUGIN_HH
 
 #include <string>
+#include <cstddef>
 
 #include "Exception.hh"
 #include "CostEstimatorTypes.hh"
@@ -100,6 +101,20 @@ public:
         const IDF::RFImplementationLocation& implementation,
         DelayInNanoSeconds& computationDelay,
         HDB::HDBManager& hdb);
+
+    virtual bool estimateAccessEnergy(
+        const TTAMachine::BaseRegisterFile& architecture,
+        const IDF::RFImplementationLocation& implementation,
+        std::size_t reads,
+        std::size_t writes,
+        EnergyInMilliJoules& energy,
+        HDB::HDBManager& hdb);
+
+    virtual bool estimateIdleEnergy(
+        const TTAMachine::BaseRegisterFile& architecture,
+        const IDF::RFImplementationLocation& implementation,
+        EnergyInMilliJoules& energy,
+        HDB::HDBManager& hdb);
 };
 
 /**
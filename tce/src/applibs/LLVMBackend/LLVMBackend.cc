@@ -102,7 +102,14 @@ IGNORE_COMPILER_WARNING("-Wcomment")
 #define CONFIG_H
 
 #include <cstdlib> // system()
+#include <cerrno>
+#include <csignal> // kill()
 #include <fstream>
+#include <algorithm>
+#include <unistd.h> // getpid()
+#include <sstream>
+#include <boost/scoped_ptr.hpp>
+#include <boost/functional/hash.hpp>
 
 #include "LLVMBackend.hh"
 #include "LLVMTCECmdLineOptions.hh"
@@ -111,6 +118,7 @@ IGNORE_COMPILER_WARNING("-Wcomment")
 #include "Environment.hh"
 #include "Conversion.hh"
 #include "FileSystem.hh"
+#include "FileLock.hh"
 #include "TCETargetMachine.hh"
 #include "TCEStubTargetMachine.hh"
 #include "TCETargetMachinePlugin.hh"
@@ -437,27 +445,11 @@ LLVMBackend::compile(
             compile(*m.release(), emuM.release(), *plugin, target, optLevel,
                     debug, ipData);
     } catch (...) {
-        // delete the backend plugin if we don't want to save it
-        // Let's hope this doesn't crash as the plugin is loaded to the
-        // current process. TCETargetMachinePlugin dtor should unload it.
-        if (!options_->saveBackendPlugin()) {
-            TCEString pluginPath = 
-                cachePath_ + DS + pluginFilename(target);
-            FileSystem::removeFileOrDirectory(pluginPath);
-        }
         delete res; res = NULL;
         
         throw;
     }
 
-    // delete the backend plugin if we don't want to save it
-    // Let's hope this doesn't crash as the plugin is loaded to the
-    // current process. TCETargetMachinePlugin dtor should unload it.
-    if (!options_->saveBackendPlugin()) {
-        TCEString pluginPath = 
-            cachePath_ + DS + pluginFilename(target);
-        FileSystem::removeFileOrDirectory(pluginPath);
-    }
     delete res; res = NULL;
 
     return result;
@@ -717,6 +709,21 @@ LLVMBackend::compile(
  */
 TCETargetMachinePlugin*
 LLVMBackend::createPlugin(const TTAMachine::Machine& target) {
+    // The generated files are needed also for finding the cached plugin.
+    if (!options_->useOldBackendSources()) {
+        // Create target instruction and register definitions in .td files.
+        TDGen plugingen(target);
+        try {
+            plugingen.generateBackend(tempDir_);
+        } catch(Exception& e) {
+            std::string msg =
+                "Failed to build compiler plugin for target architecture.";
+            
+            CompileError ne(__FILE__, __LINE__, __func__, msg);
+            ne.setCause(e);
+            throw ne;
+        }
+    }
     std::string pluginFile = pluginFilename(target);
     std::string pluginFileName = "";
 
@@ -759,13 +766,11 @@ LLVMBackend::createPlugin(const TTAMachine::Machine& target) {
         FileSystem::fileIsReadable(pluginFileName)) {
 
         try {
-            pluginTool_.addSearchPath(cachePath_);
-            pluginTool_.registerModule(pluginFile);
-            TCETargetMachinePlugin* (*creator)();
-            pluginTool_.importSymbol(
-                "create_tce_backend_plugin", creator, pluginFile);
-
-            return creator();
+            TCETargetMachinePlugin* plugin =
+                loadPlugin(pluginFileName, target);
+            // the modification time orders the plugins for eviction
+            FileSystem::updateModificationTime(pluginFileName);
+            return plugin;
         } catch(Exception& e) {
             if (Application::verboseLevel() > 0) {
                 Application::logStream()
@@ -776,20 +781,37 @@ LLVMBackend::createPlugin(const TTAMachine::Machine& target) {
         }
     }
 
-    if (!options_->useOldBackendSources()) {
-        // Create target instruction and register definitions in .td files.
-        TDGen plugingen(target);
+    // Several compiler processes may need the same plugin at the same
+    // time. Only the process holding the lock of the plugin builds it to
+    // the cache, the others wait for the lock and load the built plugin.
+    // Plugins which are not saved are built to the temporary directory.
+    boost::scoped_ptr<FileLock> lock;
+    std::string buildFileName = tempDir_ + DS + pluginFile;
+    if (options_->saveBackendPlugin()) {
         try {
-            plugingen.generateBackend(tempDir_);
-        } catch(Exception& e) {
-            std::string msg =
-                "Failed to build compiler plugin for target architecture.";
-            
-            CompileError ne(__FILE__, __LINE__, __func__, msg);
-            ne.setCause(e);
-            throw ne;
+            lock.reset(new FileLock(pluginFileName + ".lock"));
+        } catch (const IOException& e) {
+            if (Application::verboseLevel() > 0) {
+                Application::logStream()
+                    << e.errorMessage() << " Not caching the plugin."
+                    << std::endl;
+            }
+        }
+    }
+    if (lock) {
+        if (FileSystem::fileExists(pluginFileName)) {
+            try {
+                return loadPlugin(pluginFileName, target);
+            } catch(Exception&) {
+                // rebuild the broken plugin
+            }
         }
+        // the plugin is built to a private file and published with an
+        // atomic rename so that a partially written plugin is never loaded
+        buildFileName =
+            pluginFileName + ".tmp." + Conversion::toString(getpid());
     }
+
     std::string tblgenbin = "llvm-tblgen";
        
     // Generate TCEGenRegisterNames.inc
@@ -931,7 +953,7 @@ LLVMBackend::createPlugin(const TTAMachine::Machine& target) {
 #endif
         " " + endianOption +
         " " + pluginSources +
-        " -o " + pluginFileName;
+        " -o " + buildFileName;
 
     // TODO: whether vectors are used or not stored in has of the
     // plugin. this is a temporary solution
@@ -943,6 +965,7 @@ LLVMBackend::createPlugin(const TTAMachine::Machine& target) {
     }
     ret = system(cmd.c_str());
     if (ret) {
+        FileSystem::removeFileOrDirectory(buildFileName);
         std::string msg = std::string() +
             "Failed to build compiler plugin for target architecture.\n" +
             "Failed command was: " + cmd;
@@ -950,28 +973,125 @@ LLVMBackend::createPlugin(const TTAMachine::Machine& target) {
         throw CompileError(__FILE__, __LINE__, __func__, msg);
     }
 
+    if (lock) {
+        if (!FileSystem::renameFile(buildFileName, pluginFileName)) {
+            FileSystem::removeFileOrDirectory(buildFileName);
+            std::string msg = std::string() +
+                "Unable to store plugin file '" + pluginFileName + "'.";
+            throw IOException(__FILE__, __LINE__, __func__, msg);
+        }
+        buildFileName = pluginFileName;
+        evictPlugins(pluginFile);
+    }
+
     // Load plugin.
-    TCETargetMachinePlugin* (*creator)();
     try {
-        pluginTool_.addSearchPath(cachePath_);
-        pluginTool_.registerModule(pluginFile);
-        pluginTool_.importSymbol(
-            "create_tce_backend_plugin", creator, pluginFile);       
+        return loadPlugin(buildFileName, target);
     } catch(Exception& e) {
         std::string msg = std::string() +
             "Unable to load plugin file '" +
-            pluginFileName + "'. Error: " + e.errorMessage();
+            buildFileName + "'. Error: " + e.errorMessage();
 
         IOException ne(__FILE__, __LINE__, __func__, msg);
         throw ne;
     }
+}
+
+/**
+ * Loads a backend plugin and creates the target machine plugin from it.
+ *
+ * The plugin encodes only the ISA of the machine, the machine itself is
+ * given to the created plugin.
+ *
+ * @param pluginPath Absolute path to the plugin file.
+ * @param target Target machine the plugin is loaded for.
+ * @return The created target machine plugin.
+ * @exception Exception If the plugin could not be loaded.
+ */
+TCETargetMachinePlugin*
+LLVMBackend::loadPlugin(
+    const std::string& pluginPath, const TTAMachine::Machine& target) {
+    TCETargetMachinePlugin* (*creator)();
+    pluginTool_.registerModule(pluginPath);
+    pluginTool_.importSymbol(
+        "create_tce_backend_plugin", creator, pluginPath);
+    TCETargetMachinePlugin* plugin = creator();
+    plugin->setMachine(target);
+    return plugin;
+}
+
+/**
+ * Removes the least recently used plugins from the cache until the total
+ * size of the cached plugins is within the cache size limit.
+ *
+ * Plugins loaded by other processes may be removed, they stay mapped in
+ * the processes which have already loaded them. Partially built plugins
+ * left behind by compiler processes that no longer exist are removed too.
+ *
+ * @param keep Filename of the plugin that is never removed.
+ */
+void
+LLVMBackend::evictPlugins(const std::string& keep) {
+    const uintmax_t maxSize =
+        static_cast<uintmax_t>(options_->backendCacheSize()) * 1024 * 1024;
+
+    std::vector<std::string> files =
+        FileSystem::directoryContents(cachePath_);
+    std::vector<std::pair<std::time_t, std::string> > plugins;
+    uintmax_t totalSize = 0;
+    for (std::size_t i = 0; i < files.size(); ++i) {
+        // the cache directory holds only plugins, as in tcecc's
+        // --clear-plugin-cache
+        const TCEString fileName = FileSystem::fileOfPath(files[i]);
+        const std::string::size_type tmpPos = fileName.rfind(".tmp.");
+        if (tmpPos != std::string::npos) {
+            const pid_t pid = static_cast<pid_t>(
+                std::atol(fileName.substr(tmpPos + 5).c_str()));
+            if (pid > 0 && kill(pid, 0) != 0 && errno == ESRCH) {
+                FileSystem::removeFileOrDirectory(files[i]);
+            }
+            continue;
+        }
+        if (maxSize == 0 || !fileName.endsWith(PLUGIN_SUFFIX)) {
+            continue;
+        }
+        const uintmax_t size = FileSystem::sizeInBytes(files[i]);
+        if (size == static_cast<uintmax_t>(-1)) {
+            continue;
+        }
+        totalSize += size;
+        plugins.push_back(
+            std::make_pair(
+                FileSystem::lastModificationTime(files[i]), files[i]));
+    }
 
-    return creator();
+    std::sort(plugins.begin(), plugins.end());
+    for (std::size_t i = 0; i < plugins.size() && totalSize > maxSize; ++i) {
+        const std::string& path = plugins[i].second;
+        if (FileSystem::fileOfPath(path) == keep) {
+            continue;
+        }
+        const uintmax_t size = FileSystem::sizeInBytes(path);
+        if (size != static_cast<uintmax_t>(-1) &&
+            FileSystem::removeFileOrDirectory(path)) {
+            totalSize -= size;
+        }
+    }
 }
 
 /**
  * Returns (hopefully) unique plugin filename for target architecture.
  *
+ * The filename is a hash of the plugin sources TDGen generated to the
+ * temporary directory and of the options used in compiling the plugin.
+ * The generated sources describe only the ISA: register files, operation
+ * patterns, address spaces and the calling convention. Everything else in
+ * the plugin is static code and the machine is given to the plugin when it
+ * is loaded, so machines with the same programmer visible ISA share the
+ * plugin even if they differ in details TDGen does not encode, such as
+ * buses, connectivity or latencies. If the sources have not been
+ * generated, the hash of the whole machine is used.
+ *
  * The filename includes also the TCE version string to avoid problems with 
  * incompatible backend plugins between TCE revisions.
  *  The filename is used for cached plugins.
@@ -981,7 +1101,35 @@ LLVMBackend::createPlugin(const TTAMachine::Machine& target) {
  */
 std::string
 LLVMBackend::pluginFilename(const TTAMachine::Machine& target) {
-    TCEString fileName = target.hash();
+    static const char* const generatedFiles[] = {
+        "TCE.td", "GenRegisterInfo.td", "GenInstrInfo.td",
+        "GenCallingConv.td", "Backend.inc"
+    };
+
+    std::string sources;
+    for (std::size_t i = 0;
+         i < sizeof(generatedFiles) / sizeof(generatedFiles[0]); ++i) {
+        std::ifstream file((tempDir_ + DS + generatedFiles[i]).c_str());
+        if (!file) {
+            sources.clear();
+            break;
+        }
+        std::ostringstream contents;
+        contents << file.rdbuf();
+        sources += contents.str();
+    }
+
+    TCEString fileName;
+    if (sources.empty()) {
+        fileName = target.hash();
+    } else {
+        sources += target.isLittleEndian() ? "-DLITTLE_ENDIAN_TARGET" : "";
+        sources += options_->useVectorBackend() ? "-DUSE_VECTOR_REGS" : "";
+        boost::hash<std::string> stringHasher;
+        fileName = Conversion::toHexString(sources.length()).substr(2);
+        fileName += "_";
+        fileName += Conversion::toHexString(stringHasher(sources)).substr(2);
+    }
     fileName += "-" + Application::TCEVersionString();
     fileName += PLUGIN_SUFFIX;
 
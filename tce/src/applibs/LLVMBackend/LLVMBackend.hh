@@ -87,6 +87,9 @@ public:
 
 private:
     std::string pluginFilename(const TTAMachine::Machine& target);
+    llvm::TCETargetMachinePlugin* loadPlugin(
+        const std::string& pluginPath, const TTAMachine::Machine& target);
+    void evictPlugins(const std::string& keep);
 
     /// Assume we are running an installed TCE version.
     bool useInstalledVersion_;
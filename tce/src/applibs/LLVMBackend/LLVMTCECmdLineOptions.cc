@@ -62,14 +62,22 @@ const std::string LLVMTCECmdLineOptions::SWL_USE_OLD_BACKEND_SOURCES =
 const std::string LLVMTCECmdLineOptions::SWL_ANALYZE_INSTRUCTION_PATTERNS = 
     "analyze-instruction-patterns";
 
+const std::string LLVMTCECmdLineOptions::SWL_PIPELINED_CODEGEN =
+    "pipelined-codegen";
+
 const std::string LLVMTCECmdLineOptions::SWL_TEMP_DIR = "temp-dir";
 
 const std::string LLVMTCECmdLineOptions::SWL_ENABLE_VECTOR_BACKEND = 
     "vector-backend";
 const std::string LLVMTCECmdLineOptions::SWL_WORK_ITEM_AA_FILE = "wi-aa-filename";
 const std::string LLVMTCECmdLineOptions::SWL_BACKEND_CACHE_DIR = "backend-cache-dir";
+const std::string LLVMTCECmdLineOptions::SWL_BACKEND_CACHE_SIZE =
+    "backend-cache-size";
 const std::string LLVMTCECmdLineOptions::SWL_INIT_SP = "init-sp";
 
+/// Default size limit of the backend plugin cache in megabytes.
+const unsigned LLVMTCECmdLineOptions::DEFAULT_BACKEND_CACHE_SIZE = 512;
+
 const std::string LLVMTCECmdLineOptions::USAGE =
     "Usage: llvmtce [OPTION]... BYTECODE\n"
     "Compile LLVM bytecode for target TCE architecture.\n";
@@ -175,11 +183,24 @@ LLVMTCECmdLineOptions::LLVMTCECmdLineOptions() {
             SWL_ANALYZE_INSTRUCTION_PATTERNS,
             "Analyze the instruction patterns after instruction selection."));
 
+    addOption(
+        new BoolCmdLineOptionParser(
+            SWL_PIPELINED_CODEGEN,
+            "Schedule each function in parallel with the LLVM code "
+            "generation of the next function."));
+
     addOption(
         new StringCmdLineOptionParser(
             SWL_BACKEND_CACHE_DIR,
             "The directory to use for caching LLVM backend plugins."));
 
+    addOption(
+        new UnsignedIntegerCmdLineOptionParser(
+            SWL_BACKEND_CACHE_SIZE,
+            "Maximum total size of the cached LLVM backend plugins in "
+            "megabytes. The least recently used plugins are removed when "
+            "the limit is exceeded. 0 means no limit."));
+
     addOption(
         new UnsignedIntegerCmdLineOptionParser(
             SWL_INIT_SP,
@@ -365,6 +386,11 @@ LLVMTCECmdLineOptions::analyzeInstructionPatterns() const {
     return findOption(SWL_ANALYZE_INSTRUCTION_PATTERNS)->isDefined();
 }
 
+bool
+LLVMTCECmdLineOptions::pipelinedCodeGeneration() const {
+    return findOption(SWL_PIPELINED_CODEGEN)->isDefined();
+}
+
 std::string
 LLVMTCECmdLineOptions::backendCacheDir() const {
     if (findOption(SWL_BACKEND_CACHE_DIR)->isDefined())
@@ -372,6 +398,13 @@ LLVMTCECmdLineOptions::backendCacheDir() const {
     return Environment::llvmtceCachePath();
 }
 
+unsigned
+LLVMTCECmdLineOptions::backendCacheSize() const {
+    if (findOption(SWL_BACKEND_CACHE_SIZE)->isDefined())
+        return findOption(SWL_BACKEND_CACHE_SIZE)->unsignedInteger();
+    return DEFAULT_BACKEND_CACHE_SIZE;
+}
+
 bool
 LLVMTCECmdLineOptions::isInitialStackPointerValueSet() const {
    return findOption(SWL_INIT_SP)->isDefined();
@@ -80,7 +80,10 @@ public:
 
     bool analyzeInstructionPatterns() const;
 
+    bool pipelinedCodeGeneration() const;
+
     std::string backendCacheDir() const;
+    unsigned backendCacheSize() const;
 
     TCEString tempDir() const;    
 
@@ -125,7 +128,10 @@ private:
     static const std::string SWL_ENABLE_VECTOR_BACKEND;
     static const std::string SWL_WORK_ITEM_AA_FILE;
     static const std::string SWL_ANALYZE_INSTRUCTION_PATTERNS;
+    static const std::string SWL_PIPELINED_CODEGEN;
     static const std::string SWL_BACKEND_CACHE_DIR;
+    static const std::string SWL_BACKEND_CACHE_SIZE;
+    static const unsigned DEFAULT_BACKEND_CACHE_SIZE;
     static const std::string SWL_INIT_SP;
     static const std::string USAGE;
 };
@@ -67,6 +67,7 @@ IGNORE_COMPILER_WARNING("-Wunused-parameter")
 
 
 #include <stdlib.h>
+#include <boost/bind.hpp>
 #include <llvm/ADT/SmallString.h>
 #include <llvm/MC/MCContext.h>
 #include <llvm/MC/MCSymbol.h>
@@ -99,7 +100,8 @@ LLVMTCEIRBuilder::LLVMTCEIRBuilder(
     InterPassData& ipd, AliasAnalysis* AA, bool functionAtATime, 
     bool modifyMF) :
     LLVMTCEBuilder(tm, mach, ID, functionAtATime), ipData_(&ipd), 
-    ddgBuilder_(ipd), modifyMF_(modifyMF), AA_(AA), options_(NULL), dsf_(NULL) {
+    ddgBuilder_(ipd), modifyMF_(modifyMF), AA_(AA), options_(NULL), dsf_(NULL),
+    pipelined_(false) {
     RegisterCopyAdder::findTempRegisters(*mach, ipd);
 
     if (functionAtATime_) {
@@ -122,11 +124,20 @@ LLVMTCEIRBuilder::LLVMTCEIRBuilder(
                 Application::cmdLineOptions());
     }
     delaySlotFilling_ = !options_->disableDelaySlotFiller();
+    // the scheduled code is written back to the machine functions and
+    // function at a time mode needs the result before returning
+    pipelined_ = 
+        options_->pipelinedCodeGeneration() && !functionAtATime_ &&
+        !modifyMF_;
 }
 
 bool
 LLVMTCEIRBuilder::writeMachineFunction(MachineFunction& mf) {
 
+    // the previous function must be complete before the program is
+    // modified again
+    waitForScheduler();
+
     if (tm_ == NULL)
         tm_ = &mf.getTarget();
 
@@ -184,29 +195,25 @@ LLVMTCEIRBuilder::writeMachineFunction(MachineFunction& mf) {
 
     markJumpTableDestinations(mf, *cfg);
 
+    if (pipelined_) {
+        // Only the parts which access LLVM data structures are done
+        // here. The rest runs in parallel with the code generation of
+        // the next function.
+        DataDependenceGraph* ddg = NULL;
+        if (!fastCompilation) {
+            EXIT_IF_THROWS(ddg = buildDDG(*cfg, aliasAnalysis()));
+        }
+        scheduler_ = boost::thread(
+            boost::bind(
+                &LLVMTCEIRBuilder::finishFunction, this, cfg, ddg,
+                procedure, irm));
+        return false;
+    }
+
     if (fastCompilation) {
         EXIT_IF_THROWS(compileFast(*cfg));
     } else {
-        AliasAnalysis* AA = NULL;
-        if (!AA_) {
-            // Called through LLVMBackend. We are actual module and 
-            // can get previous pass analysis!
-#ifdef LLVM_OLDER_THAN_3_8
-            AA = getAnalysisIfAvailable<AliasAnalysis>();
-#else
-            AAResultsWrapperPass* AARWPass =
-                getAnalysisIfAvailable<AAResultsWrapperPass>();
-            if (AARWPass)
-                AA = &AARWPass->getAAResults();
-#endif
-        } else {
-            // Called through LLVMTCEScheduler. We are not registered
-            // module in pass manager, so we do not have previous
-            // pass analysis data, but LLVMTCEScheduler kindly
-            // got them for us and passed through.        
-            AA = AA_;
-        }
-        EXIT_IF_THROWS(compileOptimized(*cfg, AA));
+        EXIT_IF_THROWS(compileOptimized(*cfg, aliasAnalysis()));
     }
 
     if (!modifyMF_) {
@@ -232,6 +239,81 @@ LLVMTCEIRBuilder::writeMachineFunction(MachineFunction& mf) {
     return false;
 }
 
+/**
+ * Completes a function in the scheduler thread of the pipelined mode.
+ *
+ * Schedules the function and copies it to its procedure. Takes the
+ * ownership of the CFG and the DDG.
+ *
+ * @param ddg The DDG of the function, NULL for the fast compilation.
+ */
+void
+LLVMTCEIRBuilder::finishFunction(
+    ControlFlowGraph* cfg, DataDependenceGraph* ddg,
+    TTAProgram::Procedure* procedure,
+    TTAProgram::InstructionReferenceManager* irm) {
+
+    try {
+        if (ddg == NULL) {
+            compileFast(*cfg);
+        } else {
+            scheduleOptimized(*cfg, ddg);
+        }
+        cfg->convertBBRefsToInstRefs();
+        cfg->copyToProcedure(*procedure, irm);
+        if (procedure->instructionCount() > 0) {
+            codeLabels_[procedure->name()] = &procedure->firstInstruction();
+        }
+    } catch (const Exception& e) {
+        schedulerError_ = e.errorMessage();
+    }
+    delete cfg;
+}
+
+/**
+ * Waits until the scheduler thread has completed the previous function.
+ *
+ * Exits like EXIT_IF_THROWS if scheduling the function failed.
+ */
+void
+LLVMTCEIRBuilder::waitForScheduler() {
+    if (scheduler_.joinable()) {
+        scheduler_.join();
+    }
+    if (!schedulerError_.empty()) {
+        Application::errorStream()
+            << "Error: " << schedulerError_ << std::endl;
+        exit(1);
+    }
+}
+
+/**
+ * Returns the LLVM alias analysis for the current function, or NULL.
+ */
+AliasAnalysis*
+LLVMTCEIRBuilder::aliasAnalysis() {
+    AliasAnalysis* AA = NULL;
+    if (!AA_) {
+        // Called through LLVMBackend. We are actual module and 
+        // can get previous pass analysis!
+#ifdef LLVM_OLDER_THAN_3_8
+        AA = getAnalysisIfAvailable<AliasAnalysis>();
+#else
+        AAResultsWrapperPass* AARWPass =
+            getAnalysisIfAvailable<AAResultsWrapperPass>();
+        if (AARWPass)
+            AA = &AARWPass->getAAResults();
+#endif
+    } else {
+        // Called through LLVMTCEScheduler. We are not registered
+        // module in pass manager, so we do not have previous
+        // pass analysis data, but LLVMTCEScheduler kindly
+        // got them for us and passed through.        
+        AA = AA_;
+    }
+    return AA;
+}
+
 ControlFlowGraph*
 LLVMTCEIRBuilder::buildTCECFG(llvm::MachineFunction& mf) {
 
@@ -664,6 +746,17 @@ LLVMTCEIRBuilder::compileOptimized(
     ControlFlowGraph& cfg, 
     llvm::AliasAnalysis* llvmAA) {
 
+    scheduleOptimized(cfg, buildDDG(cfg, llvmAA));
+}
+
+/**
+ * Builds the DDG of the function, uses the LLVM alias analysis.
+ */
+DataDependenceGraph*
+LLVMTCEIRBuilder::buildDDG(
+    ControlFlowGraph& cfg, 
+    llvm::AliasAnalysis* llvmAA) {
+
     SchedulerCmdLineOptions* options =
         dynamic_cast<SchedulerCmdLineOptions*>(
             Application::cmdLineOptions());
@@ -677,10 +770,22 @@ LLVMTCEIRBuilder::compileOptimized(
         DataDependenceGraph::INTRA_BB_ANTIDEPS, *mach_,
         NULL, true, true, llvmAA);
 
-    TCEString fnName = cfg.name();
 #ifdef WRITE_DDG_DOTS
-    ddg.writeToDotFile(fnName + "_ddg1.dot");
+    ddg->writeToDotFile(cfg.name() + "_ddg1.dot");
 #endif
+    return ddg;
+}
+
+/**
+ * Optimizes and schedules the function.
+ *
+ * Does not access the LLVM data structures. Deletes the DDG.
+ */
+void
+LLVMTCEIRBuilder::scheduleOptimized(
+    ControlFlowGraph& cfg, DataDependenceGraph* ddg) {
+
+    TCEString fnName = cfg.name();
     cfg.optimizeBBOrdering(true, cfg.instructionReferenceManager(), ddg);
 
     PreOptimizer preOpt(*ipData_);
@@ -876,6 +981,8 @@ LLVMTCEIRBuilder::doInitialization(Module& m) {
 bool
 LLVMTCEIRBuilder::doFinalization(Module& m) { 
 
+    waitForScheduler();
+
     // Catch the exception here as throwing exceptions
     // through library boundaries is flaky. It crashes 
     // on x86-32 Linux at least. See:
@@ -1043,6 +1150,10 @@ LLVMTCEIRBuilder::createMoveNode(
 
 LLVMTCEIRBuilder::~LLVMTCEIRBuilder() {
 
+    if (scheduler_.joinable()) {
+        scheduler_.join();
+    }
+
     LLVMTCECmdLineOptions* options = NULL;
     if (Application::cmdLineOptions() != NULL) {
         options = 
@@ -37,6 +37,8 @@
 #include <llvm/CodeGen/MachineFunctionPass.h>
 #include <llvm/Analysis/AliasAnalysis.h>
 
+#include <boost/thread.hpp>
+
 #include "LLVMTCEBuilder.hh"
 #include "DataDependenceGraphBuilder.hh"
 #include "CopyingDelaySlotFiller.hh"
@@ -134,10 +136,22 @@ namespace llvm {
             const TTAProgram::Procedure& proc,
             llvm::MachineFunction& mf);
 
+        llvm::AliasAnalysis* aliasAnalysis();
         void compileFast(ControlFlowGraph& cfg);
         void compileOptimized(
             ControlFlowGraph& cfg, 
             llvm::AliasAnalysis* llvmAA);
+        DataDependenceGraph* buildDDG(
+            ControlFlowGraph& cfg, 
+            llvm::AliasAnalysis* llvmAA);
+        void scheduleOptimized(
+            ControlFlowGraph& cfg, DataDependenceGraph* ddg);
+
+        void finishFunction(
+            ControlFlowGraph* cfg, DataDependenceGraph* ddg,
+            TTAProgram::Procedure* procedure,
+            TTAProgram::InstructionReferenceManager* irm);
+        void waitForScheduler();
 
         CopyingDelaySlotFiller& delaySlotFiller();
 
@@ -170,6 +184,14 @@ namespace llvm {
 
         CopyingDelaySlotFiller* dsf_;
         bool delaySlotFilling_;
+
+        /// Schedule each function in a thread while LLVM generates code
+        /// for the next function.
+        bool pipelined_;
+        /// The thread scheduling the previous function in pipelined mode.
+        boost::thread scheduler_;
+        /// Error message of the failed scheduler thread, empty if none.
+        std::string schedulerError_;
     };
 }
 
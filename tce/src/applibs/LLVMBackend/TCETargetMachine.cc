@@ -317,11 +317,16 @@ TCEPassConfig::addPreISel() {
 
 /**
  * Creates a TTAMachine::Machine object of the target architecture.
+ *
+ * The machine is a copy of the one the plugin was loaded for.
  */
 TTAMachine::Machine*
 TCETargetMachine::createMachine() {
+    std::string adfXML;
     ADFSerializer serializer;
-    serializer.setSourceString(*plugin_->adfXML());
+    serializer.setDestinationString(adfXML);
+    serializer.writeMachine(plugin_->machine());
+    serializer.setSourceString(adfXML);
     return serializer.readMachine();
 }
 
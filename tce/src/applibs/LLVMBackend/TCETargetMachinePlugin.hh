@@ -86,7 +86,7 @@ namespace llvm {
 
    class TCETargetMachinePlugin {
     public:
-       TCETargetMachinePlugin() : lowering_(NULL), tm_(NULL),
+       TCETargetMachinePlugin() : lowering_(NULL), tm_(NULL), mach_(NULL),
                                   dl_(TCEBEDLString)
 #ifdef LLVM_OLDER_THAN_3_7
            ,tsInfo_(&dl_)
@@ -127,8 +127,14 @@ namespace llvm {
        virtual int getTruePredicateOpcode(unsigned opc) const = 0;
        virtual int getFalsePredicateOpcode(unsigned opc) const = 0;
 
-       /// Returns pointer to xml string of the target machine .adf
-       virtual const std::string* adfXML() = 0;
+       /// Returns the target machine the plugin was loaded for.
+       virtual const TTAMachine::Machine& machine() const {
+           return *mach_;
+       }
+       /// Sets the target machine, called when the plugin is loaded.
+       virtual void setMachine(const TTAMachine::Machine& mach) {
+           mach_ = &mach;
+       }
        /// Returns name of the data address space.
        virtual std::string dataASName() = 0;
        /// Returns ID number of the return address register.
@@ -207,6 +213,9 @@ namespace llvm {
        TargetLowering* lowering_;
        TargetFrameLowering* frameInfo_;
        TCETargetMachine* tm_;
+       /// The target machine. Not part of the generated plugin, so that
+       /// machines with the same ISA can share the plugin.
+       const TTAMachine::Machine* mach_;
        TCESubtarget* subTarget_;
        DataLayout dl_; // Calculates type size & alignment
 #ifdef LLVM_OLDER_THAN_3_9
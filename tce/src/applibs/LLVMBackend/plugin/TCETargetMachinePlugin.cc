@@ -78,10 +78,6 @@ public:
         return TCE::KLUDGE_REGISTER;
     }
 
-    virtual const std::string* adfXML() {
-        return &adfXML_;
-    }
-
     virtual std::string rfName(unsigned dwarfRegNum);
     virtual unsigned registerIndex(unsigned dwarfRegNum);
 
@@ -150,7 +146,6 @@ private:
     std::map<unsigned, TCEString> regNames_;
     std::map<unsigned, unsigned> regIndices_;
 
-    std::string adfXML_;
     std::string dataASName_;
 };
 }
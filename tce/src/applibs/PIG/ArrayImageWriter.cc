@@ -68,7 +68,7 @@ ArrayImageWriter::writeImage(std::ostream& stream) const {
     for (int line = 1; line < lineCount; line++) {
         stream << "\"";
         writeSequence(stream, rowLength());
-        stream << "\"," << std::endl;
+        stream << "\",\n";
     }
     stream << "\"";
     bool padRemainingBits = true;
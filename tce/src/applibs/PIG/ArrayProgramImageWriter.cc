@@ -70,7 +70,7 @@ ArrayProgramImageWriter::writeImage(std::ostream& stream) const {
             programBits->instructionStartingPoint(i);
         stream << "\"";
         writeSequence(stream, instructionBoundary - previousBoundary);
-        stream << "\"," << std::endl;
+        stream << "\",\n";
         previousBoundary = instructionBoundary;
     }
     stream << "\"";
@@ -71,23 +71,21 @@ AsciiImageWriter::~AsciiImageWriter() {
  */
 void
 AsciiImageWriter::writeImage(std::ostream& stream) const {
-    int column = 0;
-    for (BitVector::const_iterator iter = bits_.begin(); iter != bits_.end();
-         iter++) {
-        BitVector::const_iterator nextIter = iter;
-        nextIter++;
-        stream << *iter;
-        column++;
-        if (column == rowLength_ && nextIter != bits_.end()) {
-            stream << '\n';
-            column = 0;
-        } else if (nextIter == bits_.end()) {
-            // pad the remaining bits with zeroes if necessary
-            while (column < rowLength_) {
-                stream << "0";
-                column++;
-            }
+    if (bits_.empty()) {
+        return;
+    }
+    std::size_t size = bits_.size();
+    // zero row length writes everything on one row
+    std::size_t rowLength = rowLength_ > 0 ? rowLength_ : size;
+    std::string row;
+    for (std::size_t rowStart = 0; rowStart < size; rowStart += rowLength) {
+        row.clear();
+        if (rowStart > 0) {
+            row += '\n';
         }
+        // the last row is padded with zeroes if necessary
+        appendBits(row, rowStart, rowLength);
+        stream << row;
     }
 }
 
@@ -135,13 +133,9 @@ AsciiImageWriter::writeSequence(
         throw OutOfRange(__FILE__, __LINE__, procName);
     }
 
-    for (unsigned int index = nextBitIndex_; index <= lastIndex; index++) {
-        if (index < bits_.size()) {
-            stream << bits_[index];
-        } else {
-            stream << "0";
-        }
-    }
+    std::string row;
+    appendBits(row, nextBitIndex_, length);
+    stream << row;
     nextBitIndex_ = lastIndex + 1;
 }
 
@@ -169,31 +163,64 @@ AsciiImageWriter::writeHexSequence(
     const int nibbleCount = static_cast<int>(ceil(
         static_cast<double>(length) / 4.0));
 
-    std::vector<bool> bitRow;
-
-    // Copy bitstream for one row
-    for (unsigned int i = nextBitIndex_; i <= lastIndex; ++i) {
-        bitRow.push_back(bits_[i]);
-    }
-
-    // optionally extend bit stream
-    int numPadBits = 4 * nibbleCount - length;
-    if (numPadBits) {
-        std::vector<bool> padBits(numPadBits, 0);
-        bitRow.insert(bitRow.begin(), padBits.begin(), padBits.end());
+    // the row is padded from the left to full nibbles
+    const std::size_t numPadBits = 4 * nibbleCount - length;
+    std::size_t available = 0;
+    if (nextBitIndex_ < bits_.size()) {
+        available = std::min<std::size_t>(length, bits_.size() - nextBitIndex_);
     }
-
-    // Generate a list of nibble
-    std::vector<uint8_t> Nibble;
-    for (auto it = bitRow.begin(); it < bitRow.end(); it += 4) {
-        Nibble.push_back(std::accumulate(
-            it, it + 4, 0,[] (int x, int y) {return (x << 1) + y;}));
+    std::vector<unsigned char> nibbles(nibbleCount, 0);
+    const unsigned int chunkBits = BitVector::WORD_BITS;
+    for (std::size_t offset = 0; offset < available; offset += chunkBits) {
+        unsigned int width =
+            std::min<std::size_t>(chunkBits, available - offset);
+        BitVector::StorageWord chunk =
+            bits_.field(nextBitIndex_ + offset, width);
+        for (unsigned int i = 0; i < width; i++) {
+            std::size_t position = numPadBits + offset + i;
+            nibbles[position / 4] |=
+                ((chunk >> (width - 1 - i)) & 1) << (3 - position % 4);
+        }
     }
 
-    // "print" hex stream
-    for (auto ui8 = Nibble.begin(); ui8 < Nibble.end(); ++ui8) {
-        stream << std::hex << (int) *ui8;
+    static const char hexDigits[] = "0123456789abcdef";
+    std::string row(nibbleCount, '0');
+    for (int nibble = 0; nibble < nibbleCount; nibble++) {
+        row[nibble] = hexDigits[nibbles[nibble]];
     }
+    stream << row;
 
     nextBitIndex_ += length;
 }
+
+/**
+ * Appends the given range of bits to the given row as '0' and '1'
+ * characters.
+ *
+ * The bits are read from the vector one storage word at a time. The bits
+ * past the end of the vector are written as zeroes.
+ *
+ * @param row The row to append to.
+ * @param start Index of the first bit to write.
+ * @param length Number of bits to write.
+ */
+void
+AsciiImageWriter::appendBits(
+    std::string& row, std::size_t start, std::size_t length) const {
+
+    std::size_t available = 0;
+    if (start < bits_.size()) {
+        available = std::min(length, bits_.size() - start);
+    }
+    row.reserve(row.size() + length);
+    const unsigned int chunkBits = BitVector::WORD_BITS;
+    for (std::size_t offset = 0; offset < available; offset += chunkBits) {
+        unsigned int width =
+            std::min<std::size_t>(chunkBits, available - offset);
+        BitVector::StorageWord chunk = bits_.field(start + offset, width);
+        for (unsigned int i = 0; i < width; i++) {
+            row += ((chunk >> (width - 1 - i)) & 1) ? '1' : '0';
+        }
+    }
+    row.append(length - available, '0');
+}
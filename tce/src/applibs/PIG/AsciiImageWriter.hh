@@ -34,6 +34,8 @@
 #ifndef TTA_ASCII_IMAGE_WRITER_HH
 #define TTA_ASCII_IMAGE_WRITER_HH
 
+#include <cstddef>
+
 #include "BitImageWriter.hh"
 #include "Exception.hh"
 
@@ -60,6 +62,9 @@ protected:
         std::ostream& stream, int length, bool padEnd = false) const;
 
 private:
+    void appendBits(
+        std::string& row, std::size_t start, std::size_t length) const;
+
     /// The bits to be written.
     const BitVector& bits_;
     /// The length of a row in the output.
@@ -69,7 +69,7 @@ AsciiProgramImageWriter::writeImage(std::ostream& stream) const {
         unsigned int instructionBoundary = 
             programBits->instructionStartingPoint(i);
         writeSequence(stream, instructionBoundary - previousBoundary);
-        stream << std::endl;
+        stream << '\n';
         previousBoundary = instructionBoundary;
     }
     writeSequence(stream, bits.size() - previousBoundary);
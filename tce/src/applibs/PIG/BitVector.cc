@@ -31,17 +31,19 @@
  */
 
 #include <string>
+#include <algorithm>
 
 #include "BitVector.hh"
-#include "MathTools.hh"
 #include "Application.hh"
 
 using std::string;
 
+const unsigned int BitVector::WORD_BITS;
+
 /**
  * The constructor.
  */
-BitVector::BitVector() {
+BitVector::BitVector() : size_(0) {
 }
 
 
@@ -58,18 +60,21 @@ BitVector::BitVector() {
  * @exception OutOfRange If the given indexes are too big or too small.
  */
 BitVector::BitVector(
-    const BitVector& vector, unsigned int firstIndex, unsigned int lastIndex) {
+    const BitVector& vector, unsigned int firstIndex, unsigned int lastIndex) :
+    size_(0) {
+
     if (lastIndex < firstIndex || lastIndex >= vector.size()) {
         const string procName = "BitVector::BitVector";
         throw OutOfRange(__FILE__, __LINE__, procName);
     }
 
-    BitVector::const_iterator firstIter = vector.begin();
-    firstIter += firstIndex;
-    BitVector::const_iterator lastIter = vector.begin();
-    lastIter += lastIndex + 1;
-    insert(begin(), firstIter, lastIter);
-    assert(size() == lastIndex - firstIndex + 1);
+    std::size_t length = lastIndex - firstIndex + 1;
+    reserve(length);
+    for (std::size_t i = 0; i < length; i += WORD_BITS) {
+        unsigned int width = std::min<std::size_t>(WORD_BITS, length - i);
+        pushBack(vector.field(firstIndex + i, width), width);
+    }
+    assert(size() == length);
 }
 
 /**
@@ -79,22 +84,117 @@ BitVector::~BitVector() {
 }
 
 
+/**
+ * Removes all the bits from the vector.
+ */
+void
+BitVector::clear() {
+    words_.clear();
+    size_ = 0;
+}
+
+
+/**
+ * Reserves storage for the given number of bits.
+ *
+ * @param bits The number of bits.
+ */
+void
+BitVector::reserve(std::size_t bits) {
+    words_.reserve((bits + WORD_BITS - 1) / WORD_BITS);
+}
+
+
+/**
+ * Resizes the vector to the given number of bits.
+ *
+ * New bits are initialized to zero.
+ *
+ * @param bits The new size in bits.
+ */
+void
+BitVector::resize(std::size_t bits) {
+    words_.resize((bits + WORD_BITS - 1) / WORD_BITS, 0);
+    size_ = bits;
+    unsigned int usedBits = size_ % WORD_BITS;
+    if (usedBits != 0) {
+        // keep the unused tail bits zero, they are compared as-is
+        words_.back() &= ~lowMask(WORD_BITS - usedBits);
+    }
+}
+
+
+/**
+ * Returns the bit at the given index.
+ *
+ * @param index The index.
+ * @return The bit.
+ * @exception OutOfRange If the index is out of the vector.
+ */
+bool
+BitVector::at(std::size_t index) const {
+    if (index >= size_) {
+        throw OutOfRange(__FILE__, __LINE__, __func__);
+    }
+    return (*this)[index];
+}
+
+
+/**
+ * Sets the bit at the given index.
+ *
+ * @param index The index.
+ * @param bit The new value of the bit.
+ */
+void
+BitVector::setBit(std::size_t index, bool bit) {
+    assert(index < size_);
+    StorageWord mask = 1ULL << (WORD_BITS - 1 - (index % WORD_BITS));
+    if (bit) {
+        words_[index / WORD_BITS] |= mask;
+    } else {
+        words_[index / WORD_BITS] &= ~mask;
+    }
+}
+
+
+/**
+ * Pushes back the given bit.
+ *
+ * @param bit The bit to be added.
+ */
+void
+BitVector::push_back(bool bit) {
+    if (size_ % WORD_BITS == 0) {
+        words_.push_back(0);
+    }
+    ++size_;
+    if (bit) {
+        setBit(size_ - 1, true);
+    }
+}
+
+
 /**
  * Pushes back the given number and increases the size of the vector by the
  * given amount.
  *
  * For example, if number 6 (110) is added with size 5, bits 00110 are 
  * concatenated to the vector. If size 2 is given, then bits 10 are
- * concatenated to the vector.
+ * concatenated to the vector. If size is larger than 64, the number is
+ * zero extended.
  *
  * @param integer The number to be added.
  * @param size The number of bits to be added.
  */
 void
 BitVector::pushBack(long long unsigned int integer, int size) {
-    for (int i = size - 1; i >= 0; i--) {
-        push_back(MathTools::bit(integer, i));
+    if (size <= 0) {
+        return;
     }
+    std::size_t position = size_;
+    resize(size_ + size);
+    setField(position, integer, size);
 }
     
 
@@ -105,12 +205,14 @@ BitVector::pushBack(long long unsigned int integer, int size) {
  */
 void
 BitVector::pushBack(const BitVector& bits) {
-    reserve(size() + bits.size());
-    for (std::vector<bool>::const_iterator iter = bits.begin();
-         iter != bits.end(); iter++) {
-        push_back(*iter);
+    std::size_t length = bits.size();
+    reserve(size() + length);
+    for (std::size_t i = 0; i < length; i += WORD_BITS) {
+        unsigned int width = std::min<std::size_t>(WORD_BITS, length - i);
+        pushBack(bits.field(i, width), width);
     }
 }
+
 /**
  * Pushes back the given bit.
  *
@@ -120,3 +222,131 @@ void
 BitVector::pushBack(bool bit) {
     push_back(bit);
 }
+
+
+/**
+ * Returns the field of at most 64 bits starting at the given position.
+ *
+ * The bit at the given position becomes the most significant bit of the
+ * returned value.
+ *
+ * @param position Index of the first (leftmost) bit of the field.
+ * @param width Width of the field, 1..64.
+ * @return The field value.
+ */
+BitVector::StorageWord
+BitVector::field(std::size_t position, unsigned int width) const {
+    assert(width > 0 && width <= WORD_BITS);
+    assert(position + width <= size_);
+
+    std::size_t wordIndex = position / WORD_BITS;
+    unsigned int freeBits = WORD_BITS - (position % WORD_BITS);
+    if (width <= freeBits) {
+        return (words_[wordIndex] >> (freeBits - width)) & lowMask(width);
+    }
+    unsigned int rest = width - freeBits;
+    return ((words_[wordIndex] & lowMask(freeBits)) << rest) |
+        (words_[wordIndex + 1] >> (WORD_BITS - rest));
+}
+
+
+/**
+ * Overwrites the field starting at the given position with the given value.
+ *
+ * The value is written MSB first, that is, the least significant bit of the
+ * value ends up at index position + width - 1. Fields wider than 64 bits
+ * are zero extended.
+ *
+ * @param position Index of the first (leftmost) bit of the field.
+ * @param value The value to write.
+ * @param width Width of the field.
+ */
+void
+BitVector::setField(
+    std::size_t position, StorageWord value, unsigned int width) {
+
+    assert(position + width <= size_);
+    while (width > WORD_BITS) {
+        unsigned int zeros = std::min(width - WORD_BITS, WORD_BITS);
+        setField(position, 0, zeros);
+        position += zeros;
+        width -= zeros;
+    }
+    if (width == 0) {
+        return;
+    }
+    value &= lowMask(width);
+
+    std::size_t wordIndex = position / WORD_BITS;
+    unsigned int freeBits = WORD_BITS - (position % WORD_BITS);
+    if (width <= freeBits) {
+        unsigned int shift = freeBits - width;
+        StorageWord mask = lowMask(width) << shift;
+        words_[wordIndex] = (words_[wordIndex] & ~mask) | (value << shift);
+        return;
+    }
+
+    unsigned int rest = width - freeBits;
+    StorageWord highMask = lowMask(freeBits);
+    words_[wordIndex] =
+        (words_[wordIndex] & ~highMask) | ((value >> rest) & highMask);
+    unsigned int shift = WORD_BITS - rest;
+    StorageWord lowPartMask = lowMask(rest) << shift;
+    words_[wordIndex + 1] =
+        (words_[wordIndex + 1] & ~lowPartMask) | (value << shift);
+}
+
+
+/**
+ * Tells whether the given vector contains exactly the same bits.
+ */
+bool
+BitVector::operator==(const BitVector& other) const {
+    return size_ == other.size_ && words_ == other.words_;
+}
+
+
+/**
+ * Tells whether the given vector differs from this one.
+ */
+bool
+BitVector::operator!=(const BitVector& other) const {
+    return !(*this == other);
+}
+
+
+/**
+ * Lexicographical comparison, equal to the one of std::vector<bool>.
+ *
+ * Since the bits are stored MSB first, comparing whole words as integers
+ * gives the same order as comparing them bit by bit.
+ */
+bool
+BitVector::operator<(const BitVector& other) const {
+    std::size_t common = std::min(size_, other.size_);
+    std::size_t fullWords = common / WORD_BITS;
+    for (std::size_t i = 0; i < fullWords; i++) {
+        if (words_[i] != other.words_[i]) {
+            return words_[i] < other.words_[i];
+        }
+    }
+    unsigned int restBits = common % WORD_BITS;
+    if (restBits != 0) {
+        StorageWord mask = ~lowMask(WORD_BITS - restBits);
+        StorageWord mine = words_[fullWords] & mask;
+        StorageWord theirs = other.words_[fullWords] & mask;
+        if (mine != theirs) {
+            return mine < theirs;
+        }
+    }
+    return size_ < other.size_;
+}
+
+
+/**
+ * Returns a mask with the given number of least significant bits set.
+ */
+BitVector::StorageWord
+BitVector::lowMask(unsigned int width) {
+    return width >= WORD_BITS ? ~0ULL : (1ULL << width) - 1;
+}
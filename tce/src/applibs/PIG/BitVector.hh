@@ -34,23 +34,96 @@
 #define TTA_BIT_VECTOR_HH
 
 #include <vector>
+#include <cstddef>
 #include "Exception.hh"
 
 /**
- * BitVector is a specialization of STL's bit vector. It provides some
- * handy helper methods.
+ * BitVector is a packed bit buffer used to construct program and data
+ * images.
+ *
+ * The bits are stored MSB first in 64-bit words so that whole fields can be
+ * appended, read and overwritten with a couple of shift-and-mask operations
+ * instead of one bit at a time. The bit at index 0 is the leftmost bit of
+ * the image. Unused bits at the end of the last word are always zero.
  */
-class BitVector : public std::vector<bool> {
+class BitVector {
 public:
+    /// Type of the storage words.
+    typedef unsigned long long StorageWord;
+
+    /// Iterator for reading the vector bit by bit.
+    class const_iterator {
+    public:
+        const_iterator() : vector_(NULL), index_(0) {}
+        const_iterator(const BitVector* vector, std::size_t index) :
+            vector_(vector), index_(index) {}
+        bool operator*() const { return (*vector_)[index_]; }
+        const_iterator& operator++() { ++index_; return *this; }
+        const_iterator operator++(int) {
+            const_iterator old = *this;
+            ++index_;
+            return old;
+        }
+        const_iterator& operator+=(std::ptrdiff_t n) {
+            index_ += n;
+            return *this;
+        }
+        bool operator==(const const_iterator& other) const {
+            return index_ == other.index_ && vector_ == other.vector_;
+        }
+        bool operator!=(const const_iterator& other) const {
+            return !(*this == other);
+        }
+    private:
+        const BitVector* vector_;
+        std::size_t index_;
+    };
+
+    /// Number of bits in one storage word.
+    static const unsigned int WORD_BITS = 64;
+
     BitVector();
     BitVector(
         const BitVector& vector, unsigned int firstIndex,
         unsigned int lastIndex);
     virtual ~BitVector();
 
+    std::size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    void clear();
+    void reserve(std::size_t bits);
+    void resize(std::size_t bits);
+
+    bool operator[](std::size_t index) const {
+        return (words_[index / WORD_BITS] >>
+                (WORD_BITS - 1 - (index % WORD_BITS))) & 1;
+    }
+    bool at(std::size_t index) const;
+    void setBit(std::size_t index, bool bit);
+
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, size_); }
+
+    void push_back(bool bit);
     void pushBack(long long unsigned int integer, int size);
     void pushBack(const BitVector& bits);
     void pushBack(bool bit);
+
+    StorageWord field(std::size_t position, unsigned int width) const;
+    void setField(
+        std::size_t position, StorageWord value, unsigned int width);
+
+    bool operator==(const BitVector& other) const;
+    bool operator!=(const BitVector& other) const;
+    bool operator<(const BitVector& other) const;
+
+private:
+    static StorageWord lowMask(unsigned int width);
+
+    /// The packed bits.
+    std::vector<StorageWord> words_;
+    /// Number of valid bits in the vector.
+    std::size_t size_;
 };
 
 #endif
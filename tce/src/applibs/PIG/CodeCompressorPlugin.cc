@@ -32,7 +32,10 @@
  */
 
 #include <string>
+#include <algorithm>
 #include <boost/format.hpp>
+#include <boost/thread.hpp>
+#include <boost/bind.hpp>
 
 #include "CodeCompressorPlugin.hh"
 #include "InstructionBitVector.hh"
@@ -98,6 +101,9 @@ using namespace TTAMachine;
 using namespace TPEF;
 using namespace TTAProgram;
 
+/// Instructions are not split to more threads than this many per thread.
+const std::size_t MIN_INSTRUCTIONS_PER_THREAD = 256;
+
 /**
  * The constructor.
  */
@@ -106,8 +112,8 @@ CodeCompressorPlugin::CodeCompressorPlugin() :
     currentProgram_(), bem_(NULL), machine_(NULL),
     parameters_(), programBits_(NULL), allStartsAtBeginningOfMAU_(false),
     mau_(0), addressSpaceOffset_(0), instructionsAtBeginningOfMAU_(),
-    immediatesToRelocate_(), terminalsToRelocate_(), relocMap_(),
-    indexTable_(), instructionAddresses_() {
+    immediatesToRelocate_(), terminalsToRelocate_(),
+    instructionAddresses_() {
 }
 
 
@@ -199,18 +205,14 @@ CodeCompressorPlugin::setBEM(const BinaryEncoding& bem) {
  */
 InstructionBitVector*
 CodeCompressorPlugin::bemBits(const TTAProgram::Program& program) {
-    relocMap_.clear();
-    indexTable_.clear();
 
+    InstructionBitsList bits = bemInstructionBits(
+        programInstructions(program));
     InstructionBitVector* imageBits = new InstructionBitVector();
-    for (int i = 0; i < program.procedureCount(); i++) {
-	Procedure& p = program.procedure(i);
-	for (int j = 0; j < p.instructionCount(); j++) {
-	    Instruction& instruction = p.instructionAtIndex(j);
-	    InstructionBitVector* bits = bemInstructionBits(instruction);
-	    assert(bits->size() == static_cast<size_t>(bem_->width()));
-	    imageBits->pushBack(*bits);
-	}
+    for (std::size_t i = 0; i < bits.size(); i++) {
+        assert(bits[i]->size() == static_cast<size_t>(bem_->width()));
+        imageBits->pushBack(*bits[i]);
+        delete bits[i];
     }
     return imageBits;
 }
@@ -391,9 +393,8 @@ CodeCompressorPlugin::addInstruction(
     }
 
     // fill the memory from last instruction to this instruction with 0's
-    for (unsigned int i = firstFree; i < instructionPosition; i++) {
-        programBits_->push_back(false);
-    }
+    static_cast<BitVector*>(programBits_)->pushBack(
+        0, instructionPosition - firstFree);
 
     // add the instruction bits
     programBits_->pushBack(*bits);
@@ -454,6 +455,7 @@ CodeCompressorPlugin::bemInstructionBits(
     }
 
     InstructionBitVector* instructionBits = new InstructionBitVector();
+    InstructionReferences references;
 
     // insert the bits to the vector
     for (int i = binaryEncoding().childFieldCount() - 1; i >= 0; i--) {
@@ -474,13 +476,13 @@ CodeCompressorPlugin::bemInstructionBits(
                 static_cast<size_t>(icField->width()));
         } else if (moveSlot != NULL) {
             addBitsForMoveSlot(
-                *moveSlot, instruction, *instructionBits);
+                *moveSlot, instruction, *instructionBits, references);
             assert(
                 instructionBits->size() - oldSize == 
                 static_cast<size_t>(moveSlot->width()));
         } else if (immField != NULL) {
             addBitsForImmediateSlot(
-                *immField, instruction, *instructionBits);
+                *immField, instruction, *instructionBits, references);
             assert(instructionBits->size() - oldSize == 
                    static_cast<size_t>(immField->width()));
         } else if (dstRegField != NULL) {
@@ -495,13 +497,13 @@ CodeCompressorPlugin::bemInstructionBits(
     }
 
     // mark the instruction references to the bit vector
-    for (RelocMap::const_iterator iter = relocMap_.begin(); 
-         iter != relocMap_.end(); iter++) {
+    for (RelocMap::const_iterator iter = references.relocMap.begin(); 
+         iter != references.relocMap.end(); iter++) {
         const Immediate* immediate = (*iter).first;
         const Instruction* instruction = (*iter).second;
-        assert(MapTools::containsKey(indexTable_, immediate));
+        assert(MapTools::containsKey(references.indexTable, immediate));
         vector<IndexBound> indexes = MapTools::valueForKey<
-            vector<IndexBound> >(indexTable_, immediate);
+            vector<IndexBound> >(references.indexTable, immediate);
         instructionBits->startSettingInstructionReference(*instruction);
         for (vector<IndexBound>::const_iterator iter = indexes.begin();
              iter != indexes.end(); iter++) {
@@ -509,12 +511,126 @@ CodeCompressorPlugin::bemInstructionBits(
         }
     }
 
-    relocMap_.clear();
-    indexTable_.clear();
-
     return instructionBits;
 }
 
+/**
+ * Returns the instructions of the given program in the address order.
+ *
+ * @param program The program.
+ * @return The instructions.
+ */
+CodeCompressorPlugin::InstructionList
+CodeCompressorPlugin::programInstructions(
+    const TTAProgram::Program& program) {
+
+    InstructionList instructions;
+    for (int i = 0; i < program.procedureCount(); i++) {
+        Procedure& procedure = program.procedure(i);
+        for (int j = 0; j < procedure.instructionCount(); j++) {
+            instructions.push_back(&procedure.instructionAtIndex(j));
+        }
+    }
+    return instructions;
+}
+
+/**
+ * Returns bit vectors that represent the given instructions as the BEM
+ * determines.
+ *
+ * The encoding of an instruction does not depend on the other instructions,
+ * so the instructions are encoded in parallel in contiguous chunks. The
+ * references to instruction addresses are left to the returned vectors
+ * and get fixed once the instructions are added to the program with
+ * addInstruction().
+ *
+ * @param instructions The instructions to encode.
+ * @return The newly created bit vectors in the same order as the
+ *         instructions are given.
+ * @exception InvalidData If the BEM is erroneous. The exception thrown by
+ *                        the first failed chunk is rethrown as it is.
+ */
+CodeCompressorPlugin::InstructionBitsList
+CodeCompressorPlugin::bemInstructionBits(
+    const InstructionList& instructions) {
+
+    if (bem_ == NULL) {
+        throw InvalidData(__FILE__, __LINE__, __func__);
+    }
+
+    // Instruction::address() caches the position of the instruction
+    // lazily, fill the caches before they are read by the worker threads.
+    if (currentPOM_ != NULL) {
+        for (int i = 0; i < currentPOM_->procedureCount(); i++) {
+            Procedure& procedure = currentPOM_->procedure(i);
+            for (int j = 0; j < procedure.instructionCount(); j++) {
+                procedure.instructionAtIndex(j).address();
+            }
+        }
+    }
+
+    InstructionBitsList bits(instructions.size(), NULL);
+    std::size_t threadCount = std::max(
+        1u, boost::thread::hardware_concurrency());
+    threadCount = std::min(
+        threadCount,
+        instructions.size() / MIN_INSTRUCTIONS_PER_THREAD + 1);
+    std::size_t chunkSize = 
+        (instructions.size() + threadCount - 1) / threadCount;
+
+    std::vector<std::exception_ptr> errors(threadCount);
+    boost::thread_group workers;
+    for (std::size_t t = 1; t < threadCount; t++) {
+        std::size_t first = std::min(t * chunkSize, instructions.size());
+        std::size_t last = std::min(first + chunkSize, instructions.size());
+        workers.create_thread(
+            boost::bind(
+                &CodeCompressorPlugin::encodeInstructions, this,
+                boost::cref(instructions), boost::ref(bits), first, last,
+                boost::ref(errors[t])));
+    }
+    encodeInstructions(
+        instructions, bits, 0, std::min(chunkSize, instructions.size()),
+        errors[0]);
+    workers.join_all();
+
+    for (std::size_t t = 0; t < threadCount; t++) {
+        if (errors[t]) {
+            for (std::size_t i = 0; i < bits.size(); i++) {
+                delete bits[i];
+            }
+            std::rethrow_exception(errors[t]);
+        }
+    }
+    return bits;
+}
+
+/**
+ * Encodes the given range of instructions.
+ *
+ * Worker function of the parallel bemInstructionBits(). Any exception is
+ * caught and stored, as it cannot propagate out of the worker thread.
+ *
+ * @param instructions The instructions.
+ * @param bits The vector where the encoded instructions are stored.
+ * @param first Index of the first instruction to encode.
+ * @param last Index of the instruction after the last one to encode.
+ * @param error Set to the exception thrown if the encoding fails.
+ */
+void
+CodeCompressorPlugin::encodeInstructions(
+    const InstructionList& instructions, InstructionBitsList& bits,
+    std::size_t first, std::size_t last, std::exception_ptr& error) {
+
+    try {
+        for (std::size_t i = first; i < last; i++) {
+            bits[i] = bemInstructionBits(*instructions[i]);
+        }
+    } catch (...) {
+        error = std::current_exception();
+    }
+}
+
 /**
  * Returns the bits of the program constructed by calling addInstruction 
  * method several times.
@@ -536,9 +652,7 @@ CodeCompressorPlugin::programBits() const {
     if (bitCount == mau_) {
         bitCount = 0;
     }
-    for (int i = 0; i < bitCount; i++) {
-        bits->push_back(false);
-    }
+    static_cast<BitVector*>(bits)->pushBack(0, bitCount);
 
     return bits;
 }
@@ -704,7 +818,7 @@ CodeCompressorPlugin::addBitsForICField(
 void
 CodeCompressorPlugin::addBitsForMoveSlot(
     const MoveSlot& slot, const TTAProgram::Instruction& instruction,
-    InstructionBitVector& bitVector) {
+    InstructionBitVector& bitVector, InstructionReferences& references) {
     // find the correct bus from the machine
     string busName = slot.name();
     Machine::BusNavigator busNav = machine().busNavigator();
@@ -748,7 +862,7 @@ CodeCompressorPlugin::addBitsForMoveSlot(
     InstructionTemplate* iTemp = itNav.item(instructionTemplate);
     if (iTemp->usesSlot(bus->name())) {
         encodeLongImmediate(
-            bus->name(), slot.width(), instruction, bitVector);        
+            bus->name(), slot.width(), instruction, bitVector, references);
     } else {
         encodeMove(slot, instruction, bitVector);
     }
@@ -906,7 +1020,8 @@ CodeCompressorPlugin::addBitsForGuardField(
 void
 CodeCompressorPlugin::addBitsForImmediateSlot(
     const ImmediateSlotField& immSlot,
-    const TTAProgram::Instruction& instruction, BitVector& bitVector) {
+    const TTAProgram::Instruction& instruction, BitVector& bitVector,
+    InstructionReferences& references) {
     // get the correct instruction template
     string instructionTemplate = "";
     try {
@@ -937,7 +1052,8 @@ CodeCompressorPlugin::addBitsForImmediateSlot(
     InstructionTemplate* iTemp = itNav.item(instructionTemplate);
     if (iTemp->usesSlot(immSlot.name())) {
         encodeLongImmediate(
-            immSlot.name(), immSlot.width(), instruction, bitVector);        
+            immSlot.name(), immSlot.width(), instruction, bitVector,
+            references);
     } else {
         // fill the slot with zeros
         bitVector.pushBack(0, immSlot.width());
@@ -1063,7 +1179,8 @@ CodeCompressorPlugin::encodeLongImmediate(
     const std::string& slotName,
     int slotWidth,
     const TTAProgram::Instruction& instruction,
-    BitVector& bitVector) {
+    BitVector& bitVector,
+    InstructionReferences& references) {
         
     // find the correct immediate from the instruction
     for (int i = 0; i < instruction.immediateCount(); i++) {
@@ -1097,9 +1214,7 @@ CodeCompressorPlugin::encodeLongImmediate(
             int zerosToAdd = slotWidth - (
                 leftmostBitToEncode - rightmostBitToEncode) - 1;
             assert(zerosToAdd >= 0);
-            for (int i = 0; i < zerosToAdd; i++) {
-                bitVector.push_back(false);
-            }
+            bitVector.pushBack(0, zerosToAdd);
 
             // push back the immediate value
             UIntWord immediateValue = imm.value().value().uIntWordValue();
@@ -1108,24 +1223,24 @@ CodeCompressorPlugin::encodeLongImmediate(
                 bitVector);
 
             // if the long immediate is address of an instruction, mark it
-            // to relocMap_ and indexTable_
+            // to the relocation map and index table
             if (AssocTools::containsKey(immediatesToRelocate_, &imm)) {
                 Instruction& referenced = currentPOM_->instructionAt(
                     immediateValue);
                 unsigned int startIndex = bitVector.size() - slotWidth;
                 unsigned int endIndex = bitVector.size() - 1;
-                relocMap_.insert(
+                references.relocMap.insert(
                     pair<const Immediate*, const Instruction*>(
                         &imm, &referenced));
                 vector<IndexBound> indices;
-                if (MapTools::containsKey(indexTable_, &imm)) {
+                if (MapTools::containsKey(references.indexTable, &imm)) {
                     indices = MapTools::valueForKey<vector<IndexBound> >(
-                        indexTable_, &imm);
+                        references.indexTable, &imm);
                 }
                 IndexBound bounds(startIndex, endIndex, limmSlotWidth,
                                   leftmostBitToEncode, rightmostBitToEncode);
                 indices.push_back(bounds);
-                indexTable_[&imm] = indices;
+                references.indexTable[&imm] = indices;
             }
 
             return;
@@ -1687,9 +1802,12 @@ CodeCompressorPlugin::addBits(
     int rightmostBit,
     BitVector& bitVector) {
     
-    for (int i = leftmostBit; i >= rightmostBit; i--) {
-        bitVector.push_back(MathTools::bit(number, i));
+    if (leftmostBit < rightmostBit) {
+        return;
     }
+    long long unsigned int value = number;
+    value = rightmostBit < 64 ? value >> rightmostBit : 0;
+    bitVector.pushBack(value, leftmostBit - rightmostBit + 1);
 }
 
 
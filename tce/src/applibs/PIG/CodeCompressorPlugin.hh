@@ -38,6 +38,7 @@
 #include <set>
 #include <map>
 #include <vector>
+#include <exception>
 
 #include "TCEString.hh"
 #include "Exception.hh"
@@ -154,6 +155,16 @@ protected:
     InstructionBitVector* bemInstructionBits(const TTAProgram::Instruction&);
     InstructionBitVector* programBits() const;
 
+    /// Instructions of a program in the address order.
+    typedef std::vector<const TTAProgram::Instruction*> InstructionList;
+    /// Encoded instructions.
+    typedef std::vector<InstructionBitVector*> InstructionBitsList;
+
+    static InstructionList programInstructions(
+        const TTAProgram::Program& program);
+    InstructionBitsList bemInstructionBits(
+        const InstructionList& instructions);
+
     bool hasParameter(const std::string& paramName) const;
     std::string parameterValue(const std::string& paramName) const;
 
@@ -184,12 +195,25 @@ private:
     typedef std::map<const TTAProgram::Instruction*, unsigned int> 
     InstructionAddressMap;
 
+    /// Instruction references found while encoding one instruction.
+    struct InstructionReferences {
+        /// Contains information to which instructions the immediates are
+        /// referring to.
+        RelocMap relocMap;
+        /// A table of indexes used when encoding long immediates.
+        IndexTable indexTable;
+    };
+
+    void encodeInstructions(
+        const InstructionList& instructions, InstructionBitsList& bits,
+        std::size_t first, std::size_t last, std::exception_ptr& error);
+
     void addBitsForICField(
         const ImmediateControlField& icField,
         const TTAProgram::Instruction& instruction, BitVector& bitVector) const;
     void addBitsForMoveSlot(
         const MoveSlot& slot, const TTAProgram::Instruction& instruction,
-        InstructionBitVector& bitVector);
+        InstructionBitVector& bitVector, InstructionReferences& references);
     void addBitsForSourceField(
         const SourceField& srcField, const TTAProgram::Move& move,
         InstructionBitVector& bitVector) const;
@@ -201,7 +225,8 @@ private:
         BitVector& bitVector);
     void addBitsForImmediateSlot(
         const ImmediateSlotField& immSlot,
-        const TTAProgram::Instruction& instruction, BitVector& bitVector);
+        const TTAProgram::Instruction& instruction, BitVector& bitVector,
+        InstructionReferences& references);
     void addBitsForDstRegisterField(
         const LImmDstRegisterField& field,
         const TTAProgram::Instruction& instruction, BitVector& bitVector);
@@ -214,7 +239,8 @@ private:
         const std::string& slotName,
         int slotWidth,
         const TTAProgram::Instruction& instruction, 
-        BitVector& bitVector);
+        BitVector& bitVector,
+        InstructionReferences& references);
     void encodeMove(
         const MoveSlot& slot, const TTAProgram::Instruction& instruction,
         InstructionBitVector& bitVector) const;
@@ -288,12 +314,6 @@ private:
     /// Set of (short) immediate terminals that refer to an instruction.
     TerminalSet terminalsToRelocate_;
     
-    /// Contains information to which instructions the immediates are
-    /// referring to.
-    RelocMap relocMap_;
-    /// A table of indexes used when encoding long immediates.
-    IndexTable indexTable_;
-    
     /// Contains the addresses of instructions.
     InstructionAddressMap instructionAddresses_;
 };
@@ -32,6 +32,7 @@
 
 #include <cmath>
 #include <iostream>
+#include <string>
 #include "AsciiImageWriter.hh"
 #include "CoeImageWriter.hh"
 #include "BitVector.hh"
@@ -63,14 +64,12 @@ void CoeImageWriter::writeImage(std::ostream& stream) const {
         ceil(static_cast<double>(bits().size()) / rowLength()));
     writeHeader(stream);
     if (lineCount == 0) {
-        for (int i = 0; i < rowLength(); i++) {
-            stream << "0";
-        }
+        stream << std::string(rowLength(), '0');
     } else {
         bool padEndings = false;
         for (int i = 0; i < lineCount-1; i++) {
             writeSequence(stream, rowLength(), padEndings);
-            stream << "," << endl;
+            stream << ",\n";
         }
         // last line might need padding
         padEndings = true;
@@ -47,13 +47,14 @@ public:
         try {
             startNewProgram(programName);
             setAllInstructionsToStartAtBeginningOfMAU();
-            Instruction* instruction = &currentProgram().firstInstruction();
-            while (instruction != &NullInstruction::instance()) {
-                InstructionBitVector* instructionBits = bemInstructionBits(
-                    *instruction);
-                addInstruction(*instruction, instructionBits);
-                instruction = 
-                    &currentProgram().nextInstruction(*instruction);
+            // encode the instructions in parallel, then place them to the
+            // image and fix the instruction references in order
+            InstructionList instructions =
+                programInstructions(currentProgram());
+            InstructionBitsList instructionBits =
+                bemInstructionBits(instructions);
+            for (std::size_t i = 0; i < instructions.size(); i++) {
+                addInstruction(*instructions[i], instructionBits[i]);
             }
 
             return programBits();
@@ -81,7 +81,7 @@ HexImageWriter::writeImage(std::ostream& stream) const {
 
         for (int i = 0; i < lineCount; ++i) {
             writeHexSequence(stream, rowLength(), padEndings);
-            stream << endl;
+            stream << '\n';
         }
     }
 }
@@ -33,18 +33,22 @@
 #include <string>
 
 #include "InstructionBitVector.hh"
-#include "MapTools.hh"
+#include "Instruction.hh"
+#include "Address.hh"
 #include "MathTools.hh"
 #include "Application.hh"
 
 using std::string;
 using TTAProgram::Instruction;
 
+/// Marks an instruction whose memory address is not known yet.
+static const unsigned int NO_ADDRESS = ~0u;
+
 /**
  * The constructor.
  */
 InstructionBitVector::InstructionBitVector() : 
-    BitVector(), currentTable_(NULL) {
+    BitVector(), currentReference_(-1) {
 }
 
 
@@ -55,29 +59,11 @@ InstructionBitVector::InstructionBitVector() :
  */
 InstructionBitVector::InstructionBitVector(
     const InstructionBitVector& toCopy) : 
-    BitVector(toCopy), currentTable_(NULL), 
+    BitVector(toCopy), references_(toCopy.references_),
+    referencesByTarget_(toCopy.referencesByTarget_),
+    currentReference_(toCopy.currentReference_),
     instructionBoundaries_(toCopy.instructionBoundaries_),
     instructionAddresses_(toCopy.instructionAddresses_) {
-
-    // copy reference map
-    for (ReferenceMap::const_iterator iter = toCopy.references_.begin();
-         iter != toCopy.references_.end(); iter++) {
-        const Instruction* instruction = (*iter).first;
-        IndexBoundSet* indexBounds = (*iter).second;
-        IndexBoundSet* newSet = new IndexBoundSet;
-        for (IndexBoundSet::const_iterator iter = indexBounds->begin();
-             iter != indexBounds->end(); iter++) {
-            IndexBoundTable* table = *iter;
-            IndexBoundTable* newTable = new IndexBoundTable(*table);
-            newSet->insert(newTable);
-            if (toCopy.currentTable_ == table) {
-                currentTable_ = newTable;
-            }
-        }
-        references_.insert(
-            std::pair<const Instruction*, IndexBoundSet*>(
-                instruction, newSet));
-    }    
 }
     
 
@@ -100,44 +86,25 @@ InstructionBitVector::~InstructionBitVector() {
  */
 void
 InstructionBitVector::pushBack(const InstructionBitVector& bits) {
-    for (ReferenceMap::const_iterator iter = bits.references_.begin();
+    unsigned int offset = size();
+    BitVector::pushBack(bits);
+
+    for (ReferenceTable::const_iterator iter = bits.references_.begin();
          iter != bits.references_.end(); iter++) {
-        const Instruction* instruction = (*iter).first;
-        IndexBoundSet* indexBoundSet = (*iter).second;
-        if (!MapTools::containsKey(references_, instruction)) {
-            IndexBoundSet* newSet = new IndexBoundSet;
-            addIndexBoundTables(*indexBoundSet, *newSet);
-            references_.insert(
-                std::pair<const Instruction*, IndexBoundSet*>(
-                    instruction, newSet));
-        } else {
-            IndexBoundSet* oldSet = MapTools::valueForKey<IndexBoundSet*>(
-                references_, instruction);
-            addIndexBoundTables(*indexBoundSet, *oldSet);
+        Reference reference = *iter;
+        for (IndexBoundTable::iterator boundIter = reference.bounds.begin();
+             boundIter != reference.bounds.end(); boundIter++) {
+            boundIter->incrStartIndex(offset);
+            boundIter->incrEndIndex(offset);
         }
-    }
+        addReference(reference);
 
-    InstructionBitVector bitsCopy(bits);
-    
-    // fix the instruction references of the given bit vector
-    for (ReferenceMap::const_iterator iter = bits.references_.begin();
-         iter != bits.references_.end(); iter++) {
-        const Instruction* instruction = iter->first;
-        IndexBoundSet* indexBoundSet = iter->second;
-        if (MapTools::containsKey(instructionAddresses_, instruction)) {
-            for (IndexBoundSet::const_iterator setIter = 
-                     indexBoundSet->begin(); 
-                 setIter != indexBoundSet->end(); setIter++) {
-                IndexBoundTable* table = *setIter;
-                bitsCopy.fixBits(
-                    *table, 
-                    MapTools::valueForKey<unsigned int>(
-                        instructionAddresses_, instruction));
-            }
+        // fix the references to the instructions already placed
+        if (hasAddress(reference.target)) {
+            fixBits(
+                reference.bounds, instructionAddresses_[reference.target]);
         }
-    }           
-         
-    insert(end(), bitsCopy.begin(), bitsCopy.end());
+    }
 }
 
 /**
@@ -160,10 +127,10 @@ void
 InstructionBitVector::startSettingInstructionReference(
     const TTAProgram::Instruction& instruction) {
 
-    IndexBoundSet& setForInstruction = indexBounds(instruction);
-    IndexBoundTable* newTable = new IndexBoundTable;
-    currentTable_ = newTable;
-    setForInstruction.insert(newTable);
+    Reference reference;
+    reference.target = programAddress(instruction);
+    addReference(reference);
+    currentReference_ = references_.size() - 1;
 }
 
 
@@ -178,9 +145,9 @@ InstructionBitVector::startSettingInstructionReference(
 void
 InstructionBitVector::addIndexBoundsForReference(IndexBound bounds) {
 
-    assert(currentTable_ != NULL);
+    assert(currentReference_ != -1);
     assert(bounds.slotStartIndex() <= bounds.slotEndIndex());
-    currentTable_->push_back(bounds);
+    references_[currentReference_].bounds.push_back(bounds);
 }
 
 
@@ -198,17 +165,19 @@ InstructionBitVector::addIndexBoundsForReference(IndexBound bounds) {
 void
 InstructionBitVector::fixInstructionAddress(
     const TTAProgram::Instruction& instruction, unsigned int address) {
-    instructionAddresses_.insert(
-        std::pair<const Instruction*, unsigned int>(&instruction, address));
-    if (!MapTools::containsKey(references_, &instruction)) {
+
+    unsigned int target = programAddress(instruction);
+    if (target >= instructionAddresses_.size()) {
+        instructionAddresses_.resize(target + 1, NO_ADDRESS);
+    }
+    instructionAddresses_[target] = address;
+
+    if (target >= referencesByTarget_.size()) {
         return;
-    } else {
-        IndexBoundSet& setForInstruction = indexBounds(instruction);
-        for (IndexBoundSet::const_iterator iter = setForInstruction.begin();
-             iter != setForInstruction.end(); iter++) {
-            IndexBoundTable* table = *iter;
-            fixBits(*table, address);
-        }
+    }
+    const std::vector<unsigned int>& indices = referencesByTarget_[target];
+    for (unsigned int i = 0; i < indices.size(); i++) {
+        fixBits(references_[indices[i]].bounds, address);
     }
 }
 
@@ -276,53 +245,46 @@ InstructionBitVector::instructionStartingPoint(unsigned int index) const {
 }
 
 /**
- * Returns the set of index bounds that refer to the given instruction.
+ * Returns the address of the given instruction in the program object model.
+ *
+ * The address is used as the index of the reference tables.
  *
  * @param instruction The instruction.
+ * @return The address.
  */
-InstructionBitVector::IndexBoundSet&
-InstructionBitVector::indexBounds(
+unsigned int
+InstructionBitVector::programAddress(
     const TTAProgram::Instruction& instruction) {
 
-    if (!MapTools::containsKey(references_, &instruction)) {
-        IndexBoundSet* newSet = new IndexBoundSet;
-        std::pair<const Instruction*, IndexBoundSet*> newPair(
-            &instruction, newSet);
-        references_.insert(newPair);
-        return *newSet;
-    } else {
-        return *MapTools::valueForKey<IndexBoundSet*>(
-            references_, &instruction);
-    }
-}    
+    return instruction.address().location();
+}
 
 
 /**
- * Adds the IndexBoundTables from the given IndexBoundSet to the given
- * IndexBoundSet.
+ * Adds the given reference to the reference tables.
  *
- * @param from The IndexBoundSet from which the tables are copied.
- * @param to The IndexBoundSet to which the tables are added.
+ * @param reference The reference.
  */
 void
-InstructionBitVector::addIndexBoundTables(
-    const IndexBoundSet& from, 
-    IndexBoundSet& to) {
-
-    for (IndexBoundSet::const_iterator iter = from.begin(); 
-         iter != from.end(); iter++) {
-
-        const IndexBoundTable* fromTable = *iter;
-        IndexBoundTable* newTable = new IndexBoundTable(*fromTable);
-        
-        for (IndexBoundTable::iterator iter = newTable->begin();
-             iter != newTable->end(); iter++) {
-            (*iter).incrStartIndex(size());
-            (*iter).incrEndIndex(size());
-        }
-
-        to.insert(newTable);
+InstructionBitVector::addReference(const Reference& reference) {
+    if (reference.target >= referencesByTarget_.size()) {
+        referencesByTarget_.resize(reference.target + 1);
     }
+    referencesByTarget_[reference.target].push_back(references_.size());
+    references_.push_back(reference);
+}
+
+
+/**
+ * Tells whether the memory address of the given instruction is known.
+ *
+ * @param target The POM address of the instruction.
+ * @return True if the address has been fixed.
+ */
+bool
+InstructionBitVector::hasAddress(unsigned int target) const {
+    return target < instructionAddresses_.size() &&
+        instructionAddresses_[target] != NO_ADDRESS;
 }
 
 
@@ -356,6 +318,7 @@ InstructionBitVector::fixBits(
 
         unsigned int startIndex = iBound.slotStartIndex();
         unsigned int endIndex = iBound.slotEndIndex();
+        unsigned int width = endIndex - startIndex + 1;
 
         if ((*iter).isLimmEncoded()) {
             // Check limm slice indices and update iteration boundaries.
@@ -365,15 +328,19 @@ InstructionBitVector::fixBits(
             stopBit = iBound.limmLeftIndex();
             assert((stopBit-currentBit) == (iBound.limmWidth()-1));
         }
-        for (unsigned int index = endIndex; index >= startIndex; index--) {
-            // Rewrite with new value required bits, zero the higher ones
-            if (currentBit <= stopBit) {
-                operator[](index) = MathTools::bit(value, currentBit);
-            } else {
-                operator[](index) = false;
+
+        // Rewrite the slice with the value bits currentBit..stopBit,
+        // zero the higher ones
+        StorageWord slice = 0;
+        int valueBits = stopBit - currentBit + 1;
+        if (valueBits > 0 && currentBit < 32) {
+            slice = value >> currentBit;
+            if (valueBits < 32) {
+                slice &= (1u << valueBits) - 1;
             }
-            currentBit++;
         }
+        setField(startIndex, slice, width);
+        currentBit += width;
     }
 }
 
@@ -33,8 +33,7 @@
 #ifndef TTA_INSTRUCTION_BIT_VECTOR_HH
 #define TTA_INSTRUCTION_BIT_VECTOR_HH
 
-#include <set>
-#include <map>
+#include <vector>
 
 #include "BitVector.hh"
 #include "Exception.hh"
@@ -46,6 +45,11 @@ namespace TTAProgram {
 
 /**
  * A bit vector class that provides instruction relocation capabilities.
+ *
+ * The references to instruction addresses are kept in flat tables that
+ * are indexed by the address of the referenced instruction in the program
+ * object model, so no per-instruction maps are needed while the image is
+ * being constructed.
  */
 class InstructionBitVector : public BitVector {
 public:
@@ -72,28 +76,36 @@ public:
 private:
     /// A vector type that stores index bounds.
     typedef std::vector<IndexBound> IndexBoundTable;
-    /// A set type that stores IndexBoundTables.
-    typedef std::set<IndexBoundTable*> IndexBoundSet;
-    /// A map type that maps Instructions to IndexBoundSets.
-    typedef std::map<const TTAProgram::Instruction*, IndexBoundSet*> 
-    ReferenceMap;
+    /// A part of the bit vector that refers to an instruction address.
+    struct Reference {
+        /// Program object model address of the referenced instruction.
+        unsigned int target;
+        /// The bits that hold the address.
+        IndexBoundTable bounds;
+    };
+    /// A vector type that stores the references.
+    typedef std::vector<Reference> ReferenceTable;
+    /// Indices to the reference table, indexed by the referenced address.
+    typedef std::vector<std::vector<unsigned int> > ReferenceIndex;
     /// A vector type that stores instruction boundaries.
     typedef std::vector<unsigned int> BoundaryTable;
-    /// A map type for instruction addresses.
-    typedef std::map<const TTAProgram::Instruction*, unsigned int>
-    InstructionAddressTable;
+    /// Memory addresses of the instructions indexed by their POM address.
+    typedef std::vector<unsigned int> InstructionAddressTable;
 
-    IndexBoundSet& indexBounds(
+    static unsigned int programAddress(
         const TTAProgram::Instruction& instruction);
-    void addIndexBoundTables(const IndexBoundSet& from, IndexBoundSet& to);
+    void addReference(const Reference& reference);
+    bool hasAddress(unsigned int target) const;
     void fixBits(const IndexBoundTable& indexes, unsigned int value);
     static unsigned int availableSize(const IndexBoundTable& indexes);
 
     /// Contains information of the parts of the bit vector that refer to
     /// an instruction address.
-    ReferenceMap references_;
-    /// IndexBoundTable being under construction.
-    IndexBoundTable* currentTable_;
+    ReferenceTable references_;
+    /// References to each instruction.
+    ReferenceIndex referencesByTarget_;
+    /// Index of the reference being under construction, -1 if none.
+    int currentReference_;
     /// Stores the instruction boundaries.
     BoundaryTable instructionBoundaries_;
     /// Addresses of the instructions.
@@ -101,5 +113,3 @@ private:
 };
 
 #endif
-
-
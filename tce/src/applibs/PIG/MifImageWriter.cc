@@ -59,16 +59,13 @@ void MifImageWriter::writeImage(std::ostream& stream) const {
     if (wordCount == 0) {
         // empty MIF is invalid, fill one row with zeroes
         stream << address << INDENT << ":" << INDENT;
-        for (int i = 0; i < rowLength(); i++) {
-            stream << "0";
-        }
-        stream << ";" << endl;
+        stream << std::string(rowLength(), '0') << ";\n";
     } else {
         bool padEndings = false;
         for (int i = 0; i < wordCount-1; i++) {
             stream << address << INDENT << ":" << INDENT;
             writeSequence(stream, rowLength(), padEndings);
-            stream << ";" << endl;
+            stream << ";\n";
             address++;
         }
         // last line might need to be padded
@@ -37,6 +37,9 @@
 #include <vector>
 #include <string>
 #include <cmath>
+#include <algorithm>
+#include <boost/thread.hpp>
+#include <boost/bind.hpp>
 
 #include "ProgramImageGenerator.hh"
 #include "AsciiProgramImageWriter.hh"
@@ -456,20 +459,23 @@ ProgramImageGenerator::generateDataImage(
                 unsigned int preferredSize =
                     ((dataBits.size() / (memWidth))+1) *
                     (memWidth);
-                while (dataBits.size() < preferredSize) {
-                    dataBits.push_back(0);
-                }
+                dataBits.resize(preferredSize);
             }
 
             for (int k = 0; k < mausPerLine/2; k++) {
                 int bitOffset0 = k * as->width();
                 int bitOffset1 = (mausPerLine-k-1) * as->width();
                 // swap bytes of one MAU.
-                for (int j = 0; j < as->width(); j++) {
-                    bool bit0 = dataBits[lineOffset+bitOffset0 + j];
-                    dataBits[lineOffset+bitOffset0+j] =
-                        dataBits[lineOffset+bitOffset1+j];
-                    dataBits[lineOffset+bitOffset1+j] = bit0;
+                for (int j = 0; j < as->width(); j += BitVector::WORD_BITS) {
+                    unsigned int width = std::min(
+                        as->width() - j, int(BitVector::WORD_BITS));
+                    unsigned int index0 = lineOffset + bitOffset0 + j;
+                    unsigned int index1 = lineOffset + bitOffset1 + j;
+                    BitVector::StorageWord bits0 =
+                        dataBits.field(index0, width);
+                    dataBits.setField(
+                        index0, dataBits.field(index1, width), width);
+                    dataBits.setField(index1, bits0, width);
                 }
             }
             lineOffset += memWidth;
@@ -500,6 +506,96 @@ ProgramImageGenerator::generateDataImage(
     delete writer;
 }
 
+/**
+ * Generates the data images of the given address spaces in parallel.
+ *
+ * The program image is generated first if a pregenerated one is not used,
+ * after which each of the data images is written by its own thread.
+ *
+ * @param programName Name of the program.
+ * @param program The program of which data images are generated.
+ * @param streams The output streams indexed by the address space names.
+ * @param format The output format.
+ * @param mausPerLine Tells how many MAUs of data is generated on one line.
+ * @param usePregeneratedImage Tells whether use the program image that was
+ *                             previously generated for relocation of data
+ *                             elements.
+ * @exception InvalidData If the image generation fails. The exception
+ *                        thrown by the first failed image is rethrown as
+ *                        it is.
+ * @exception OutOfRange If the given MAUs per line is not positive.
+ */
+void
+ProgramImageGenerator::generateDataImages(
+    const std::string& programName, TPEF::Binary& program,
+    const DataImageStreams& streams, OutputFormat format,
+    int mausPerLine, bool usePregeneratedImage) {
+
+    if (mausPerLine < 1) {
+        string errorMsg = "Data memory width in MAUs must be positive.";
+        throw OutOfRange(__FILE__, __LINE__, __func__, errorMsg);
+    }
+
+    if (!usePregeneratedImage) {
+        InstructionBitVector* programBits = compressor_->compress(programName);
+        delete programBits;
+    }
+
+    // the instruction index cache of the code section is built lazily,
+    // build it before the threads start to read it
+    for (unsigned int i = 0; i < program.sectionCount(Section::ST_CODE);
+         i++) {
+        CodeSection* codeSection = dynamic_cast<CodeSection*>(
+            program.section(Section::ST_CODE, i));
+        if (codeSection != NULL && codeSection->elementCount() > 0) {
+            codeSection->instructionCount();
+        }
+    }
+
+    std::vector<std::exception_ptr> errors(streams.size());
+    boost::thread_group workers;
+    int jobIndex = 0;
+    for (DataImageStreams::const_iterator iter = streams.begin();
+         iter != streams.end(); iter++, jobIndex++) {
+        workers.create_thread(
+            boost::bind(
+                &ProgramImageGenerator::generateDataImageJob, this,
+                boost::cref(programName), boost::ref(program),
+                boost::cref(iter->first), boost::ref(*iter->second), format,
+                mausPerLine, boost::ref(errors[jobIndex])));
+    }
+    workers.join_all();
+
+    for (std::size_t i = 0; i < errors.size(); i++) {
+        if (errors[i]) {
+            std::rethrow_exception(errors[i]);
+        }
+    }
+}
+
+/**
+ * Generates one data image, worker function of generateDataImages().
+ *
+ * Any exception is caught and stored, as it cannot propagate out of the
+ * worker thread.
+ *
+ * @param error Set to the exception thrown if the generation fails.
+ */
+void
+ProgramImageGenerator::generateDataImageJob(
+    const std::string& programName, TPEF::Binary& program,
+    const std::string& addressSpace, std::ostream& stream,
+    OutputFormat format, int mausPerLine, std::exception_ptr& error) {
+
+    try {
+        generateDataImage(
+            programName, program, addressSpace, stream, format, mausPerLine,
+            true);
+    } catch (...) {
+        error = std::current_exception();
+    }
+}
+
 void
 ProgramImageGenerator::writeDataSection(
     TPEF::Binary& program, BitVector& dataBits,
@@ -532,10 +628,14 @@ ProgramImageGenerator::writeDataSection(
         }
         
         // fill the data
+        RelocTargetMap targets = relocTargets(program, dataSection);
         Word sectionLength = dataSection.length();
         for (Word offset = 0; offset < sectionLength;) {
-            InstructionElement* relocTarget = 
-                this->relocTarget(program, dataSection, offset);
+            InstructionElement* relocTarget = NULL;
+            RelocTargetMap::const_iterator target = targets.find(offset);
+            if (target != targets.end()) {
+                relocTarget = target->second;
+            }
             if (relocTarget != NULL) {
                 Word indexOfInstruction = 
                     codeSection->indexOfInstruction(*relocTarget);
@@ -668,51 +768,47 @@ ProgramImageGenerator::createCompressor(
 }
 
 /**
- * Returns an InstructionElement that is relocation target of the data in
- * data section at the given offset. Returns NULL if the data doesn't need
- * to be altered.
+ * Returns the InstructionElements that are relocation targets of the data
+ * in the given data section.
  *
- * @param dataSection The data section,
- * @param dataSectionOffset The offset.
- * @return The InstructionElement or NULL.
+ * The data at offsets that are not in the returned map or are mapped to
+ * NULL doesn't need to be altered.
+ *
+ * @param program The program.
+ * @param dataSection The data section.
+ * @return The relocation targets indexed by the data section offset.
  */
-TPEF::InstructionElement*
-ProgramImageGenerator::relocTarget(
+ProgramImageGenerator::RelocTargetMap
+ProgramImageGenerator::relocTargets(
     const TPEF::Binary& program,
-    const TPEF::DataSection& dataSection,
-    Word dataSectionOffset) const {
+    const TPEF::DataSection& dataSection) const {
 
-    // find the correct reloc section
+    RelocTargetMap targets;
+    // find the correct reloc sections
     for (unsigned int i = 0; i < program.sectionCount(Section::ST_RELOC);
          i++) {
         RelocSection* section =  dynamic_cast<RelocSection*>(
             program.section(Section::ST_RELOC, i));
         assert(section != NULL);
-        if (section->referencedSection() == &dataSection) {
-            // correct reloc section found
-            Word elemCount = section->elementCount();
-            for (Word elemIndex = 0; elemIndex < elemCount; elemIndex++) {
-                RelocElement* relocElem = dynamic_cast<RelocElement*>(
-                    section->element(elemIndex));
-                assert(relocElem != NULL);
-                Chunk* location = dynamic_cast<Chunk*>(
-                    relocElem->location());
-                assert(location != NULL);
-                if (location->offset() == dataSectionOffset) {
-                    InstructionElement* destination = 
-                        dynamic_cast<InstructionElement*>(
-                            relocElem->destination());
-                    if (destination != NULL) {
-                        return destination;
-                    } else {
-                        return NULL;
-                    }
-                }
-            }
+        if (section->referencedSection() != &dataSection) {
+            continue;
+        }
+        Word elemCount = section->elementCount();
+        for (Word elemIndex = 0; elemIndex < elemCount; elemIndex++) {
+            RelocElement* relocElem = dynamic_cast<RelocElement*>(
+                section->element(elemIndex));
+            assert(relocElem != NULL);
+            Chunk* location = dynamic_cast<Chunk*>(relocElem->location());
+            assert(location != NULL);
+            // the first relocation of the location is the effective one
+            targets.insert(
+                std::make_pair(
+                    location->offset(),
+                    dynamic_cast<InstructionElement*>(
+                        relocElem->destination())));
         }
     }
-
-    return NULL;
+    return targets;
 }
 
 /**
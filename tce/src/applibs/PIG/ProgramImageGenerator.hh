@@ -36,7 +36,9 @@
 
 #include <iostream>
 #include <set>
+#include <map>
 #include <string>
+#include <exception>
 
 #include "CodeCompressorPlugin.hh"
 #include "BaseType.hh"
@@ -78,6 +80,8 @@ public:
         HEX  ///< HEX memory initialization format
     };
     typedef std::map<std::string, TPEF::Binary*> TPEFMap;
+    /// Output streams of data images indexed by the address space name.
+    typedef std::map<std::string, std::ostream*> DataImageStreams;
 
     ProgramImageGenerator();
     virtual ~ProgramImageGenerator();
@@ -98,6 +102,10 @@ public:
         const std::string& programName, TPEF::Binary& program,
         const std::string& addressSpace, std::ostream& stream,
         OutputFormat format, int mausPerLine, bool usePregeneratedImage);
+    void generateDataImages(
+        const std::string& programName, TPEF::Binary& program,
+        const DataImageStreams& streams, OutputFormat format,
+        int mausPerLine, bool usePregeneratedImage);
     void generateDecompressor(std::ostream& stream, TCEString entityStr);
 
     int imemMauWidth() const;
@@ -120,10 +128,16 @@ private:
 
     static CodeCompressorPlugin* createCompressor(
         const std::string& fileName, PluginTools& pluginTool);
-    TPEF::InstructionElement* relocTarget(
+    /// Relocation targets of data section elements indexed by the offset.
+    typedef std::map<Word, TPEF::InstructionElement*> RelocTargetMap;
+
+    RelocTargetMap relocTargets(
         const TPEF::Binary& program,
-        const TPEF::DataSection& dataSection,
-        Word dataSectionOffset) const;
+        const TPEF::DataSection& dataSection) const;
+    void generateDataImageJob(
+        const std::string& programName, TPEF::Binary& program,
+        const std::string& addressSpace, std::ostream& stream,
+        OutputFormat format, int mausPerLine, std::exception_ptr& error);
 
     /// The code compressor.
     CodeCompressorPlugin* compressor_;
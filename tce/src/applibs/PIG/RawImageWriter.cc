@@ -56,8 +56,21 @@ RawImageWriter::~RawImageWriter() {
  */
 void
 RawImageWriter::writeImage(std::ostream& stream) const {
-    unsigned int size = bits_.size();
-    for (unsigned int i = 0; i < size; i += 8) {
+    const std::size_t chunkBits = BitVector::WORD_BITS;
+    const std::size_t size = bits_.size();
+    std::size_t fullChunks = size / chunkBits;
+    char buffer[BitVector::WORD_BITS / 8];
+
+    // emit the image one storage word at a time
+    for (std::size_t chunk = 0; chunk < fullChunks; chunk++) {
+        BitVector::StorageWord word = bits_.field(chunk * chunkBits, chunkBits);
+        for (unsigned int i = 0; i < sizeof(buffer); i++) {
+            buffer[i] = static_cast<char>(
+                word >> (chunkBits - 8 * (i + 1)));
+        }
+        stream.write(buffer, sizeof(buffer));
+    }
+    for (std::size_t i = fullChunks * chunkBits; i < size; i += 8) {
         stream << character(bits_, i);
     }
 }
@@ -73,17 +86,12 @@ RawImageWriter::writeImage(std::ostream& stream) const {
 char
 RawImageWriter::character(const BitVector& bits, unsigned int startIndex) {
     unsigned int vectorSize = bits.size();
-    char character = 0;
-    if (bits[startIndex]) {
-        character++;
-    }
-    for (int i = 1; i < 8; i++) {
-        character = character << 1;
-        if (startIndex + i < vectorSize && bits[startIndex + i]) {
-            character++;
-        }
+    if (startIndex + 8 <= vectorSize) {
+        return static_cast<char>(bits.field(startIndex, 8));
     }
-    return character;
+    // the last byte of the image is padded with zeros
+    unsigned int width = vectorSize - startIndex;
+    return static_cast<char>(bits.field(startIndex, width) << (8 - width));
 }
             
     
@@ -84,7 +84,9 @@ BlockSourceCopier::~BlockSourceCopier() {
  *
  * This method copies the files that can and are potentially shared by
  * multiple TTAs in the same system design. That is, the FU, RF and IU
- * implementations.
+ * implementations. Files whose contents are already up to date in the
+ * destination are not rewritten, so that processors generated to the same
+ * shared directory reuse the files and their compilation results.
  *
  * @param dstDirectory The destination "root" directory.
  * @exception IOException If some file cannot be copied or HDB cannot be
@@ -123,7 +125,7 @@ BlockSourceCopier::copyShared(const std::string& dstDirectory) {
     const string DS = FileSystem::DIRECTORY_SEPARATOR;
     string sourceDir = Environment::dataDirPath("ProGe");
     // copy the utility VHDL or Verilog files
-    FileSystem::copy(
+    FileSystem::copyIfChanged(
         sourceDir + DS + ((language_==VHDL)?UTILITY_VHDL_FILE:UTILITY_VERILOG_FILE),
         dstDirectory + DS + ((language_==VHDL)?"vhdl":"verilog") + DS + ((language_==VHDL)?UTILITY_VHDL_FILE:UTILITY_VERILOG_FILE));
 }
@@ -161,7 +163,7 @@ BlockSourceCopier::copyProcessorSpecific(const std::string& dstDirectory) {
         sourceFile = implementation_.decompressorFile();
         string file = FileSystem::fileOfPath(sourceFile);
         dstFile = decompressorTargetDir + DS + file;
-        FileSystem::copy(sourceFile, dstFile);
+        FileSystem::copyIfChanged(sourceFile, dstFile);
         } else {
         sourceFile = Environment::dataDirPath("ProGe") + DS +
             ((language_==Verilog)?"idecompressor.v.tmpl":"idecompressor.vhdl.tmpl");
@@ -193,6 +195,24 @@ BlockSourceCopier::copyProcessorSpecific(const std::string& dstDirectory) {
     inst.instantiateTemplateFile(opcodesSrcFile, opcodesDstFile);
 }
 
+/**
+ * Instantiates the pipeline stage between the instruction decompressor and
+ * the instruction decoder to the given directory.
+ *
+ * The stage is needed only by processors with a pipelined instruction
+ * fetch, see NetlistGenerator::hasPipelinedFetch().
+ *
+ * @param dstDirectory The destination "root" directory.
+ * @exception IOException If the file cannot be instantiated.
+ */
+void
+BlockSourceCopier::copyInstructionPipeline(const std::string& dstDirectory) {
+    const string DS = FileSystem::DIRECTORY_SEPARATOR;
+    string srcFile = Environment::dataDirPath("ProGe") + DS +
+        ((language_==Verilog)?"ipipeline.v.tmpl":"ipipeline.vhdl.tmpl");
+    instantiateHDLTemplate(srcFile, dstDirectory + DS + "gcu_ic");
+}
+
 /**
  * Copies given template file to given directory and instantiates it, ie.
  * removes the .tmpl from the filename and converts it to .vhdl while
@@ -314,7 +334,7 @@ BlockSourceCopier::copyFiles(
             }
 
             try {
-                FileSystem::copy(absoluteFile, targetFile);
+                FileSystem::copyIfChanged(absoluteFile, targetFile);
             } catch (const Exception& e) {
                 string errorMsg = "Unable to copy file " + targetFile + ":";
                 errorMsg += e.errorMessage();
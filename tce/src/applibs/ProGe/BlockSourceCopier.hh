@@ -67,6 +67,8 @@ public:
 
     void copyProcessorSpecific(const std::string& dstDirectory);
 
+    void copyInstructionPipeline(const std::string& dstDirectory);
+
     void instantiateHDLTemplate(
         const std::string& srcFile, const std::string& dstDirectory,
         std::string newName = "0");
@@ -28,7 +28,9 @@
  */
 #include "HDLTemplateInstantiator.hh"
 #include <fstream>
+#include <sstream>
 #include "Exception.hh"
+#include "FileSystem.hh"
 
 /**
  * Creates a target HDL file from a HDL template, replacing certain magic
@@ -37,6 +39,8 @@
  * Currently supported magic strings:
  * ENTITY_STR The entity name string used to make entities unique.
  *            Same as the toplevel entity name.
+ *
+ * The target file is not rewritten if it is already up to date.
  */
 void 
 HDLTemplateInstantiator::instantiateTemplateFile(
@@ -49,12 +53,7 @@ HDLTemplateInstantiator::instantiateTemplateFile(
             __FILE__, __LINE__, __func__,
             TCEString("Could not open ") + templateFile + " for reading.");
 
-    std::ofstream output(dstFile.c_str(), std::ios::trunc);
-
-    if (!output.is_open())
-        throw UnreachableStream(
-            __FILE__, __LINE__, __func__,
-            TCEString("Could not open ") + dstFile + " for reading.");
+    std::ostringstream output;
 
     while (!input.eof()) {
         char line_buf[1024]; 
@@ -64,5 +63,12 @@ HDLTemplateInstantiator::instantiateTemplateFile(
         output << line << std::endl;
     }
     input.close();
-    output.close();
+
+    try {
+        FileSystem::writeIfChanged(dstFile, output.str());
+    } catch (const IOException&) {
+        throw UnreachableStream(
+            __FILE__, __LINE__, __func__,
+            TCEString("Could not open ") + dstFile + " for writing.");
+    }
 }
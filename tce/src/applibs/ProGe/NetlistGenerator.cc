@@ -100,6 +100,7 @@ const string PC_LOAD_PORT_NAME = "pc_load";
 const string RA_LOAD_PORT_NAME = "ra_load";
 const string PC_OPCODE_PORT_NAME = "pc_opcode";
 const string INSTRUCTIONWORD_PORT_NAME = "instructionword";
+const string INSTRUCTIONWORD_IN_PORT_NAME = "instructionword_in";
 const string GLOBAL_LOCK_PORT_NAME = "glock";
 const string LOCK_REQUEST_PORT_NAME = "lock_r";
 
@@ -109,6 +110,7 @@ const string INSTRUCTIONWIDTH = "INSTRUCTIONWIDTH";
 
 const string IFETCH_BLOCK_NAME = "ifetch";
 const string DECOMPRESSOR_BLOCK_NAME = "decompressor";
+const string IPIPELINE_BLOCK_NAME = "ipipeline";
 const string DECODER_BLOCK_NAME = "decoder";
 
 const string CALL = "CALL";
@@ -120,6 +122,10 @@ const string IU_NAME_PREFIX = "iu_";
 
 const TCEString INSTANCE_SUFFIX = "_instance";
 
+/// GCU delay slots of the transport pipeline with a pipelined instruction
+/// fetch.
+const int PIPELINED_FETCH_DELAY_SLOTS = 4;
+
 namespace ProGe {
 
 const std::string NetlistGenerator::DECODER_INSTR_WORD_PORT =
@@ -157,6 +163,23 @@ NetlistGenerator::~NetlistGenerator() {
     MapTools::deleteAllValues(rfEntryMap_);
 }
 
+/**
+ * Tells whether the generated processor has a pipelined instruction fetch.
+ *
+ * The instruction word is registered between the decompressor and the
+ * decoder if the GCU of the machine has one more delay slot than the
+ * default transport pipeline. The compiler and the simulator model the
+ * extra stage through the delay slots.
+ *
+ * @param machine The machine.
+ * @return True if the instruction fetch has the extra pipeline stage.
+ */
+bool
+NetlistGenerator::hasPipelinedFetch(const TTAMachine::Machine& machine) {
+    const ControlUnit* gcu = machine.controlUnit();
+    return gcu != NULL && gcu->delaySlots() == PIPELINED_FETCH_DELAY_SLOTS;
+}
+
 
 /**
  * Generates the netlist.
@@ -734,9 +757,42 @@ NetlistGenerator::addGCUToNetlist(
     NetlistPort* decodRstPort = new NetlistPort(
         DECODER_RESET_PORT, "1", BIT, HDB::IN, *decoderBlock);
 
-    // connect decoder to decompressor
-    netlist.connectPorts(*decIWordPort, *decodIWordPort);
-    netlist.connectPorts(*decGlockPort, *decodLockPort);
+    if (hasPipelinedFetch(machine_)) {
+        // add the pipeline stage between decompressor and decoder
+        NetlistBlock* pipelineBlock = new NetlistBlock(
+            entityNameStr_ + "_" + IPIPELINE_BLOCK_NAME, "inst_pipeline",
+            netlist);
+        toplevelBlock.addSubBlock(pipelineBlock);
+        NetlistPort* pipeLockPort = new NetlistPort(
+            LOCK_PORT_NAME, "1", BIT, HDB::IN, *pipelineBlock);
+        NetlistPort* pipeIWordInPort = new NetlistPort(
+            INSTRUCTIONWORD_IN_PORT_NAME,
+            INSTRUCTIONWIDTH, BIT_VECTOR, HDB::IN, *pipelineBlock);
+        NetlistPort* pipeIWordPort = new NetlistPort(
+            INSTRUCTIONWORD_PORT_NAME,
+            INSTRUCTIONWIDTH, BIT_VECTOR, HDB::OUT, *pipelineBlock);
+        NetlistPort* pipeGlockPort = new NetlistPort(
+            GLOBAL_LOCK_PORT_NAME, "1", BIT, HDB::OUT, *pipelineBlock);
+        NetlistPort* pipeClkPort = new NetlistPort(
+            CLOCK_PORT_NAME, "1", BIT, HDB::IN, *pipelineBlock);
+        NetlistPort* pipeRstPort = new NetlistPort(
+            RESET_PORT_NAME, "1", BIT, HDB::IN, *pipelineBlock);
+
+        netlist.connectPorts(*tlClkPort, *pipeClkPort);
+        netlist.connectPorts(*tlRstPort, *pipeRstPort);
+
+        // connect decompressor to pipeline stage
+        netlist.connectPorts(*decIWordPort, *pipeIWordInPort);
+        netlist.connectPorts(*decGlockPort, *pipeLockPort);
+
+        // connect decoder to pipeline stage
+        netlist.connectPorts(*pipeIWordPort, *decodIWordPort);
+        netlist.connectPorts(*pipeGlockPort, *decodLockPort);
+    } else {
+        // connect decoder to decompressor
+        netlist.connectPorts(*decIWordPort, *decodIWordPort);
+        netlist.connectPorts(*decGlockPort, *decodLockPort);
+    }
     netlist.connectPorts(*decLockReqPort, *decodLockReqPort);
 
     // connect decoder to top-level
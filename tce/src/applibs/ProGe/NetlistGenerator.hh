@@ -107,6 +107,8 @@ public:
     HDB::FUEntry& fuEntry(const std::string& fuName) const;
     HDB::RFEntry& rfEntry(const std::string& rfName) const;
 
+    static bool hasPipelinedFetch(const TTAMachine::Machine& machine);
+
     /// Instruction word port name in instruction decoder.
     static const std::string DECODER_INSTR_WORD_PORT;
     /// Reset port name in instruction decoder.
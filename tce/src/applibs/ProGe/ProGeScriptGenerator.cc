@@ -36,6 +36,7 @@
 #include <iostream>
 #include <vector>
 #include <list>
+#include <set>
 #include <string>
 #include <fstream>
 
@@ -191,14 +192,32 @@ ProGeScriptGenerator::generateGhdlCompile() {
     std::ofstream stream(dstFile.c_str(), std::ofstream::out);
     generateStart(stream);
 
-    stream << "rm -rf " << workDir_ << endl;
-    stream << "mkdir -p work" << endl;
+    list<string> sharedFiles;
+    list<string> processorFiles;
+    for (list<string>::const_iterator i = vhdlFiles_.begin();
+         i != vhdlFiles_.end(); ++i) {
+        if (isSharedFile(*i)) {
+            const string DS = FileSystem::DIRECTORY_SEPARATOR;
+            sharedFiles.push_back(FileSystem::absolutePathOf(
+                FileSystem::isAbsolutePath(*i) ? *i : dstDir_ + DS + *i));
+        } else {
+            processorFiles.push_back(*i);
+        }
+    }
+
+    if (!sharedFiles.empty()) {
+        generateGhdlSharedLibrary(stream, sharedFiles);
+    }
+
+    // the work library is kept so that ghdl -m analyzes only the files
+    // that have changed since the previous compilation
+    stream << "mkdir -p " << workDir_ << endl;
     stream << "rm -rf bus.dump" << endl;
     stream << "rm -rf " << testbenchName_ << endl;
 
     stream << endl;
     string program = "ghdl -i --workdir=" + workDir_;
-    outputScriptCommands(stream, vhdlFiles_, program,"");
+    outputScriptCommands(stream, processorFiles, program,"");
 
     stream << endl;
     outputScriptCommands(stream, gcuicFiles_, program,"");
@@ -214,6 +233,66 @@ ProGeScriptGenerator::generateGhdlCompile() {
     stream.close();
 }
 
+/**
+ * Generates the commands that analyze the shared HDL files with ghdl.
+ *
+ * The files in a separate shared directory do not depend on the processor,
+ * so they are analyzed only once to a library in the shared directory,
+ * and again only when some of them changes. The work library of the
+ * processor starts from a copy of the shared library, which ghdl -m then
+ * finds up to date. The scripts of the processors sharing the directory
+ * may run in parallel, so rebuilding and copying the shared library are
+ * serialized with a lock file.
+ *
+ * @param stream Stream where output is put.
+ * @param files Absolute paths of the shared files in compilation order.
+ */
+void
+ProGeScriptGenerator::generateGhdlSharedLibrary(
+    std::ostream& stream,
+    const std::list<std::string>& files) {
+
+    const string sharedWork =
+        FileSystem::absolutePathOf(sharedOutDir_) +
+        FileSystem::DIRECTORY_SEPARATOR + workDir_;
+    const string sharedLib = "${SHARED_WORK}/work-obj93.cf";
+    const string workLib = workDir_ + "/work-obj93.cf";
+
+    stream << "SHARED_WORK=" << sharedWork << endl
+           << "(" << endl
+           << "    flock 9 || exit 1" << endl
+           << "    analyze_shared=1" << endl
+           << "    if [ -e " << sharedLib << " ]; then" << endl
+           << "        analyze_shared=0" << endl
+           << "        for f in";
+    for (list<string>::const_iterator i = files.begin(); i != files.end();
+         ++i) {
+        stream << " \\" << endl << "            " << *i;
+    }
+    stream << "; do" << endl
+           << "            if [ $f -nt " << sharedLib << " ]; then" << endl
+           << "                analyze_shared=1" << endl
+           << "            fi" << endl
+           << "        done" << endl
+           << "    fi" << endl
+           << "    if [ $analyze_shared = 1 ]; then" << endl
+           << "        rm -rf ${SHARED_WORK}" << endl
+           << "        mkdir -p ${SHARED_WORK} || exit 1" << endl;
+    outputScriptCommands(
+        stream, files,
+        "        ghdl -a --workdir=${SHARED_WORK} --ieee=synopsys -fexplicit",
+        " || { rm -rf ${SHARED_WORK}; exit 1; }");
+    stream << "    fi" << endl
+           << "    if [ ! -e " << workLib << " ] || "
+           << "[ " << sharedLib << " -nt " << workLib << " ]; then" << endl
+           << "        rm -rf " << workDir_ << endl
+           << "        cp -pr ${SHARED_WORK} " << workDir_ << " || exit 1"
+           << endl
+           << "    fi" << endl
+           << ") 9> ${SHARED_WORK}.lock || exit 1" << endl
+           << endl;
+}
+
 /** 
  * Generates a script for compilation using iVerilog.
  *
@@ -610,10 +689,16 @@ ProGeScriptGenerator::fetchFiles() {
         ((language_==VHDL)?vhdlDir_:verDir_);
         
     if (sharedDir != dirName && FileSystem::fileIsDirectory(sharedDir)) {
+        list<string> sharedFiles;
         findFiles(
             vhdlRegex, 
             FileSystem::directoryContents(sharedDir, absolutePaths),
-            vhdlFiles_);
+            sharedFiles);
+        for (list<string>::const_iterator i = sharedFiles.begin();
+             i != sharedFiles.end(); ++i) {
+            sharedFiles_.insert(FileSystem::absolutePathOf(*i));
+        }
+        vhdlFiles_.splice(vhdlFiles_.end(), sharedFiles);
     }    
 
     dirName = progeOutDir_ + FileSystem::DIRECTORY_SEPARATOR + gcuicDir_;
@@ -634,6 +719,21 @@ ProGeScriptGenerator::fetchFiles() {
 }
 
 
+/**
+ * Tells whether a file of the file lists is in the shared HDL directory.
+ *
+ * @param file Name of the file relative to the destination directory.
+ * @return True if the file is one of the shared files.
+ */
+bool
+ProGeScriptGenerator::isSharedFile(const std::string& file) const {
+    string path = file;
+    if (!FileSystem::isAbsolutePath(path)) {
+        path = dstDir_ + FileSystem::DIRECTORY_SEPARATOR + path;
+    }
+    return sharedFiles_.count(FileSystem::absolutePathOf(path)) != 0;
+}
+
 /** 
  * Prepares filename lists, generally sorts them.
  */
@@ -35,6 +35,7 @@
 #define TTA_PROGE_SCRIPT_GENERATOR_HH
 
 #include <list>
+#include <set>
 #include "Exception.hh"
 #include "ProGeTypes.hh"
 
@@ -114,6 +115,10 @@ private:
         int end = -1);
     void fetchFiles();
     void prepareFiles();
+    bool isSharedFile(const std::string& file) const;
+    void generateGhdlSharedLibrary(
+        std::ostream& stream,
+        const std::list<std::string>& files);
     
     // destination directory where scripts are generated.
     std::string dstDir_;
@@ -128,6 +133,8 @@ private:
     std::list<std::string> vhdlFiles_;
     std::list<std::string> gcuicFiles_;
     std::list<std::string> testBenchFiles_;
+    // absolute paths of the files in the separate shared HDL directory
+    std::set<std::string> sharedFiles_;
 
     // directory used by ghdl/modelsim as work directory when compiling
     const std::string workDir_;
@@ -41,6 +41,9 @@
 #include <fstream>
 #include <algorithm>
 #include <boost/format.hpp>
+#include <boost/scoped_ptr.hpp>
+#include <boost/thread.hpp>
+#include <boost/bind.hpp>
 
 #include "NetlistBlock.hh"
 #include "NetlistPort.hh"
@@ -105,6 +108,12 @@ ProcessorGenerator::~ProcessorGenerator() {
 /**
  * Generates the processor.
  *
+ * The output files are written by independent jobs that run in parallel.
+ * The IC/decoder plugin may add ports to the netlist, so the netlist is
+ * written only after the plugin has finished. The processor specific
+ * sources are copied after the plugin too, as the plugin may have written
+ * its own instruction fetch unit which must not be overwritten.
+ *
  * @see ProGeUI::generateProcessor()
  */
 void
@@ -140,22 +149,19 @@ ProcessorGenerator::generateProcessor(
         throw IOException(__FILE__, __LINE__, __func__, errorMsg);
     }
 
-    NetlistWriter* writer;
+    boost::scoped_ptr<NetlistWriter> writer;
     string topLevelDir = "";
 
     if (language == ProGe::VHDL) {
-        writer = new VHDLNetlistWriter(*netlist_);
+        writer.reset(new VHDLNetlistWriter(*netlist_));
         topLevelDir = dstDirectory + FileSystem::DIRECTORY_SEPARATOR +"vhdl";
     } else
     if (language == ProGe::Verilog) {
-        writer = new VerilogNetlistWriter(*netlist_);
+        writer.reset(new VerilogNetlistWriter(*netlist_));
         topLevelDir = dstDirectory + FileSystem::DIRECTORY_SEPARATOR +"verilog";
     } else {
         assert(false);
     }
-    
-    plugin.generate(language, pluginDstDir, netlistGenerator, implementation,
-        entityStr_);
 
     if (!FileSystem::fileExists(topLevelDir)) {
         bool directoryCreated = FileSystem::createDirectory(topLevelDir);
@@ -166,10 +172,6 @@ ProcessorGenerator::generateProcessor(
         }
     }
 
-    writer->write(topLevelDir);
-    delete writer;
-    writer = NULL;
-
     if (!FileSystem::fileExists(sharedDstDirectory)) {
         bool directoryCreated = 
             FileSystem::createDirectory(sharedDstDirectory);
@@ -180,12 +182,94 @@ ProcessorGenerator::generateProcessor(
         }
     }
 
+    // the search paths are read lazily, read them before the jobs start
+    Environment::initialize();
+
     BlockSourceCopier copier(implementation, entityStr_,language);
-    copier.copyShared(sharedDstDirectory);
-    copier.copyProcessorSpecific(dstDirectory);
 
-    generateGlobalsPackage(language,
-    machine, plugin.bem(), imemWidthInMAUs, topLevelDir);
+    EmissionJobs jobs;
+    jobs.push_back(
+        boost::bind(
+            &ICDecoderGeneratorPlugin::generate, boost::ref(plugin),
+            language, boost::cref(pluginDstDir),
+            boost::cref(netlistGenerator), boost::cref(implementation),
+            boost::cref(entityStr_)));
+    jobs.push_back(
+        boost::bind(
+            &BlockSourceCopier::copyShared, &copier,
+            boost::cref(sharedDstDirectory)));
+    jobs.push_back(
+        boost::bind(
+            &ProcessorGenerator::generateGlobalsPackage, this, language,
+            boost::cref(machine), boost::cref(plugin.bem()),
+            imemWidthInMAUs, boost::cref(topLevelDir)));
+    runEmissionJobs(jobs);
+
+    // these depend on the output of the IC/decoder plugin
+    jobs.clear();
+    jobs.push_back(
+        boost::bind(
+            &NetlistWriter::write, writer.get(), boost::cref(topLevelDir)));
+    jobs.push_back(
+        boost::bind(
+            &BlockSourceCopier::copyProcessorSpecific, &copier,
+            boost::cref(dstDirectory)));
+    if (NetlistGenerator::hasPipelinedFetch(machine)) {
+        jobs.push_back(
+            boost::bind(
+                &BlockSourceCopier::copyInstructionPipeline, &copier,
+                boost::cref(dstDirectory)));
+    }
+    runEmissionJobs(jobs);
+}
+
+/**
+ * Runs the given output file emission jobs in parallel.
+ *
+ * Each job is run in its own thread. Returns after all the jobs have
+ * finished.
+ *
+ * @param jobs The jobs to run.
+ * @exception Exception If any of the jobs failed. The exception thrown by
+ *                      the first failed job is rethrown as it is.
+ */
+void
+ProcessorGenerator::runEmissionJobs(const EmissionJobs& jobs) {
+    std::vector<std::exception_ptr> errors(jobs.size());
+    boost::thread_group workers;
+    for (std::size_t i = 0; i < jobs.size(); i++) {
+        workers.create_thread(
+            boost::bind(
+                &ProcessorGenerator::emissionJob, jobs[i],
+                boost::ref(errors[i])));
+    }
+    workers.join_all();
+
+    for (std::size_t i = 0; i < errors.size(); i++) {
+        if (errors[i]) {
+            std::rethrow_exception(errors[i]);
+        }
+    }
+}
+
+/**
+ * Runs one output file emission job, worker function of runEmissionJobs().
+ *
+ * Any exception thrown by the job is caught and stored, as it cannot
+ * propagate out of the worker thread.
+ *
+ * @param job The job.
+ * @param error Set to the exception thrown by the job if it fails.
+ */
+void
+ProcessorGenerator::emissionJob(
+    const boost::function<void()>& job, std::exception_ptr& error) {
+
+    try {
+        job();
+    } catch (...) {
+        error = std::current_exception();
+    }
 }
 
 /**
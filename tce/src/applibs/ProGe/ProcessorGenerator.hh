@@ -36,6 +36,10 @@
 #ifndef TTA_PROCESSOR_GENERATOR_HH
 #define TTA_PROCESSOR_GENERATOR_HH
 
+#include <vector>
+#include <exception>
+#include <boost/function.hpp>
+
 #include "ProGeTypes.hh"
 #include "Exception.hh"
 #include "TCEString.hh"
@@ -87,6 +91,12 @@ public:
         std::ostream& warningStream);
 
 private:
+    /// Jobs that write independent output files.
+    typedef std::vector<boost::function<void()> > EmissionJobs;
+
+    static void runEmissionJobs(const EmissionJobs& jobs);
+    static void emissionJob(
+        const boost::function<void()>& job, std::exception_ptr& error);
     void validateMachine(
         const TTAMachine::Machine& machine, std::ostream& errorStream,
         std::ostream& warningStream);
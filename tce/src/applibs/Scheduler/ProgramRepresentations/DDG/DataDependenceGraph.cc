@@ -59,6 +59,7 @@
 #include "Terminal.hh"
 #include "BasicBlock.hh"
 #include "Operation.hh"
+#include "OperationPool.hh"
 #include "Move.hh"
 
 /**
@@ -308,7 +309,8 @@ int DataDependenceGraph::edgeLatency(const DataDependenceEdge& edge,
                 tail = &tailNode(edge);
             }
             if (tail->inSameOperation(*head)) {
-                latency = getOperationLatency(edge.data());
+                latency = getOperationLatency(
+                    head->sourceOperation().operation());
             }
         }
     } else if (edge.dependenceType() == DataDependenceEdge::DEP_WAR) {
@@ -402,7 +404,8 @@ DataDependenceGraph::earliestCycle(
                 /// when EWH_REAL is used.
                 if (edge.edgeReason() == DataDependenceEdge::EDGE_OPERATION &&
                     moveNode.isSourceOperation() && tail.inSameOperation(moveNode)) {
-                    effTailCycle += getOperationLatency(edge.data());
+                    effTailCycle += getOperationLatency(
+                        moveNode.sourceOperation().operation());
                 } else if (edge.dependenceType() == DataDependenceEdge::DEP_WAW) {
 
                     // ignore reg antidep? then skip over this edge.
@@ -578,7 +581,7 @@ DataDependenceGraph::latestCycle(
                                 DataDependenceEdge::EDGE_OPERATION &&
                                 moveNode.isDestinationOperation() &&
                                 head.inSameOperation(moveNode)) {
-                                latency = getOperationLatency(edge.data());
+                                latency = operationEdgeLatency(edge, head);
                             }
                         }
                         // in case of RAW, value must be written latency
@@ -2640,7 +2643,7 @@ DataDependenceGraph::edgeWeight(
     
     switch (e.edgeReason()) {
     case DataDependenceEdge::EDGE_OPERATION: {
-        return getOperationLatency(e.data());
+        return operationEdgeLatency(e, n);
     }
     case DataDependenceEdge::EDGE_MEMORY: {
         if (e.dependenceType() == DataDependenceEdge::DEP_RAW) {
@@ -2722,11 +2725,14 @@ DataDependenceGraph::setMachine(const TTAMachine::Machine& machine) {
         for (int j = 0; j < fu->operationCount(); j++) {
             TTAMachine::HWOperation* hwop = fu->operation(j);
             int latency = hwop->latency();
-            TCEString name = StringTools::stringToUpper(hwop->name());
+            unsigned int id = OperationPool::operationID(hwop->name().c_str());
+            if (id >= operationLatencies_.size()) {
+                operationLatencies_.resize(id + 1, -1);
+            }
             // if does not exist or is existing is bigger update
-            if (!AssocTools::containsKey(operationLatencies_, name)
-                || latency < operationLatencies_[name]) {
-                operationLatencies_[name] = latency;
+            if (operationLatencies_[id] == -1
+                || latency < operationLatencies_[id]) {
+                operationLatencies_[id] = latency;
             }
         }
     }
@@ -2850,15 +2856,50 @@ DataDependenceGraph::successorsReady(MoveNode& node) const {
  */
 int 
 DataDependenceGraph::getOperationLatency(const TCEString& name) const {
-    std::map<TCEString, int>::const_iterator iter =
-        operationLatencies_.find(name);
-    if (iter != operationLatencies_.end()) {
-        return iter->second;
+    unsigned int id = OperationPool::operationID(name.c_str());
+    if (id < operationLatencies_.size() && operationLatencies_[id] != -1) {
+        return operationLatencies_[id];
     } else {
         return 1;
     }
 }
 
+/**
+ * Gets the lowest instruction latency for given operation.
+ *
+ * @param op operation whose minimum latency is being searched
+ * @return minimum latency of given operation.
+ */
+int
+DataDependenceGraph::getOperationLatency(const Operation& op) const {
+    if (op.id() < operationLatencies_.size() &&
+        operationLatencies_[op.id()] != -1) {
+        return operationLatencies_[op.id()];
+    } else {
+        return 1;
+    }
+}
+
+/**
+ * Returns the latency of an operation edge.
+ *
+ * The operation is taken from the head node when it is the result of the
+ * operation, so that the name of the edge need not be looked up.
+ *
+ * @param edge operation edge
+ * @param head head node of the edge
+ * @return minimum latency of the operation of the edge.
+ */
+int
+DataDependenceGraph::operationEdgeLatency(
+    const DataDependenceEdge& edge, const MoveNode& head) const {
+    if (head.isSourceOperation()) {
+        return getOperationLatency(head.sourceOperation().operation());
+    } else {
+        return getOperationLatency(edge.data());
+    }
+}
+
 /**
  * Checks if the graph already has an edge with same properties from same
  * node to same node.
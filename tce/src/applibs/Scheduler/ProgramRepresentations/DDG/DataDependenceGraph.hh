@@ -52,6 +52,7 @@ class BasicBlockNode;
 class DataGraphBuilder;
 class ControlFlowGraph;
 class MoveNodeUse;
+class Operation;
 struct LiveRange;
 
 namespace TTAMachine {
@@ -395,6 +396,9 @@ private:
         const DataDependenceEdge& edge) const;
     
     int getOperationLatency(const TCEString& name) const;
+    int getOperationLatency(const Operation& op) const;
+    int operationEdgeLatency(
+        const DataDependenceEdge& edge, const MoveNode& head) const;
 
     std::set<TCEString> allParamRegs_;
 
@@ -416,7 +420,8 @@ private:
     // Machine related variables. 
     const TTAMachine::Machine* machine_;
     int delaySlots_;
-    std::map<TCEString, int> operationLatencies_;
+    /// The minimum latencies indexed by operation IDs, -1 if not known.
+    std::vector<int> operationLatencies_;
 
     BasicBlockNode* ownedBBN_;
     bool procedureDDG_;
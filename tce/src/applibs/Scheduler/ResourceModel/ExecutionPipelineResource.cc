@@ -266,7 +266,7 @@ ExecutionPipelineResource::setResultWriten(
     const ProgramOperation& po, unsigned int triggerCycle) {
 
     const Operation& op = po.operation();
-    TTAMachine::HWOperation& hwop = *fu_.operation(op.name());
+    TTAMachine::HWOperation& hwop = resources->hwOperation(op);
 
     // Loops over all output values produced by this 
     for (int i = 0; i < op.numberOfOutputs(); i++) {
@@ -283,7 +283,7 @@ ExecutionPipelineResource::setOperandsUsed(
     const ProgramOperation& po, unsigned int triggerCycle) {
 
     const Operation& op = po.operation();
-    TTAMachine::HWOperation& hwop = *fu_.operation(op.name());
+    TTAMachine::HWOperation& hwop = resources->hwOperation(op);
 
     // Loops over all output values produced by this 
     for (int i = 0; i < op.numberOfInputs(); i++) {
@@ -360,7 +360,7 @@ ExecutionPipelineResource::unsetResultWriten(
     const ProgramOperation& po, unsigned int triggerCycle) {
 
     const Operation& op = po.operation();
-    TTAMachine::HWOperation& hwop = *fu_.operation(op.name());
+    TTAMachine::HWOperation& hwop = resources->hwOperation(op);
 
     // Loops over all output values produced by this 
     for (int i = 0; i < op.numberOfOutputs(); i++) {
@@ -377,7 +377,7 @@ ExecutionPipelineResource::unsetOperandsUsed(
     const ProgramOperation& po, unsigned int triggerCycle) {
 
     const Operation& op = po.operation();
-    TTAMachine::HWOperation& hwop = *fu_.operation(op.name());
+    TTAMachine::HWOperation& hwop = resources->hwOperation(op);
 
     // Loops over all output values produced by this 
     for (int i = 0; i < op.numberOfInputs(); i++) {
@@ -498,8 +498,6 @@ ExecutionPipelineResource::assignDestination(
 
     int modCycle = instructionIndex(cycle);
 
-    std::string opName = "";
-
     //TODO: is this correct trigger or UM trigger?
     if (node.move().destination().isTriggering()) {
 #ifdef DEBUG_RM
@@ -508,14 +506,13 @@ ExecutionPipelineResource::assignDestination(
         assert(node.destinationOperationCount() == 1);
 
         ProgramOperation& pOp = node.destinationOperation();
-        if (node.move().destination().isOpcodeSetting()) {
-            opName = node.move().destination().operation().name();
-        } else {
+        if (!node.move().destination().isOpcodeSetting()) {
             std::string msg = "Using non opcodeSetting triggering move. ";
             msg += " Move: " + node.toString();
             throw ModuleRunTimeError(__FILE__, __LINE__, __func__, msg);
         }
-        int pIndex = resources->operationIndex(opName);
+        int pIndex = resources->operationIndex(
+            node.move().destination().operation());
         for (unsigned int i = 0; i < resources->maximalLatency(); i++) {
             int modic = instructionIndex(cycle+i);
             // then we can insert the resource usage.
@@ -730,15 +727,15 @@ ExecutionPipelineResource::unassignDestination(
     unsetOperandsUsed(node.destinationOperation(), cycle);        
     unsetResultWriten(node.destinationOperation(), cycle);
     
-    std::string opName = "";
+    const Operation* op = NULL;
     if (node.move().destination().isOpcodeSetting()) {
-        opName = node.move().destination().operation().name();
+        op = &node.move().destination().operation();
     } else {
-        opName = node.move().destination().hintOperation().name();
+        op = &node.move().destination().hintOperation();
     }
-    if (!resources->hasOperation(opName)) {
+    if (!resources->hasOperation(*op)) {
         std::string msg = "Trying to unassign operation \'";
-        msg += opName ;
+        msg += op->name();
         msg += "\' not supported on FU!";
         throw ModuleRunTimeError(__FILE__, __LINE__, __func__, msg);
     }
@@ -766,7 +763,7 @@ ExecutionPipelineResource::unassignDestination(
                 fuExecutionPipeline_[modic][j];
             if (rr.first == &node) {
                 assert(resources->operationPipeline(
-                           resources->operationIndex(opName),i,j) &&
+                           resources->operationIndex(*op),i,j) &&
                        "unassigning pipeline res not used by this op");
                 
                 rr.first = rr.second;
@@ -774,7 +771,7 @@ ExecutionPipelineResource::unassignDestination(
             } else {
                 if (rr.second == &node) {
                     assert(resources->operationPipeline(
-                               resources->operationIndex(opName),i,j) &&
+                               resources->operationIndex(*op),i,j) &&
                            "unassigning pipeline res not used by this op");
                     
                     rr.second = NULL;
@@ -831,7 +828,7 @@ ExecutionPipelineResource::canAssignSource(
     outputIndex = node.move().source().operationIndex();
 
     const TTAMachine::HWOperation& hwop =
-        *fu_.operation(po->operation().name());
+        resources->hwOperation(po->operation());
 
     if (initiationInterval_ != 0 && 
         hwop.latency(outputIndex) > (int)initiationInterval_) {
@@ -995,7 +992,7 @@ ExecutionPipelineResource::canAssignDestination(
     }
 
     const TTAMachine::HWOperation& hwop = 
-        *fu_.operation(pOp->operation().name());
+        resources->hwOperation(pOp->operation());
     TTAMachine::FUPort& port =
         *hwop.port(newNode->move().destination().operationIndex());                   
 
@@ -1128,7 +1125,7 @@ bool ExecutionPipelineResource::operandOverwritten(
               << operandWriteCycle << " tc: " << triggerCycle << std::endl;
 #endif
     const Operation& op = po.operation();
-    TTAMachine::HWOperation& hwop = *fu_.operation(op.name());
+    TTAMachine::HWOperation& hwop = resources->hwOperation(op);
 
     int opIndex = operand.move().destination().operationIndex();
     const TTAMachine::Port& port = *hwop.port(opIndex);
@@ -1216,23 +1213,23 @@ bool ExecutionPipelineResource::resourcesAllowTrigger(
     }
 
     int modCycle = instructionIndex(cycle);
-    std::string opName = "";
+    const Operation* op = NULL;
     if (node.move().destination().isOpcodeSetting()) {
-        opName = node.move().destination().operation().name();
-//        debugLogRM(opName);
+        op = &node.move().destination().operation();
+//        debugLogRM(op->name());
     } else {
         // If target architecture has different opcode setting port
         // as universal machine, pick  a name of operation from a hint
-        opName = node.move().destination().hintOperation().name();
+        op = &node.move().destination().hintOperation();
     }
     
-    if (!resources->hasOperation(opName)) {
+    if (!resources->hasOperation(*op)) {
         // Operation no supported by FU
-//        debugLogRM(opName + " not supported by the FU!");
+//        debugLogRM(op->name() + " not supported by the FU!");
         return false;
     }
     
-    int pIndex = resources->operationIndex(opName);
+    int pIndex = resources->operationIndex(*op);
     
     bool canAssign = true;
 
@@ -1644,7 +1641,7 @@ int ExecutionPipelineResource::resultReadyCycle(
     }
 
     const Operation& op = po.operation();
-    TTAMachine::HWOperation& hwop = *fu_.operation(po.operation().name());
+    TTAMachine::HWOperation& hwop = resources->hwOperation(po.operation());
     for (int i = 0; i < op.numberOfOutputs(); i++) {
         int outIndex = op.numberOfInputs() + 1 + i;
         const TTAMachine::Port *p = hwop.port(outIndex);
@@ -1740,7 +1737,7 @@ ExecutionPipelineResource::testTriggerResult(
     const MoveNode& trigger, int cycle) const {
     ProgramOperation& po = trigger.destinationOperation();
     const Operation& op = po.operation();
-    TTAMachine::HWOperation& hwop = *fu_.operation(op.name());
+    TTAMachine::HWOperation& hwop = resources->hwOperation(op);
 
     // Loops over all output values produced by this 
     for (int i = 0; i < op.numberOfOutputs(); i++) {
@@ -1930,7 +1927,7 @@ ExecutionPipelineResource::resultPort(const MoveNode& mn) const {
     assert(mn.isSourceOperation());
     const ProgramOperation& po = mn.sourceOperation();
     const TTAMachine::HWOperation& hwop =
-        *fu_.operation(po.operation().name());
+        resources->hwOperation(po.operation());
     return *hwop.port(mn.move().source().operationIndex());
 }
 
@@ -1942,7 +1939,7 @@ ExecutionPipelineResource::operandPort(const MoveNode& mn) const {
     assert(mn.isDestinationOperation());
     const ProgramOperation& po = mn.destinationOperation();
     const TTAMachine::HWOperation& hwop = 
-        *fu_.operation(po.operation().name());
+        resources->hwOperation(po.operation());
     return *hwop.port(mn.move().destination().operationIndex());
 }
 
@@ -2204,7 +2201,7 @@ bool ExecutionPipelineResource::operandTooLate(const MoveNode& mn, int cycle) co
         }
 
         const Operation& op = po.operation();
-        TTAMachine::HWOperation& hwop = *fu_.operation(op.name());
+        TTAMachine::HWOperation& hwop = resources->hwOperation(op);
 
         int opIndex = mn.move().destination().operationIndex();
         int slack = hwop.slack(opIndex);
@@ -2228,7 +2225,7 @@ bool ExecutionPipelineResource::operandTooLate(const MoveNode& mn, int cycle) co
 bool ExecutionPipelineResource::triggerTooEarly(const MoveNode& trigger, int cycle) const {
     ProgramOperation& po = trigger.destinationOperation(0);
     const Operation& op = po.operation();
-    TTAMachine::HWOperation& hwop = *fu_.operation(op.name());
+    TTAMachine::HWOperation& hwop = resources->hwOperation(op);
     for (int i = 0; i < po.inputMoveCount(); i++) {
         MoveNode& mn = po.inputMove(i);
 #ifdef DEBUG_RM
@@ -2403,7 +2400,7 @@ bool ExecutionPipelineResource::resultCausesTriggerBetweenOperandSharing(
     }
     const int outputIndex = mn.move().source().operationIndex();
     const TTAMachine::HWOperation& hwop =
-        *fu_.operation(po.operation().name());
+        resources->hwOperation(po.operation());
     const TTAMachine::Port* outPort = hwop.port(outputIndex);
     int latency = hwop.latency(outputIndex);
     int latestTriggerCycle = cycle - latency;
@@ -2481,7 +2478,7 @@ bool ExecutionPipelineResource::resultCausesTriggerBetweenOperandSharing(
             const int inputIndex =
                 inMove.move().destination().operationIndex();
             const TTAMachine::HWOperation& hwop =
-                *fu_.operation(po.operation().name());
+                resources->hwOperation(po.operation());
             auto inPort = hwop.port(inputIndex);
             if (!inPort->isTriggering()) {
                 if (!operandAllowedAtCycle(*inPort, inMove,c)) {
@@ -2538,7 +2535,7 @@ bool ExecutionPipelineResource::operandSharePreventsTriggerForScheduledResult(
 
             const int outputIndex = outMove.move().source().operationIndex();
             const TTAMachine::HWOperation& hwop =
-                *fu_.operation(po.operation().name());
+                resources->hwOperation(po.operation());
             int latency = hwop.latency(outputIndex);
             auto outPort = hwop.port(outputIndex);
             auto outPortIter = myResultCycles.find(outPort);
@@ -2643,7 +2640,7 @@ bool ExecutionPipelineResource::operandSharePreventsTriggerForScheduledResult(
                 MoveNode* trigger = rh1.po->triggeringMove();
                 if (poConflictsWithInputPort(port, *rh1.po, mn)) {
                     const TTAMachine::HWOperation& hwop =
-                        *fu_.operation(rh1.po->operation().name());
+                        resources->hwOperation(rh1.po->operation());
                     int outIndex = hwop.io(*p.first);
                     int latency = hwop.latency(outIndex);
                     int otherTriggerCycle = rc - latency;
@@ -2679,7 +2676,7 @@ bool ExecutionPipelineResource::operandSharePreventsTriggerForScheduledResult(
 
                 if (poConflictsWithInputPort(port, *rh2.po, mn)) {
                     const TTAMachine::HWOperation& hwop =
-                        *fu_.operation(rh2.po->operation().name());
+                        resources->hwOperation(rh2.po->operation());
                     int outIndex = hwop.io(*p.first);
                     int latency = hwop.latency(outIndex);
                     int otherTriggerCycle = rc - latency;
@@ -2716,7 +2713,7 @@ const MoveNode* ExecutionPipelineResource::nodeOfInputPort(
     const ProgramOperation& po, TTAMachine::Port& port) {
 
     const Operation& op = po.operation();
-    auto hwop = fu_.operation(op.name());
+    auto hwop = &resources->hwOperation(op);
     if (!hwop->isBound(static_cast<TTAMachine::FUPort&>(port))) {
         return nullptr;
     }
@@ -35,6 +35,7 @@
 #include "ExecutionPipelineResourceTable.hh"
 #include "FunctionUnit.hh"
 #include "HWOperation.hh"
+#include "OperationPool.hh"
 #include "ExecutionPipeline.hh"
 #include "PipelineElement.hh"
 
@@ -56,25 +57,29 @@ ExecutionPipelineResourceTable::ExecutionPipelineResourceTable(
     for (int j = 0; j < fu.operationCount(); j++) {
         HWOperation& hwop = *fu.operation(j);
         ExecutionPipeline* ep = hwop.pipeline();
-        std::string opName = StringTools::stringToUpper(
-            fu.operation(j)->name());
+        unsigned int opID = OperationPool::operationID(
+            hwop.name().c_str());
+        if (opID >= hwOperations_.size()) {
+            hwOperations_.resize(opID + 1, NULL);
+        }
+        hwOperations_[opID] = &hwop;
 
         for (int l = 0; l < ep->latency(); l++ ) {
             for (int k = 0; k < fu.pipelineElementCount(); k++) {
                 PipelineElement *pe = fu.pipelineElement(k);
                 if (ep->isResourceUsed(pe->name(),l)){
-                    setResourceUse(opName, l, k);
+                    setResourceUse(opID, l, k);
                 }
             }
             for (int k = 0; k < fu.operationPortCount(); k++) {
                 TTAMachine::FUPort* fuPort = fu.operationPort(k);
                 if (ep->isPortWritten(*fuPort,l)) {
                     setResourceUse(
-                        opName, l,fu.pipelineElementCount()+k);
+                        opID, l, fu.pipelineElementCount()+k);
                 }
                 if (ep->isPortRead(*fuPort,l)) {
                     setResourceUse(
-                        opName, -1, fu.pipelineElementCount()+k);
+                        opID, -1, fu.pipelineElementCount()+k);
                 }
             }
         }
@@ -85,7 +90,7 @@ ExecutionPipelineResourceTable::ExecutionPipelineResourceTable(
                  writes.begin(); iter != writes.end(); iter++) {
             int index = *iter;
             int latency = hwop.latency(index);
-            setLatency(opName, index, latency);
+            setLatency(opID, index, latency);
         }
     }
 }
@@ -94,13 +99,13 @@ ExecutionPipelineResourceTable::ExecutionPipelineResourceTable(
  * Sets usage of resource/port to true for given cycle and resource number
  * and particular pipeline.
  *
- * @param opName Name of operation to set resource for
+ * @param opID ID of operation to set resource for
  * @param cycle Cycle in which to set usage
  * @param index Index of resource/port in resource vector
  */
 void
 ExecutionPipelineResourceTable::setResourceUse(
-    const std::string& opName,
+    unsigned int opID,
     const int cycle,
     const int resIndex) {
 
@@ -115,13 +120,7 @@ ExecutionPipelineResourceTable::setResourceUse(
             "FU pipeline!");
     }
 
-    if (!MapTools::containsKey(operationSupported_, opName)) {
-        ResourceTable newOp(
-            maximalLatency_, std::vector<bool>(numberOfResources_, false));
-        operationPipelines_.push_back(newOp);
-        operationSupported_[opName] = operationPipelines_.size() - 1;
-    }
-    int pIndex = MapTools::valueForKey<int>(operationSupported_, opName);
+    int pIndex = pipelineIndex(opID, numberOfResources_);
     if(cycle > -1) {
         operationPipelines_[pIndex][cycle][resIndex] = true;
     }
@@ -130,30 +129,48 @@ ExecutionPipelineResourceTable::setResourceUse(
 /**
  * Sets latency of an output of an operation.
  * The resource usage of the operation has to be set before calling this.
- * @param opName operation to set the latency
+ * @param opID ID of the operation to set the latency
  * @param output index of the output operand(stating from
  *               numberofinputoperand, not 0/1)
  * @param latency latency of the output of the operation
  */
 void
 ExecutionPipelineResourceTable::setLatency(
-    const std::string& opName,
+    unsigned int opID,
     const int output,
     const int latency) {
 
-    if (!MapTools::containsKey(operationSupported_, opName)) {
-        ResourceTable newOp(maximalLatency_, std::vector<bool>(0, false));
-        operationPipelines_.push_back(newOp);
-        operationSupported_[opName] = operationPipelines_.size() - 1;
-    }
-
-    int pIndex = MapTools::valueForKey<int>(operationSupported_, opName);
+    int pIndex = pipelineIndex(opID, 0);
     while (static_cast<int>(operationLatencies_.size()) <= pIndex) {
         operationLatencies_.push_back(std::map<int,int>());
     }
     operationLatencies_[pIndex][output] = latency;
 }
 
+/**
+ * Returns the index of the pipeline of an operation, adding an empty
+ * pipeline for the operation if it does not have one yet.
+ *
+ * @param opID ID of the operation.
+ * @param resourceCount Count of resources in each cycle of a new pipeline.
+ * @return Index of the pipeline of the operation.
+ */
+int
+ExecutionPipelineResourceTable::pipelineIndex(
+    unsigned int opID, int resourceCount) {
+
+    if (opID >= operationSupported_.size()) {
+        operationSupported_.resize(opID + 1, -1);
+    }
+    if (operationSupported_[opID] == -1) {
+        ResourceTable newOp(
+            maximalLatency_, std::vector<bool>(resourceCount, false));
+        operationPipelines_.push_back(newOp);
+        operationSupported_[opID] = operationPipelines_.size() - 1;
+    }
+    return operationSupported_[opID];
+}
+
 /**
  * Gives an resource table for given FU. 
  * If no existing found, creates a new one.
@@ -183,7 +200,11 @@ ExecutionPipelineResourceTable::resourceTable(
  */
 void
 ExecutionPipelineResourceTable::finalize() {
-    MapTools::deleteAllValues(allResourceTables_);
+    for (ResourceTableMap::iterator i = allResourceTables_.begin();
+         i != allResourceTables_.end(); i++) {
+        delete i->second;
+    }
+    allResourceTables_.clear();
 }
 
 ExecutionPipelineResourceTable::ResourceTableMap 
@@ -39,8 +39,11 @@
 
 namespace TTAMachine {
     class FunctionUnit;
+    class HWOperation;
 }
 
+class Operation;
+
 class ExecutionPipelineResourceTable {
 public:
     inline unsigned int numberOfResources() const;
@@ -49,9 +52,11 @@ public:
 
     inline bool operationPipeline(int op, int cycle, int res) const;
 
-    inline int operationIndex(const std::string& opName) const;
+    inline int operationIndex(const Operation& op) const;
+
+    inline bool hasOperation(const Operation& op) const;
 
-    inline bool hasOperation(const std::string& opName) const;
+    inline TTAMachine::HWOperation& hwOperation(const Operation& op) const;
 
     inline const std::map<int,int>& operationLatency(
         unsigned int operationIndex) const;
@@ -64,23 +69,25 @@ public:
 
     static void finalize();
 private:
+    /// Type for resource vector, represents one cycle of use
+    typedef std::vector<bool> ResourceVector;
+
+    /// Type for resource reservation table, resource vector x latency
+    typedef std::vector<ResourceVector> ResourceTable;
+
     ExecutionPipelineResourceTable(const TTAMachine::FunctionUnit& fu);
 
     void setLatency(
-        const std::string& opName,
+        unsigned int opID,
         const int output,
         const int latency);
 
     void setResourceUse(
-        const std::string& opName, const int cycle, const int resIndex);
+        unsigned int opID, const int cycle, const int resIndex);
 
-    std::string name_;
-
-    /// Type for resource vector, represents one cycle of use
-    typedef std::vector<bool> ResourceVector;
+    int pipelineIndex(unsigned int opID, int resourceCount);
 
-    /// Type for resource reservation table, resource vector x latency
-    typedef std::vector<ResourceVector> ResourceTable;
+    std::string name_;
 
     typedef std::map<const TTAMachine::FunctionUnit*, 
                      ExecutionPipelineResourceTable*> ResourceTableMap;
@@ -89,8 +96,11 @@ private:
     int numberOfResources_;
     /// Maximal latency of operation in FU
     unsigned int maximalLatency_;
-    /// Operations supported, name - index to operation pipeline vector
-    std::map<std::string, int> operationSupported_;
+    /// Index to operation pipeline vector for each operation ID, -1 for
+    /// the operations not supported
+    std::vector<int> operationSupported_;
+    /// The hardware operations of the FU indexed by the operation IDs
+    std::vector<TTAMachine::HWOperation*> hwOperations_;
     // latencies of all operations supported by this FU.
     std::vector<std::map<int,int> > operationLatencies_;
     /// Pipelines for operations
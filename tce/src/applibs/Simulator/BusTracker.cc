@@ -32,6 +32,7 @@
  */
 
 #include "BusTracker.hh"
+#include "BinaryTraceWriter.hh"
 #include "Application.hh"
 #include "SimulationController.hh"
 #include "SimulatorToolbox.hh"
@@ -39,6 +40,7 @@
 #include "SimulatorFrontend.hh"
 #include "MachineState.hh"
 #include "Machine.hh"
+#include "Segment.hh"
 #include "MathTools.hh"
 #include "Conversion.hh"
 
@@ -62,12 +64,42 @@ const std::string BusTracker::COLUMN_SEPARATOR = ",";
 BusTracker::BusTracker(
     SimulatorFrontend& frontend, 
     std::ostream& traceStream) :
-    Listener(), frontend_(frontend), traceStream_(traceStream) {
+    Listener(), frontend_(frontend), traceStream_(&traceStream),
+    binaryTrace_(NULL) {
     // write the trace data at the end of simulation clock cycle
     frontend.eventHandler().registerListener(
         SimulationEventHandler::SE_CYCLE_END, this);
 }
 
+/**
+ * Constructor.
+ *
+ * The bus activity is stored with the name of the first segment of
+ * each bus.
+ *
+ * @param frontend The SimulationFrontend which is used to access simulation 
+ *                 data.
+ * @param binaryTrace The binary trace where the trace data is written to.
+ */
+BusTracker::BusTracker(
+    SimulatorFrontend& frontend, 
+    BinaryTraceWriter& binaryTrace) :
+    Listener(), frontend_(frontend), traceStream_(NULL),
+    binaryTrace_(&binaryTrace) {
+
+    TTAMachine::Machine::BusNavigator navigator =
+        frontend_.machine().busNavigator();
+    for (int i = 0; i < navigator.count(); ++i) {
+        const TTAMachine::Bus& bus = *navigator.item(i);
+        busIndices_.push_back(binaryTrace.nameIndex(bus.name()));
+        segmentIndices_.push_back(
+            binaryTrace.nameIndex(
+                bus.segmentCount() > 0 ? bus.segment(0)->name() : ""));
+    }
+    frontend.eventHandler().registerListener(
+        SimulationEventHandler::SE_CYCLE_END, this);
+}
+
 /**
  * Destructor.
  */
@@ -88,21 +120,54 @@ BusTracker::handleEvent() {
     TTAMachine::Machine::BusNavigator navigator =
         frontend_.machine().busNavigator();
 
-    traceStream_ << frontend_.cycleCount();
+    if (binaryTrace_ != NULL) {
+        const ClockCycleCount cycle = frontend_.cycleCount();
+        for (int i = 0; i < navigator.count(); ++i) {
+            BusState& bus =
+                frontend_.machineState().busState(navigator.item(i)->name());
+            try {
+                binaryTrace_->addBusActivity(
+                    cycle, busIndices_[i], segmentIndices_[i],
+                    bus.isSquashed(), bus.value());
+            } catch (const Exception& e) {
+                debugLog("Error while writing binary trace: " +
+                         e.errorMessage());
+            }
+        }
+        return;
+    }
+
+    writeTraceLine(frontend_, *traceStream_);
+    *traceStream_ << "\n";
+}
+
+/**
+ * Writes the bus trace line of the current cycle in the CSV format.
+ *
+ * @param frontend The simulator whose buses are traced.
+ * @param stream The stream the line is written to, without the line end.
+ */
+void
+BusTracker::writeTraceLine(
+    SimulatorFrontend& frontend, std::ostream& stream) {
+
+    TTAMachine::Machine::BusNavigator navigator =
+        frontend.machine().busNavigator();
+
+    stream << frontend.cycleCount();
 
     for (int i = 0; i < navigator.count(); ++i) {
         const std::string busName = navigator.item(i)->name();
 
-        BusState& bus = frontend_.machineState().busState(busName);
+        BusState& bus = frontend.machineState().busState(busName);
         int columnWidth = (bus.width()+3)/4;
 
-        traceStream_ << COLUMN_SEPARATOR;
+        stream << COLUMN_SEPARATOR;
         if (!bus.isSquashed()) {
-            traceStream_ << bus.value().hexValue(true);
+            stream << bus.value().hexValue(true);
         } else {
             // Squashed values are displayed as zeros.
-            traceStream_ << std::string(columnWidth, '0');
+            stream << std::string(columnWidth, '0');
         }
     }
-    traceStream_ << "\n";
 }
@@ -44,27 +44,42 @@
 
 class SimulationController;
 class SimulatorFrontend;
+class BinaryTraceWriter;
 
 /**
  * Tracks the bus activity.
  *
- * Stores bus data as hexadecimal numbers in a bus trace file in CSV format.
+ * Stores bus data as hexadecimal numbers in a bus trace file in CSV format,
+ * or as bus activity records in a binary trace.
  */
 class BusTracker : public Listener {
 public:
     BusTracker(
         SimulatorFrontend& frontend, 
         std::ostream& traceStream);
+    BusTracker(
+        SimulatorFrontend& frontend, 
+        BinaryTraceWriter& binaryTrace);
     virtual ~BusTracker();
 
     virtual void handleEvent();
+
+    static void writeTraceLine(
+        SimulatorFrontend& frontend, std::ostream& stream);
     
 private:
     static const int COLUMN_WIDTH;
     static const std::string COLUMN_SEPARATOR;
     /// the simulator frontend used to access simulation data
     SimulatorFrontend& frontend_;
-    std::ostream& traceStream_;
+    /// the CSV trace stream, or NULL
+    std::ostream* traceStream_;
+    /// the binary trace, or NULL
+    BinaryTraceWriter* binaryTrace_;
+    /// binary trace name indices of the buses
+    std::vector<unsigned int> busIndices_;
+    /// binary trace name indices of the first segments of the buses
+    std::vector<unsigned int> segmentIndices_;
 };
 
 #endif
@@ -156,6 +156,8 @@ supportedMemoryOps{
  * @param fuResourceConflictDetection is the conflict detection on?
  * @param handleCycleEnd should we let frontend handle each cycle end
  * @param basicBlockPerFile Should we generate only one BB per code file?
+ * @param blockCountersOnly Should only the basic block executions be
+ *                          counted instead of also the guarded moves?
  */
 CompiledSimCodeGenerator::CompiledSimCodeGenerator(
     const TTAMachine::Machine& machine,
@@ -166,11 +168,13 @@ CompiledSimCodeGenerator::CompiledSimCodeGenerator(
     bool dynamicCompilation,
     bool basicBlockPerFile,
     bool functionPerFile,
-    const TCEString& globalSymbolSuffix) :
+    const TCEString& globalSymbolSuffix,
+    bool blockCountersOnly) :
     machine_(machine), program_(program), simController_(controller),
     gcu_(*machine.controlUnit()),
     handleCycleEnd_(handleCycleEnd),
     dynamicCompilation_(dynamicCompilation),
+    blockCountersOnly_(blockCountersOnly),
     basicBlockPerFile_(basicBlockPerFile),
     functionPerFile_(functionPerFile),
     instructionNumber_(0), instructionCounter_(0),
@@ -1268,9 +1272,12 @@ CompiledSimCodeGenerator::generateInstruction(const Instruction& instruction) {
             endGuardBracket = true;
         }
 
-   // increase move count if the move is guarded or it is an exit point
-        if (!move.isUnconditional() || exitPoints_.find(
-            instruction.address().location()) != exitPoints_.end()) {
+        // increase move count if the move is guarded or it is an exit
+        // point, guarded moves are left to the basic block counters in
+        // case only those are wanted
+        if ((!move.isUnconditional() && !blockCountersOnly_) ||
+            exitPoints_.find(
+                instruction.address().location()) != exitPoints_.end()) {
             *os_ << " ++engine.moveExecCounts_[" << moveCounter_ << "]; ";
         }
         
@@ -1605,8 +1612,12 @@ CompiledSimCodeGenerator::generateStoreTrigger(
     } else {
         method += "MAU";
     }
-    
-    return memory + "." + method + "(" + address + ", " + dataToWrite + ");";
+
+    // the fast access methods bypass the memory watch checks of the
+    // generic ones, take the slow path only if the memory has watches
+    return "if (" + memory + ".hasWatches()) " + memory + ".checkWatches(" +
+        address + ", " + std::to_string(memOpDesc.mauCount) + ", true); " +
+        memory + "." + method + "(" + address + ", " + dataToWrite + ");";
 }
 
 /**
@@ -1650,8 +1661,10 @@ CompiledSimCodeGenerator::generateLoadTrigger(
         + "(" + temp + ", (" + MAUSize + "*"
         + std::to_string(memOpDesc.mauCount) +"));";
 
-    ss << "UIntWord " << temp << "; " << memory + "." << method << "("
-       << address << ", " << temp << "); ";
+    ss << "UIntWord " << temp << "; ";
+    ss << "if (" << memory << ".hasWatches()) " << memory << ".checkWatches("
+       << address << ", " << memOpDesc.mauCount << ", false); ";
+    ss << memory + "." << method << "(" << address << ", " << temp << "); ";
 
     ss << resultSignExtend << " ";
 
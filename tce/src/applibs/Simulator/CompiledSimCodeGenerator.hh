@@ -112,7 +112,8 @@ public:
         bool dynamicCompilation,
         bool basicBlockPerFile = false,
         bool functionPerFile = true,
-        const TCEString& globalSymbolPrefix = "");
+        const TCEString& globalSymbolPrefix = "",
+        bool blockCountersOnly = false);
 
     virtual ~CompiledSimCodeGenerator();
     
@@ -217,6 +218,8 @@ private:
     bool handleCycleEnd_;
     /// Is this a dynamic compiled simulation?
     bool dynamicCompilation_;
+    /// Should only the basic block executions be counted?
+    bool blockCountersOnly_;
     /// Should the generator generate only one basic block per code file
     bool basicBlockPerFile_;
     /// Should the generator start with a new file after function end
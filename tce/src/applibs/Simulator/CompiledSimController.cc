@@ -69,7 +69,7 @@ CompiledSimController::CompiledSimController(
     const TTAProgram::Program& program, bool leaveDirty) : 
     TTASimulationController(frontend, machine, program),
     pluginTools_(true, false), compiledSimulationPath_(""), 
-    leaveDirty_(leaveDirty) {
+    leaveDirty_(leaveDirty), blockCountersOnly_(false) {
 
 #ifdef DEBUG_COMPILED_SIMULATION
     leaveDirty_ = true;
@@ -256,13 +256,15 @@ CompiledSimController::reset() {
     }
 
     // Generate all simulation code at once
+    blockCountersOnly_ = frontend_.blockCountersOnly();
     CompiledSimCodeGenerator generator(
         sourceMachine_, program_, *this,
         frontend_.fuResourceConflictDetection(),
         frontend_.executionTracing() || frontend_.procedureTransferTracing(),
         !frontend_.staticCompilation(), 
         false, !frontend_.staticCompilation(),
-        Conversion::toString(instanceId_));
+        Conversion::toString(instanceId_),
+        blockCountersOnly_);
 
     CATCH_ANY(generator.generateToDirectory(compiledSimulationPath_));
 #ifdef DEBUG_COMPILED_SIMULATION
@@ -385,6 +387,18 @@ CompiledSimController::basicBlockStart(InstructionAddress address) const {
     return basicBlocks_.lower_bound(address)->second;
 }
 
+/**
+ * Returns true if the simulation engine counts only basic block executions.
+ *
+ * In that case guarded moves have no execution counters of their own.
+ *
+ * @return True if only basic block execution counters are generated.
+ */
+bool
+CompiledSimController::blockCountersOnly() const {
+    return blockCountersOnly_;
+}
+
 /**
  * Returns the program model
  * @return the program model
@@ -101,6 +101,7 @@ public:
     virtual void prepareToStop(StopReason reason);
     
     InstructionAddress basicBlockStart(InstructionAddress address) const;
+    bool blockCountersOnly() const;
     const TTAProgram::Program& program() const;
         
 private:
@@ -120,6 +121,8 @@ private:
     
     /// True, if the simulation should leave all the generated code files
     bool leaveDirty_;
+    /// True, if the engine was generated with basic block counters only
+    bool blockCountersOnly_;
     
     /// A map containing the basic blocks' start..end pairs
     CompiledSimCodeGenerator::AddressMap basicBlocks_;
@@ -73,6 +73,46 @@ public:
 };
 
 
+/**
+ * Setting action that sets the basic block only execution counting.
+ */
+class CompiledSimSetBlockCountersOnly {
+public:
+
+    /**
+     * Sets the basic block only execution counting.
+     *
+     * @param simFront SimulatorFrontend to set the counting for.
+     * @param newValue Value to set.
+     * @return True if setting was successful.
+     */
+    static bool execute(
+        SimulatorInterpreter&, SimulatorFrontend& simFront, bool newValue) {
+        simFront.setBlockCountersOnly(newValue);
+        return true;
+    }
+
+    /**
+     * Returns the default value of this setting.
+     *
+     * @return The default value.
+     */
+    static const DataObject& defaultValue() {
+        static const DataObject defaultValue_("0");
+        return defaultValue_;
+    }
+    
+    /**
+     * Should the action warn if program & machine exist and value was changed
+     * 
+     * @return boolean value on whether or not to warn
+     */
+    static bool warnOnExistingProgramAndMachine() {
+        return true;
+    }
+};
+
+
 /**
  * Default constructor
  */
@@ -83,7 +123,6 @@ CompiledSimSettingCommand::CompiledSimSettingCommand() :
     MapTools::deleteByKey(settings_, "rf_tracking");
     MapTools::deleteByKey(settings_, "bus_trace");
     MapTools::deleteByKey(settings_, "profile_data_saving");
-    MapTools::deleteByKey(settings_, "utilization_data_saving");
     
     // Replace FU conflict detection setting
     MapTools::deleteByKey(settings_, "fu_conflict_detection");
@@ -92,6 +131,12 @@ CompiledSimSettingCommand::CompiledSimSettingCommand() :
             BooleanSetting, CompiledSimSetFUConflictDetection>(
                 SimulatorToolbox::textGenerator().text(
                     Texts::TXT_INTERP_SETTING_FU_CONFLICT_DETECTION).str());
+
+    settings_["block_counters_only"] =
+        new TemplatedSimulatorSetting<
+            BooleanSetting, CompiledSimSetBlockCountersOnly>(
+                SimulatorToolbox::textGenerator().text(
+                    Texts::TXT_BLOCK_COUNTERS_ONLY).str());
 }
 
 /**
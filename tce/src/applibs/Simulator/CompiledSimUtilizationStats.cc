@@ -53,6 +53,16 @@ CompiledSimUtilizationStats::CompiledSimUtilizationStats() {
 CompiledSimUtilizationStats::~CompiledSimUtilizationStats() {
 }
 
+/**
+ * Calculates the utilization statistics of a finished compiled simulation.
+ *
+ * The engine only counts the executions of basic blocks (and guarded
+ * moves), so the statistics are reconstructed from the static moves of
+ * each instruction multiplied by their execution counts.
+ *
+ * @param program The simulated program.
+ * @param compiledSim The simulation engine.
+ */
 void 
 CompiledSimUtilizationStats::calculate(
     const TTAProgram::Program& program, 
@@ -358,6 +358,11 @@ CompiledSimulation::isFinished() const {
 /**
  * Returns move execution count for move #moveNumber.
  *
+ * Unconditional moves are executed every time their basic block is. If
+ * the engine counts only the basic block executions, the same count is
+ * used for the guarded moves, which then includes their squashed
+ * executions.
+ *
  * @param moveNumber move number as in POM 
  * @return move execution count
  */
@@ -369,8 +374,8 @@ CompiledSimulation::moveExecutionCount(
     InstructionAddress programStartAddress = program.startAddress().location();
     const Move& move = program.moveAt(moveNumber);
     
-    if (move.isUnconditional() && pimpl_->exitPoints_.find(address) == 
-        pimpl_->exitPoints_.end()) {
+    if ((move.isUnconditional() || pimpl_->controller_->blockCountersOnly())
+        && pimpl_->exitPoints_.find(address) == pimpl_->exitPoints_.end()) {
         // Grab the whole basic block execution count
         InstructionAddress bbStart = basicBlockStart(address - 
             programStartAddress);
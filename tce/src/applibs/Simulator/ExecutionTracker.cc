@@ -32,6 +32,7 @@
 
 #include "ExecutionTracker.hh"
 #include "ExecutionTrace.hh"
+#include "BinaryTraceWriter.hh"
 #include "Application.hh"
 #include "TTASimulationController.hh"
 #include "SimulatorToolbox.hh"
@@ -49,7 +50,21 @@
 ExecutionTracker::ExecutionTracker(
     TTASimulationController& subject,
     ExecutionTrace& traceDB) : Listener(),
-    subject_(subject), traceDB_(traceDB) {
+    subject_(subject), traceDB_(&traceDB), binaryTrace_(NULL) {
+    subject.frontend().eventHandler().registerListener(
+        SimulationEventHandler::SE_CYCLE_END, this);
+}
+
+/**
+ * Constructor.
+ *
+ * @param subject The SimulationController which is observed.
+ * @param binaryTrace The binary trace in which the trace is stored.
+ */
+ExecutionTracker::ExecutionTracker(
+    TTASimulationController& subject,
+    BinaryTraceWriter& binaryTrace) : Listener(),
+    subject_(subject), traceDB_(NULL), binaryTrace_(&binaryTrace) {
     subject.frontend().eventHandler().registerListener(
         SimulationEventHandler::SE_CYCLE_END, this);
 }
@@ -71,8 +86,13 @@ ExecutionTracker::~ExecutionTracker() {
 void 
 ExecutionTracker::handleEvent() {
     try {
-        traceDB_.addInstructionExecution(
-            subject_.clockCount(), subject_.lastExecutedInstruction());
+        if (binaryTrace_ != NULL) {
+            binaryTrace_->addInstructionExecution(
+                subject_.clockCount(), subject_.lastExecutedInstruction());
+        } else {
+            traceDB_->addInstructionExecution(
+                subject_.clockCount(), subject_.lastExecutedInstruction());
+        }
     } catch (const Exception& e) {
         debugLog("Error while writing TraceDB: " + e.errorMessage());
     }
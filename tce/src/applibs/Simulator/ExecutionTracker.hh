@@ -37,6 +37,7 @@
 
 class TTASimulationController;
 class ExecutionTrace;
+class BinaryTraceWriter;
 
 /**
  * Tracks the simulation execution.
@@ -48,6 +49,9 @@ public:
     ExecutionTracker(
         TTASimulationController& subject, 
         ExecutionTrace& traceDB);
+    ExecutionTracker(
+        TTASimulationController& subject, 
+        BinaryTraceWriter& binaryTrace);
     virtual ~ExecutionTracker();
 
     virtual void handleEvent();
@@ -55,8 +59,10 @@ public:
 private:
     /// the tracked SimulationController instance
     TTASimulationController& subject_;
-    /// the trace database to store the trace to
-    ExecutionTrace& traceDB_;
+    /// the trace database to store the trace to, or NULL
+    ExecutionTrace* traceDB_;
+    /// the binary trace to store the trace to, or NULL
+    BinaryTraceWriter* binaryTrace_;
 };
 
 #endif
@@ -101,9 +101,8 @@ FUState::clearPorts() {
 
 void
 FUState::reset() {
-    for (ExecutorContainer::iterator i = executors_.begin();
-         i != executors_.end(); ++i) {
-        Operation* op = (*i).first;
+    for (std::size_t i = 0; i < operations_.size(); ++i) {
+        Operation* op = operations_[i];
         // Ensure the init state is called again.
         op->deleteState(context());
         op->createState(context());
@@ -125,9 +124,7 @@ FUState::endClock() {
                 "Tried to trigger FU without operation code.");
         }
         if (nextExecutor_ == NULL) {
-            ExecutorContainer::iterator iter = executors_.find(nextOperation_);
-            assert(iter != executors_.end());
-            nextExecutor_ = (*iter).second;
+            nextExecutor_ = executors_[operationIndex(*nextOperation_)];
         }
         // set this flag to false before actually handling the trigger
         // condition because startOperation() can cause a runtime error
@@ -154,7 +151,7 @@ FUState::advanceClock() {
 
     // in case there are no active operations and there are no states
     // which need clock advancing, the FU is in idle state
-    if (activeExecutors_ == 0 && context().isEmpty()) {
+    if (activeExecutors_ == 0 && !context().hasClockedStates()) {
         idle_ = true;
         return;
     } else if (activeExecutors_ == 1 && nextExecutor_ != NULL &&
@@ -171,9 +168,8 @@ FUState::advanceClock() {
             activeExecutors_ = 0;
             idle_ = true;
         }
-        // advance clock of all operations with state
-        /// @todo detect if there are *clocked* state objects
-        if (!context().isEmpty()) {
+        // advance clock of all operations with clocked state
+        if (context().hasClockedStates()) {
             context().advanceClock();
         } 
         return;
@@ -191,13 +187,12 @@ FUState::advanceClock() {
             } 
         }
     }
-    // advance clock of all operations with state
-    /// @todo detect if there are *clocked* state objects
-    if (!context().isEmpty()) {
+    // advance clock of all operations with clocked state
+    if (context().hasClockedStates()) {
         context().advanceClock();
     } 
 
-    idle_ = (activeExecutors_ == 0 && context().isEmpty());
+    idle_ = (activeExecutors_ == 0 && !context().hasClockedStates());
 }
 
 /**
@@ -223,6 +218,10 @@ FUState::addOutputPortState(PortState& port) {
 /**
  * Adds operation executor for a given operation.
  *
+ * The operations are given consecutive indices in the order they are
+ * added, which lets the opcode setting ports trigger them through the
+ * dispatch tables without searching.
+ *
  * @param opExec Operation executor to be added.
  * @param op Operation which executor is added.
  */
@@ -238,7 +237,15 @@ FUState::addOperationExecutor(OperationExecutor& opExec, Operation& op) {
     OperationExecutor* newExecutor = opExec.copy();
     execList_.push_back(newExecutor);
     newExecutor->setContext(context());
-    executors_[&op] = newExecutor;
+
+    OperationIndexContainer::iterator iter = operationIndices_.find(&op);
+    if (iter != operationIndices_.end()) {
+        executors_[(*iter).second] = newExecutor;
+    } else {
+        operationIndices_[&op] = operations_.size();
+        operations_.push_back(&op);
+        executors_.push_back(newExecutor);
+    }
 }
 
 /**
@@ -259,7 +266,8 @@ FUState::replaceOperationExecutor(
     op.createState(context());
     newExecutor->setContext(context());
 
-    OperationExecutor* oldExecutor = executors_[&op];
+    const std::size_t index = operationIndex(op);
+    OperationExecutor* oldExecutor = executors_[index];
     newExecutor->setParent(oldExecutor->parent());
 
     /* Copy the operand-port bindings. */
@@ -276,7 +284,7 @@ FUState::replaceOperationExecutor(
             break;
         }
     }
-    executors_[&op] = newExecutor;
+    executors_[index] = newExecutor;
     delete oldExecutor;
 }
 
@@ -301,10 +309,8 @@ FUState::setOperationSimulator(
 void
 FUState::setOperationSimulator(DetailedOperationSimulator& sim) {
 
-    for (ExecutorContainer::iterator i = executors_.begin();
-         i != executors_.end(); ++i) {
-        Operation* op = (*i).first;
-        setOperationSimulator(*op, sim);
+    for (std::size_t i = 0; i < operations_.size(); ++i) {
+        setOperationSimulator(*operations_[i], sim);
     }
     detailedModel_ = &sim;
 }
@@ -354,12 +360,31 @@ FUState::sameBindings(
  */
 OperationExecutor*
 FUState::executor(Operation& op) {
-    ExecutorContainer::iterator iter = executors_.find(&op);
-    if (iter == executors_.end()) {
+    OperationIndexContainer::iterator iter = operationIndices_.find(&op);
+    if (iter == operationIndices_.end()) {
         return NULL;
     } else {
-        return (*iter).second;
+        return executors_[(*iter).second];
+    }
+}
+
+/**
+ * Returns the index of the given operation in the dispatch tables.
+ *
+ * @param op The operation.
+ * @return Index to give to setOperation().
+ * @exception KeyNotFound If the FU has no executor for the operation.
+ */
+std::size_t
+FUState::operationIndex(Operation& op) const {
+    OperationIndexContainer::const_iterator iter =
+        operationIndices_.find(&op);
+    if (iter == operationIndices_.end()) {
+        throw KeyNotFound(
+            __FILE__, __LINE__, __func__,
+            "No executor for operation " + op.name() + ".");
     }
+    return (*iter).second;
 }
 
 /**
@@ -64,6 +64,7 @@ public:
     void setTriggered();
     void setOperation(Operation& operation);
     void setOperation(Operation& operation, OperationExecutor& executor);
+    void setOperation(std::size_t operationIndex);
     virtual bool isIdle();
 
     virtual void endClock();
@@ -83,6 +84,7 @@ public:
         OperationExecutor* newExecutor);
 
     virtual OperationExecutor* executor(Operation& op);
+    std::size_t operationIndex(Operation& op) const;
 
     virtual OperationContext& context();
 
@@ -110,8 +112,8 @@ private:
         Operation& op, 
         DetailedOperationSimulator& sim);
 
-    /// Maps operations to executors.
-    typedef std::map<Operation*, OperationExecutor*> ExecutorContainer;
+    /// Maps operations to their indices in the dispatch tables.
+    typedef std::map<Operation*, std::size_t> OperationIndexContainer;
     /// Contains all the different instances of executors.
     typedef std::vector<OperationExecutor*> ExecutorList;
 
@@ -123,8 +125,12 @@ private:
     OperationExecutor* nextExecutor_;
     /// The operation context for this FU.
     OperationContext operationContext_;
-    /// All operation executors.
-    ExecutorContainer executors_;
+    /// Indices of the operations in the dispatch tables.
+    OperationIndexContainer operationIndices_;
+    /// The operations of the FU in the order they were added.
+    std::vector<Operation*> operations_;
+    /// The executors of the operations, indexed like operations_.
+    std::vector<OperationExecutor*> executors_;
     /// All the different instances of OperationExecutors.
     ExecutorList execList_;
     /// Input ports of the function unit.
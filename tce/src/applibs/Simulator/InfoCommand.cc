@@ -764,6 +764,11 @@ public:
                 (boost::format("%.0f") %
                  parent().simulatorFrontend().cycleCount()).str());
             return true;
+        } else if (command == "pc") {
+            parent().interpreter()->setResult(
+                Conversion::toString(
+                    parent().simulatorFrontend().programCounter()));
+            return true;
         } else if (command == "stats") {
             std::stringstream result;
 
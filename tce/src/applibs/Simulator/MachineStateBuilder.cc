@@ -451,12 +451,10 @@ MachineStateBuilder::addVirtualOpcodeSettingPortsToFU(
                 string name = 
                     port.name() + "." + 
                     StringTools::stringToLower(operation->name());
-                OperationExecutor* finalExecutor = 
-                    state.executor(*operation);
-                assert(executor != NULL);
                 OpcodeSettingVirtualInputPortState* opcodePort =
                     new OpcodeSettingVirtualInputPortState(
-                        *operation, *finalExecutor, state, *triggerPort);
+                        *operation, state.operationIndex(*operation),
+                        state, *triggerPort);
                 state.addInputPortState(*opcodePort);
                 machineState.addPortState(
                     opcodePort, name, port.parentUnit()->name());
@@ -0,0 +1,150 @@
+/*
+    Copyright (c) 2002-2026 Tampere University.
+
+    This file is part of TTA-Based Codesign Environment (TCE).
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+ */
+/**
+ * @file MemImageCommand.cc
+ *
+ * Implementation of MemImageCommand class
+ *
+ * @note rating: red
+ */
+
+#include "MemImageCommand.hh"
+#include "SimulatorFrontend.hh"
+#include "MemorySystem.hh"
+#include "SimulatorToolbox.hh"
+#include "AddressSpace.hh"
+#include "StringTools.hh"
+#include "Conversion.hh"
+#include "FileSystem.hh"
+
+
+MemImageCommand::MemImageCommand() : 
+    SimControlLanguageCommand("load_image") {
+}
+
+
+MemImageCommand::~MemImageCommand() {
+}
+
+/**
+ * Executes the "load_image" command.
+ *
+ * Loads a binary or ASCII data memory image, as written by the program
+ * image generator, to a data memory in large blocks.
+ *
+ * @param arguments Optional address space, image format and memory line
+ *                  width, the image file and an optional offset in MAUs.
+ * @return True in case a program is loaded and arguments are ok.
+ * @exception NumberFormatException Is never thrown by this command.
+ */
+bool
+MemImageCommand::execute(const std::vector<DataObject>& arguments) {
+    const int argumentCount = arguments.size() - 1;
+    if (!checkArgumentCount(argumentCount, 1, 8)) {
+        return false;
+    } 
+
+    if (!checkProgramLoaded()) {
+        return false;
+    }
+
+    size_t nextArg = 1;
+    std::string addressSpaceName = "";
+    MemorySystem::ImageFormat format = MemorySystem::BINARY_IMAGE;
+    int mausPerLine = 1;
+
+    while (nextArg + 1 < arguments.size() &&
+           (StringTools::ciEqual(arguments.at(nextArg).stringValue(), "/a") ||
+            StringTools::ciEqual(arguments.at(nextArg).stringValue(), "/f") ||
+            StringTools::ciEqual(arguments.at(nextArg).stringValue(), "/w"))) {
+        const std::string option = arguments.at(nextArg).stringValue();
+        const std::string value = arguments.at(nextArg + 1).stringValue();
+        if (StringTools::ciEqual(option, "/a")) {
+            addressSpaceName = value;
+        } else if (StringTools::ciEqual(option, "/w")) {
+            if (!checkPositiveIntegerArgument(arguments.at(nextArg + 1))) {
+                return false;
+            }
+            mausPerLine = arguments.at(nextArg + 1).integerValue();
+        } else if (StringTools::ciEqual(value, "binary")) {
+            format = MemorySystem::BINARY_IMAGE;
+        } else if (StringTools::ciEqual(value, "ascii") ||
+                   StringTools::ciEqual(value, "array")) {
+            format = MemorySystem::ASCII_IMAGE;
+        } else {
+            interpreter()->setError(
+                std::string("Unknown image format: ") + value);
+            return false;
+        }
+        nextArg += 2;
+    }
+
+    // the image file and the optional offset
+    if (!checkArgumentCount(arguments.size() - nextArg, 1, 2)) {
+        return false;
+    }
+
+    const std::string fileName = arguments.at(nextArg).stringValue();
+    if (!FileSystem::fileExists(fileName) ||
+        !FileSystem::fileIsReadable(fileName)) {
+        interpreter()->setError(std::string("Error reading input file."));
+        return false;
+    }
+
+    Word offset = 0;
+    if (nextArg + 1 < arguments.size()) {
+        if (!checkUnsignedIntegerArgument(arguments.at(nextArg + 1))) {
+            return false;
+        }
+        offset = arguments.at(nextArg + 1).integerValue();
+    }
+
+    // the address space can be omitted if there is only one memory
+    MemorySystem::MemoryPtr memory;
+    if (!setMemoryPointer(memory, addressSpaceName)) {
+        return false;
+    }
+    if (addressSpaceName == "") {
+        addressSpaceName =
+            simulatorFrontend().memorySystem().addressSpace(0).name();
+    }
+
+    try {
+        const std::size_t loaded = simulatorFrontend().loadMemoryImage(
+            addressSpaceName, offset, fileName, format, mausPerLine);
+        interpreter()->setResult(Conversion::toString(loaded));
+    } catch (const Exception& e) {
+        // the errors of the image, the address range and the MAU and line
+        // widths are told apart by the message
+        interpreter()->setError(e.errorMessage());
+        return false;
+    }
+    return true;
+}
+
+std::string 
+MemImageCommand::helpText() const {
+    return SimulatorToolbox::textGenerator().text(
+        Texts::TXT_INTERP_HELP_LOADIMAGE).str();
+}
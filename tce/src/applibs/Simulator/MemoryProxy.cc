@@ -90,6 +90,40 @@ MemoryProxy::write(
     memory_->write(address, data);
 }
 
+/**
+ * Writes a block of MAUs to the wrapped memory as a single access.
+ *
+ * @param address The first target address.
+ * @param data The MAUs to write.
+ * @param count Number of MAUs to write.
+ */
+void
+MemoryProxy::writeBlockDirectly(Word address, const MAU* data, int count) {
+
+    frontend_.eventHandler().handleEvent(
+        SimulationEventHandler::SE_MEMORY_ACCESS);
+
+    newWrites_.push_back(std::make_pair(address, count));
+    memory_->writeBlock(address, data, count);
+}
+
+/**
+ * Reads a block of MAUs from the wrapped memory as a single access.
+ *
+ * @param address The first address to read.
+ * @param data The read MAUs are stored here.
+ * @param count Number of MAUs to read.
+ */
+void
+MemoryProxy::readBlockDirectly(Word address, MAU* data, int count) {
+
+    frontend_.eventHandler().handleEvent(
+        SimulationEventHandler::SE_MEMORY_ACCESS);
+
+    newReads_.push_back(std::make_pair(address, count));
+    memory_->readBlock(address, data, count);
+}
+
 /**
  * Resets the memory access information for the last cycle when
  * wrapped memory clock is advanced.
@@ -78,6 +78,10 @@ public:
 
     MemoryAccess writeAccess(unsigned int idx) const;
 
+protected:
+    virtual void writeBlockDirectly(Word address, const MAU* data, int count);
+    virtual void readBlockDirectly(Word address, MAU* data, int count);
+
 private:
     SimulatorFrontend & frontend_;
 
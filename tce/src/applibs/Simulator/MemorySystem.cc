@@ -33,6 +33,7 @@
 
 #include <string>
 #include <algorithm>
+#include <fstream>
 
 #include "MemorySystem.hh"
 #include "Machine.hh"
@@ -46,6 +47,44 @@
 using std::string;
 using namespace TTAMachine;
 
+/// Number of bytes read from a memory image file and number of MAUs
+/// written to the memory at a time.
+const std::size_t IMAGE_BLOCK_SIZE = 1 << 20;
+
+/**
+ * Counts the complete MAUs in a memory image file.
+ *
+ * The stream is left at the beginning of the file.
+ *
+ * @param image The image file.
+ * @param format The format of the image file.
+ * @param mauBits Width of a MAU in bits.
+ * @return The number of MAUs in the image.
+ */
+static std::size_t
+imageMAUCount(
+    std::ifstream& image, MemorySystem::ImageFormat format,
+    unsigned int mauBits) {
+
+    std::size_t bits = 0;
+    if (format == MemorySystem::BINARY_IMAGE) {
+        image.seekg(0, std::ios::end);
+        bits = static_cast<std::size_t>(image.tellg()) * 8;
+    } else {
+        std::vector<char> input(IMAGE_BLOCK_SIZE);
+        while (image.good()) {
+            image.read(&input[0], input.size());
+            const std::size_t inputSize = image.gcount();
+            for (std::size_t i = 0; i < inputSize; ++i) {
+                bits += input[i] == '0' || input[i] == '1';
+            }
+        }
+    }
+    image.clear();
+    image.seekg(0, std::ios::beg);
+    return bits / mauBits;
+}
+
 /**
  * Constructor.
  *
@@ -295,3 +334,147 @@ MemorySystem::addressSpace(const std::string& name) {
         __FILE__, __LINE__, __func__, 
         "Address space with the given name not found.");
 }
+
+/**
+ * Loads a memory image file to the memory of the given address space.
+ *
+ * The image is read and written to the memory in large blocks, which is
+ * much faster than initializing the memory a MAU at a time. The formats
+ * are the data image formats of ProgramImageGenerator. In a binary image
+ * the MAUs are packed one after another starting from the most significant
+ * bit of the first byte. In an ASCII or array image the MAUs are written as
+ * '0' and '1' characters and the other characters are skipped. The padding
+ * bits at the end of the image are ignored.
+ *
+ * The generatebits option for the data memory width in MAUs reverses the
+ * order of the MAUs on each memory line of a little-endian image. The same
+ * width has to be given here for a little-endian memory so that the
+ * reversal is undone. An incomplete last line is padded with zero MAUs.
+ *
+ * The whole image is checked to fit in the address space before anything
+ * is written to the memory.
+ *
+ * @param addressSpaceName The name of the address space.
+ * @param offset Offset of the first MAU of the image from the start of the
+ *               address space, in MAUs.
+ * @param fileName The image file.
+ * @param format The format of the image file.
+ * @param mausPerLine Width of the memory lines of the image in MAUs.
+ * @return The number of loaded MAUs.
+ * @exception InstanceNotFound If no memory is found with the name.
+ * @exception IOException If the image file could not be read.
+ * @exception OutOfRange If the image does not fit in the address space or
+ *                       the MAU or line width is not supported.
+ */
+std::size_t
+MemorySystem::loadImage(
+    const std::string& addressSpaceName, Word offset,
+    const std::string& fileName, ImageFormat format, int mausPerLine) {
+
+    MemoryPtr mem = memory(addressSpaceName);
+    const unsigned int mauBits = mem->MAUSize();
+    if (mauBits == 0 || mauBits > sizeof(Memory::MAU) * 8) {
+        throw OutOfRange(
+            __FILE__, __LINE__, __func__,
+            "Unsupported MAU width " + Conversion::toString(mauBits) +
+            " in address space " + addressSpaceName + ".");
+    }
+    if (mausPerLine < 1) {
+        throw OutOfRange(
+            __FILE__, __LINE__, __func__,
+            "Illegal memory line width " +
+            Conversion::toString(mausPerLine) + ".");
+    }
+    const bool reverseLines = mausPerLine > 1 && mem->isLittleEndian();
+
+    std::ifstream image(fileName.c_str(), std::ios::in | std::ios::binary);
+    if (!image.is_open()) {
+        throw IOException(
+            __FILE__, __LINE__, __func__,
+            "Could not open memory image " + fileName + ".");
+    }
+
+    std::size_t mauCount = imageMAUCount(image, format, mauBits);
+    if (reverseLines) {
+        mauCount = (mauCount + mausPerLine - 1) / mausPerLine * mausPerLine;
+    }
+    const std::size_t memorySize =
+        static_cast<std::size_t>(mem->end()) - mem->start() + 1;
+    if (offset > memorySize || mauCount > memorySize - offset) {
+        throw OutOfRange(
+            __FILE__, __LINE__, __func__,
+            "Memory image " + fileName + " of " +
+            Conversion::toString(mauCount) + " MAUs does not fit in " +
+            "address space " + addressSpaceName + " at offset " +
+            Conversion::toString(offset) + ".");
+    }
+
+    std::vector<char> input(IMAGE_BLOCK_SIZE);
+    std::vector<Memory::MAU> block;
+    block.reserve(IMAGE_BLOCK_SIZE);
+    Word address = mem->start() + offset;
+    std::size_t loaded = 0;
+    Memory::MAU mau = 0;
+    unsigned int mauBitCount = 0;
+
+    while (image.good()) {
+        image.read(&input[0], input.size());
+        const std::size_t inputSize = image.gcount();
+
+        if (format == BINARY_IMAGE && mauBits == 8) {
+            // the common case of byte MAUs needs no bit shuffling
+            for (std::size_t i = 0; i < inputSize; ++i) {
+                block.push_back(static_cast<unsigned char>(input[i]));
+            }
+        } else {
+            for (std::size_t i = 0; i < inputSize; ++i) {
+                unsigned int bits = 0;
+                int bitCount = 0;
+                if (format == BINARY_IMAGE) {
+                    bits = static_cast<unsigned char>(input[i]);
+                    bitCount = 8;
+                } else if (input[i] == '0' || input[i] == '1') {
+                    bits = input[i] - '0';
+                    bitCount = 1;
+                }
+                for (int bit = bitCount - 1; bit >= 0; --bit) {
+                    mau = (mau << 1) | ((bits >> bit) & 1);
+                    if (++mauBitCount == mauBits) {
+                        block.push_back(mau);
+                        mau = 0;
+                        mauBitCount = 0;
+                    }
+                }
+            }
+        }
+        std::size_t ready = block.size();
+        if (reverseLines) {
+            // only whole lines are written, the rest waits for the next
+            // chunk unless the image ends
+            if (image.good()) {
+                ready -= ready % mausPerLine;
+            } else if (ready % mausPerLine != 0) {
+                ready += mausPerLine - ready % mausPerLine;
+                block.resize(ready, 0);
+            }
+            for (std::size_t i = 0; i < ready; i += mausPerLine) {
+                std::reverse(
+                    block.begin() + i, block.begin() + i + mausPerLine);
+            }
+        }
+        if (ready == 0) {
+            continue;
+        }
+        mem->writeBlock(address, &block[0], ready);
+        address += ready;
+        loaded += ready;
+        block.erase(block.begin(), block.begin() + ready);
+    }
+
+    if (image.bad()) {
+        throw IOException(
+            __FILE__, __LINE__, __func__,
+            "Error while reading memory image " + fileName + ".");
+    }
+    return loaded;
+}
@@ -40,6 +40,7 @@
 #include <boost/shared_ptr.hpp>
 
 #include "Exception.hh"
+#include "BaseType.hh"
 
 class Memory;
 class TCEString;
@@ -56,6 +57,12 @@ class MemorySystem {
 public:
     typedef boost::shared_ptr<Memory> MemoryPtr;
 
+    /// Formats of the memory image files that can be loaded.
+    enum ImageFormat {
+        BINARY_IMAGE, ///< Raw binary image with MAUs packed bit by bit.
+        ASCII_IMAGE   ///< Text image of '0' and '1' characters.
+    };
+
     explicit MemorySystem(const TTAMachine::Machine& machine);
     virtual ~MemorySystem();
 
@@ -82,6 +89,11 @@ public:
 
     bool hasMemory(const TCEString& aSpaceName) const;
 
+    std::size_t loadImage(
+        const std::string& addressSpaceName, Word offset,
+        const std::string& fileName, ImageFormat format,
+        int mausPerLine = 1);
+
 private:
     /// Copying not allowed.
     MemorySystem(const MemorySystem&);
@@ -0,0 +1,160 @@
+/*
+    Copyright (c) 2002-2026 Tampere University.
+
+    This file is part of TTA-Based Codesign Environment (TCE).
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+ */
+/**
+ * @file MemoryWatch.cc
+ *
+ * Definition of MemoryWatch class.
+ *
+ * @note rating: red
+ */
+
+#include <boost/format.hpp>
+
+#include "MemoryWatch.hh"
+#include "ConditionScript.hh"
+
+/**
+ * Constructor.
+ *
+ * @param memory The watched memory.
+ * @param addressSpace Name of the address space of the memory.
+ * @param firstAddress The first watched address.
+ * @param lastAddress The last watched address.
+ * @param reads True if reads should trigger the watch.
+ * @param writes True if writes should trigger the watch.
+ */
+MemoryWatch::MemoryWatch(
+    MemorySystem::MemoryPtr memory, const std::string& addressSpace,
+    Word firstAddress, Word lastAddress, bool reads, bool writes) :
+    StopPoint(), memory_(memory), addressSpace_(addressSpace),
+    firstAddress_(firstAddress), lastAddress_(lastAddress), reads_(reads),
+    writes_(writes), triggered_(false) {
+}
+
+/**
+ * Destructor.
+ */
+MemoryWatch::~MemoryWatch() {
+}
+
+/**
+ * Copy method for dynamically bound copies.
+ */
+StopPoint*
+MemoryWatch::copy() const {
+    MemoryWatch* aCopy = new MemoryWatch(
+        memory_, addressSpace_, firstAddress_, lastAddress_, reads_,
+        writes_);
+    if (conditional_) {
+        assert(condition_ != NULL);
+        aCopy->setCondition(*condition_);
+    } else {
+        aCopy->removeCondition();
+    }
+    aCopy->setEnabled(enabled_);
+    aCopy->setDisabledAfterTriggered(disabledAfterTriggered_);
+    aCopy->setDeletedAfterTriggered(deletedAfterTriggered_);
+    aCopy->setIgnoreCount(ignoreCount_);
+    return aCopy;
+}
+
+/**
+ * Tells whether an access to the watched range stopped the simulation.
+ *
+ * @return The status of the watch.
+ */
+bool
+MemoryWatch::isTriggered() const {
+    return triggered_;
+}
+
+/**
+ * Sets the triggered status of the watch.
+ *
+ * Called by StopPointManager when an access to the range stops the
+ * simulation and when the status of the previous stop is cleared.
+ *
+ * @param flag The new status.
+ */
+void
+MemoryWatch::setTriggered(bool flag) {
+    triggered_ = flag;
+}
+
+/**
+ * Returns the watched memory.
+ */
+MemorySystem::MemoryPtr
+MemoryWatch::memory() const {
+    return memory_;
+}
+
+/**
+ * Returns the first watched address.
+ */
+Word
+MemoryWatch::firstAddress() const {
+    return firstAddress_;
+}
+
+/**
+ * Returns the last watched address.
+ */
+Word
+MemoryWatch::lastAddress() const {
+    return lastAddress_;
+}
+
+/**
+ * Tells whether reads trigger the watch.
+ */
+bool
+MemoryWatch::watchesReads() const {
+    return reads_;
+}
+
+/**
+ * Tells whether writes trigger the watch.
+ */
+bool
+MemoryWatch::watchesWrites() const {
+    return writes_;
+}
+
+/**
+ * Prints the description string of the stop point.
+ */
+std::string
+MemoryWatch::description() const {
+    std::string accesses = reads_ ? (writes_ ? "accesses" : "reads") :
+        "writes";
+    std::string range = firstAddress_ == lastAddress_ ?
+        (boost::format("0x%x") % firstAddress_).str() :
+        (boost::format("0x%x-0x%x") % firstAddress_ % lastAddress_).str();
+    if (addressSpace_ != "") {
+        range = addressSpace_ + ":" + range;
+    }
+    return "watch for " + accesses + " to " + range + " " +
+        StopPoint::description();
+}
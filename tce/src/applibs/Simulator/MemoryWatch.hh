@@ -0,0 +1,86 @@
+/*
+    Copyright (c) 2002-2026 Tampere University.
+
+    This file is part of TTA-Based Codesign Environment (TCE).
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+ */
+/**
+ * @file MemoryWatch.hh
+ *
+ * Declaration of MemoryWatch class.
+ *
+ * @note rating: red
+ */
+
+#ifndef TTA_MEMORY_WATCH_HH
+#define TTA_MEMORY_WATCH_HH
+
+#include <string>
+
+#include "StopPoint.hh"
+#include "MemorySystem.hh"
+
+/**
+ * Represents a watch for accesses to a memory address range.
+ *
+ * Unlike the expression watches, memory watches are not checked at every
+ * instruction. StopPointManager registers them to the watched memory,
+ * which notifies the manager when an access touches the range.
+ */
+class MemoryWatch : public StopPoint {
+public:
+    MemoryWatch(
+        MemorySystem::MemoryPtr memory, const std::string& addressSpace,
+        Word firstAddress, Word lastAddress, bool reads, bool writes);
+    virtual ~MemoryWatch();
+
+    virtual bool isTriggered() const;
+    virtual std::string description() const;
+    virtual StopPoint* copy() const;
+
+    MemorySystem::MemoryPtr memory() const;
+    Word firstAddress() const;
+    Word lastAddress() const;
+    bool watchesReads() const;
+    bool watchesWrites() const;
+
+    void setTriggered(bool flag);
+
+private:
+    /// Static copying not allowed (should use copy()).
+    MemoryWatch(const MemoryWatch& source);
+
+    /// The watched memory.
+    MemorySystem::MemoryPtr memory_;
+    /// Name of the address space of the memory.
+    std::string addressSpace_;
+    /// The first watched address.
+    Word firstAddress_;
+    /// The last watched address.
+    Word lastAddress_;
+    /// Tells whether reads trigger the watch.
+    bool reads_;
+    /// Tells whether writes trigger the watch.
+    bool writes_;
+    /// Tells whether the watch stopped the simulation the last time.
+    bool triggered_;
+};
+
+#endif
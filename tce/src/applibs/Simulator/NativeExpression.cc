@@ -0,0 +1,514 @@
+/*
+    Copyright (c) 2002-2026 Tampere University.
+
+    This file is part of TTA-Based Codesign Environment (TCE).
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+ */
+/**
+ * @file NativeExpression.cc
+ *
+ * Definition of NativeExpression class.
+ *
+ * @note rating: red
+ */
+
+#include <vector>
+#include <cctype>
+
+#include "NativeExpression.hh"
+#include "SimulatorFrontend.hh"
+#include "MachineState.hh"
+#include "StateData.hh"
+#include "PortState.hh"
+#include "MemorySystem.hh"
+#include "Memory.hh"
+#include "AddressSpace.hh"
+#include "SimValue.hh"
+#include "StringTools.hh"
+
+namespace {
+
+/**
+ * An integer constant.
+ */
+class ConstantExpression : public NativeExpression {
+public:
+    ConstantExpression(long long value) : value_(value) {}
+    virtual long long value() const { return value_; }
+private:
+    const long long value_;
+};
+
+/**
+ * Value of a register, shown as an unsigned hex number by Tcl.
+ */
+class RegisterExpression : public NativeExpression {
+public:
+    RegisterExpression(const StateData& reg) : reg_(reg) {}
+    virtual long long value() const { return reg_.value().uIntWordValue(); }
+private:
+    const StateData& reg_;
+};
+
+/**
+ * Value of a port, shown as a signed integer by Tcl.
+ */
+class PortExpression : public NativeExpression {
+public:
+    PortExpression(const PortState& port) : port_(port) {}
+    virtual long long value() const { return port_.value().intValue(); }
+private:
+    const PortState& port_;
+};
+
+/**
+ * The simulated cycle count.
+ */
+class CycleCountExpression : public NativeExpression {
+public:
+    CycleCountExpression(const SimulatorFrontend& frontend) :
+        frontend_(frontend) {}
+    virtual long long value() const { return frontend_.cycleCount(); }
+private:
+    const SimulatorFrontend& frontend_;
+};
+
+/**
+ * The program counter.
+ */
+class ProgramCounterExpression : public NativeExpression {
+public:
+    ProgramCounterExpression(const SimulatorFrontend& frontend) :
+        frontend_(frontend) {}
+    virtual long long value() const { return frontend_.programCounter(); }
+private:
+    const SimulatorFrontend& frontend_;
+};
+
+/**
+ * An unsigned value read from the memory.
+ */
+class MemoryExpression : public NativeExpression {
+public:
+    MemoryExpression(
+        MemorySystem::MemoryPtr memory, Word address, int size) :
+        memory_(memory), address_(address), size_(size) {}
+    virtual long long value() const {
+        UIntWord data = 0;
+        memory_->read(address_, size_, data);
+        return data;
+    }
+private:
+    MemorySystem::MemoryPtr memory_;
+    const Word address_;
+    const int size_;
+};
+
+/// The supported operators.
+enum Operator {
+    OP_NONE, OP_MUL, OP_ADD, OP_SUB, OP_LT, OP_GT, OP_LE, OP_GE, OP_EQ,
+    OP_NE, OP_BITAND, OP_BITXOR, OP_BITOR, OP_AND, OP_OR, OP_NOT,
+    OP_BITNOT, OP_NEG
+};
+
+/**
+ * An unary operation.
+ */
+class UnaryExpression : public NativeExpression {
+public:
+    UnaryExpression(Operator op, NativeExpression::Pointer operand) :
+        op_(op), operand_(operand) {}
+    virtual long long value() const {
+        const long long operand = operand_->value();
+        switch (op_) {
+        case OP_NOT: return operand == 0;
+        case OP_BITNOT: return ~operand;
+        default: return -operand;
+        }
+    }
+private:
+    const Operator op_;
+    NativeExpression::Pointer operand_;
+};
+
+/**
+ * A binary operation.
+ */
+class BinaryExpression : public NativeExpression {
+public:
+    BinaryExpression(
+        Operator op, NativeExpression::Pointer lhs,
+        NativeExpression::Pointer rhs) :
+        op_(op), lhs_(lhs), rhs_(rhs) {}
+    virtual long long value() const {
+        const long long lhs = lhs_->value();
+        // the logical operators do not evaluate the right operand in case
+        // the result is known, like in Tcl
+        if (op_ == OP_AND) {
+            return lhs != 0 && rhs_->value() != 0;
+        } else if (op_ == OP_OR) {
+            return lhs != 0 || rhs_->value() != 0;
+        }
+        const long long rhs = rhs_->value();
+        switch (op_) {
+        case OP_MUL: return lhs * rhs;
+        case OP_ADD: return lhs + rhs;
+        case OP_SUB: return lhs - rhs;
+        case OP_LT: return lhs < rhs;
+        case OP_GT: return lhs > rhs;
+        case OP_LE: return lhs <= rhs;
+        case OP_GE: return lhs >= rhs;
+        case OP_EQ: return lhs == rhs;
+        case OP_NE: return lhs != rhs;
+        case OP_BITAND: return lhs & rhs;
+        case OP_BITXOR: return lhs ^ rhs;
+        default: return lhs | rhs;
+        }
+    }
+private:
+    const Operator op_;
+    NativeExpression::Pointer lhs_;
+    NativeExpression::Pointer rhs_;
+};
+
+/**
+ * Compiles the supported subset of Tcl expressions.
+ *
+ * Throws InvalidData in case the expression is not supported.
+ */
+class ExpressionCompiler {
+public:
+    ExpressionCompiler(
+        const std::string& script, SimulatorFrontend& frontend) :
+        script_(script), position_(0), frontend_(frontend) {}
+
+    NativeExpression::Pointer compile() {
+        NativeExpression::Pointer expression = parseBinary(1);
+        skipWhiteSpace();
+        if (position_ != script_.size()) {
+            unsupported();
+        }
+        return expression;
+    }
+
+    NativeExpression::Pointer compileScript() {
+        if (accept("expr ")) {
+            const bool braced = accept("{");
+            NativeExpression::Pointer expression = parseBinary(1);
+            if (braced && !accept("}")) {
+                unsupported();
+            }
+            skipWhiteSpace();
+            if (position_ != script_.size()) {
+                unsupported();
+            }
+            return expression;
+        }
+        return compileCommand(script_);
+    }
+
+private:
+    void unsupported() const {
+        throw InvalidData(
+            __FILE__, __LINE__, __func__,
+            "Unsupported expression: " + script_);
+    }
+
+    void skipWhiteSpace() {
+        while (position_ < script_.size() &&
+               std::isspace(static_cast<unsigned char>(script_[position_]))) {
+            ++position_;
+        }
+    }
+
+    bool accept(const std::string& token) {
+        skipWhiteSpace();
+        if (script_.compare(position_, token.size(), token) == 0) {
+            position_ += token.size();
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * Reads a binary operator of at least the given precedence.
+     */
+    Operator binaryOperator(int minPrecedence, int& precedence) {
+        static const struct {
+            const char* token;
+            Operator op;
+            int precedence;
+        } operators[] = {
+            // two character operators first so that they are matched
+            // before their one character prefixes
+            {"&&", OP_AND, 2}, {"||", OP_OR, 1}, {"<=", OP_LE, 7},
+            {">=", OP_GE, 7}, {"==", OP_EQ, 6}, {"!=", OP_NE, 6},
+            {"<<", OP_NONE, 0}, {">>", OP_NONE, 0}, {"**", OP_NONE, 0},
+            {"*", OP_MUL, 10}, {"+", OP_ADD, 9}, {"-", OP_SUB, 9},
+            {"<", OP_LT, 7}, {">", OP_GT, 7}, {"&", OP_BITAND, 5},
+            {"^", OP_BITXOR, 4}, {"|", OP_BITOR, 3}
+        };
+        skipWhiteSpace();
+        for (std::size_t i = 0; i < sizeof(operators)/sizeof(operators[0]);
+             ++i) {
+            const std::string token = operators[i].token;
+            if (script_.compare(position_, token.size(), token) == 0) {
+                if (operators[i].op == OP_NONE) {
+                    unsupported();
+                }
+                if (operators[i].precedence < minPrecedence) {
+                    return OP_NONE;
+                }
+                position_ += token.size();
+                precedence = operators[i].precedence;
+                return operators[i].op;
+            }
+        }
+        return OP_NONE;
+    }
+
+    NativeExpression::Pointer parseBinary(int minPrecedence) {
+        NativeExpression::Pointer lhs = parseUnary();
+        int precedence = 0;
+        Operator op = OP_NONE;
+        while ((op = binaryOperator(minPrecedence, precedence)) != OP_NONE) {
+            NativeExpression::Pointer rhs = parseBinary(precedence + 1);
+            lhs.reset(new BinaryExpression(op, lhs, rhs));
+        }
+        return lhs;
+    }
+
+    NativeExpression::Pointer parseUnary() {
+        if (accept("!")) {
+            return NativeExpression::Pointer(
+                new UnaryExpression(OP_NOT, parseUnary()));
+        } else if (accept("~")) {
+            return NativeExpression::Pointer(
+                new UnaryExpression(OP_BITNOT, parseUnary()));
+        } else if (accept("-")) {
+            return NativeExpression::Pointer(
+                new UnaryExpression(OP_NEG, parseUnary()));
+        } else if (accept("+")) {
+            return parseUnary();
+        }
+        return parsePrimary();
+    }
+
+    NativeExpression::Pointer parsePrimary() {
+        if (accept("(")) {
+            NativeExpression::Pointer expression = parseBinary(1);
+            if (!accept(")")) {
+                unsupported();
+            }
+            return expression;
+        } else if (accept("[")) {
+            std::size_t end = script_.find(']', position_);
+            if (end == std::string::npos) {
+                unsupported();
+            }
+            const std::string command =
+                script_.substr(position_, end - position_);
+            position_ = end + 1;
+            return compileCommand(command);
+        }
+
+        skipWhiteSpace();
+        std::size_t end = position_;
+        while (end < script_.size() &&
+               std::isalnum(static_cast<unsigned char>(script_[end]))) {
+            ++end;
+        }
+        const std::string number = script_.substr(position_, end - position_);
+        position_ = end;
+        return NativeExpression::Pointer(
+            new ConstantExpression(parseNumber(number)));
+    }
+
+    /**
+     * Parses a decimal or hexadecimal integer.
+     *
+     * Numbers with leading zeros are octal in Tcl, they are not supported.
+     */
+    long long parseNumber(const std::string& number) const {
+        const bool hex = number.size() > 2 && number[0] == '0' &&
+            (number[1] == 'x' || number[1] == 'X');
+        const std::string digits = hex ? number.substr(2) : number;
+        if (digits.empty() || digits.size() > (hex ? 15u : 18u) ||
+            (!hex && digits.size() > 1 && digits[0] == '0')) {
+            unsupported();
+        }
+        long long value = 0;
+        for (std::size_t i = 0; i < digits.size(); ++i) {
+            const char c = digits[i];
+            if (hex && std::isxdigit(static_cast<unsigned char>(c))) {
+                value = value * 16 + (std::isdigit(c) ?
+                    c - '0' : std::tolower(c) - 'a' + 10);
+            } else if (std::isdigit(static_cast<unsigned char>(c))) {
+                value = value * 10 + (c - '0');
+            } else {
+                unsupported();
+            }
+        }
+        return value;
+    }
+
+    NativeExpression::Pointer compileCommand(const std::string& command) {
+        std::vector<std::string> words;
+        StringTools::chopString(command, " ", words);
+        if (words.size() == 4 && words[0] == "info" &&
+            words[1] == "registers" && !frontend_.isCompiledSimulation()) {
+            const long long index = parseNumber(words[3]);
+            const StateData& reg = frontend_.findRegister(words[2], index);
+            if (reg.value().width() > 32) {
+                unsupported();
+            }
+            return NativeExpression::Pointer(new RegisterExpression(reg));
+        } else if (words.size() == 4 && words[0] == "info" &&
+                   words[1] == "ports" &&
+                   !frontend_.isCompiledSimulation()) {
+            const PortState& port =
+                frontend_.machineState().portState(words[3], words[2]);
+            if (&port == &NullPortState::instance()) {
+                unsupported();
+            }
+            return NativeExpression::Pointer(new PortExpression(port));
+        } else if (words.size() == 3 && words[0] == "info" &&
+                   words[1] == "proc" && words[2] == "cycles") {
+            return NativeExpression::Pointer(
+                new CycleCountExpression(frontend_));
+        } else if (words.size() == 3 && words[0] == "info" &&
+                   words[1] == "proc" && words[2] == "pc") {
+            return NativeExpression::Pointer(
+                new ProgramCounterExpression(frontend_));
+        } else if (words.size() > 0 && words[0] == "x") {
+            return compileMemoryRead(words);
+        }
+        unsupported();
+        return NativeExpression::Pointer();
+    }
+
+    /**
+     * Compiles a single word memory read done with the 'x' command.
+     *
+     * The unit size must be given explicitly because the default of the
+     * command is the size used the previous time.
+     */
+    NativeExpression::Pointer compileMemoryRead(
+        const std::vector<std::string>& words) {
+        std::string addressSpace = "";
+        int units = 0;
+        for (std::size_t i = 1; i + 1 < words.size(); i += 2) {
+            if (words[i] == "/a") {
+                addressSpace = words[i + 1];
+            } else if (words[i] == "/u" && words[i + 1] == "b") {
+                units = 1;
+            } else if (words[i] == "/u" && words[i + 1] == "h") {
+                units = 2;
+            } else if (words[i] == "/u" && words[i + 1] == "w") {
+                units = 4;
+            } else if (words[i] != "/n" || words[i + 1] != "1") {
+                unsupported();
+            }
+        }
+        if (units == 0 || words.size() % 2 != 0) {
+            unsupported();
+        }
+        MemorySystem& memorySystem = frontend_.memorySystem();
+        MemorySystem::MemoryPtr memory;
+        int mauWidth = 0;
+        if (memorySystem.memoryCount() == 1) {
+            memory = memorySystem.memory(0);
+            mauWidth = memorySystem.addressSpace(0).width();
+        } else if (addressSpace != "") {
+            memory = memorySystem.memory(addressSpace);
+            mauWidth = memorySystem.addressSpace(addressSpace).width();
+        } else {
+            unsupported();
+        }
+        if (mauWidth * units > 32) {
+            unsupported();
+        }
+        return NativeExpression::Pointer(
+            new MemoryExpression(
+                memory, parseNumber(words.back()), units));
+    }
+
+    /// The compiled script.
+    const std::string script_;
+    /// Parse position in the script.
+    std::size_t position_;
+    /// The simulator whose state the expression reads.
+    SimulatorFrontend& frontend_;
+};
+
+}
+
+/**
+ * Constructor.
+ */
+NativeExpression::NativeExpression() {
+}
+
+/**
+ * Destructor.
+ */
+NativeExpression::~NativeExpression() {
+}
+
+/**
+ * Compiles the given Tcl expression.
+ *
+ * @param script The expression.
+ * @param frontend The simulator whose state the expression reads.
+ * @return The compiled expression or a null pointer in case the
+ *         expression is not supported and must be evaluated with Tcl.
+ */
+NativeExpression::Pointer
+NativeExpression::compile(
+    const std::string& script, SimulatorFrontend& frontend) {
+
+    try {
+        return ExpressionCompiler(script, frontend).compile();
+    } catch (const Exception&) {
+        // unsupported forms as well as unknown registers, ports and
+        // memories are left to Tcl, which reports them properly
+        return Pointer();
+    }
+}
+
+/**
+ * Compiles the given Tcl command whose result is the value of interest,
+ * such as a watched expression.
+ *
+ * @param script The command.
+ * @param frontend The simulator whose state the command reads.
+ * @return The compiled command or a null pointer in case the command is
+ *         not supported and must be evaluated with Tcl.
+ */
+NativeExpression::Pointer
+NativeExpression::compileCommand(
+    const std::string& script, SimulatorFrontend& frontend) {
+
+    try {
+        return ExpressionCompiler(script, frontend).compileScript();
+    } catch (const Exception&) {
+        return Pointer();
+    }
+}
@@ -0,0 +1,95 @@
+/*
+    Copyright (c) 2002-2026 Tampere University.
+
+    This file is part of TTA-Based Codesign Environment (TCE).
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+ */
+/**
+ * @file NativeExpression.hh
+ *
+ * Declaration of NativeExpression class.
+ *
+ * @note rating: red
+ */
+
+#ifndef TTA_NATIVE_EXPRESSION_HH
+#define TTA_NATIVE_EXPRESSION_HH
+
+#include <string>
+#include <boost/shared_ptr.hpp>
+
+#include "Exception.hh"
+
+class SimulatorFrontend;
+
+/**
+ * A stop point condition or watch expression compiled to C++ objects.
+ *
+ * Evaluating a Tcl script in every simulated instruction is slow, so the
+ * common forms of conditions and watch expressions are compiled to trees
+ * of NativeExpression nodes that read the simulated state directly. The
+ * supported expressions are integer Tcl expressions with the operators
+ * * + - < > <= >= == != & ^ | && || ! ~ and parentheses, in which
+ * the operands are integer constants or one of the following commands:
+ *
+ * - [info registers <rf> <index>]
+ * - [info ports <unit> <port>]
+ * - [info proc cycles]
+ * - [info proc pc]
+ * - [x [/a <address space>] /u b|h|w <address>]
+ *
+ * Watched scripts are Tcl commands instead of expressions. The commands
+ * above and 'expr' of a supported expression are compiled with
+ * compileCommand().
+ *
+ * The compiled expression gives the same value as the Tcl script. Other
+ * scripts are not compiled and must be evaluated with Tcl.
+ */
+class NativeExpression {
+public:
+    /// Shared pointer to an immutable compiled expression.
+    typedef boost::shared_ptr<const NativeExpression> Pointer;
+
+    virtual ~NativeExpression();
+
+    /**
+     * Evaluates the expression.
+     *
+     * @return The value of the expression.
+     * @exception Exception If the simulated state could not be read.
+     */
+    virtual long long value() const = 0;
+
+    static Pointer compile(
+        const std::string& script, SimulatorFrontend& frontend);
+    static Pointer compileCommand(
+        const std::string& script, SimulatorFrontend& frontend);
+
+protected:
+    NativeExpression();
+
+private:
+    /// Copying not allowed.
+    NativeExpression(const NativeExpression&);
+    /// Assignment not allowed.
+    NativeExpression& operator=(const NativeExpression&);
+};
+
+#endif
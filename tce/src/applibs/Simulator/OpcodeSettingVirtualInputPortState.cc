@@ -52,7 +52,7 @@ OpcodeSettingVirtualInputPortState::OpcodeSettingVirtualInputPortState(
     FUState& parent,
     InputPortState& real) : 
     InputPortState(parent, real.value().width()), 
-    operation_(operation), executor_(NULL),
+    operation_(operation), indexed_(false), operationIndex_(0),
     real_(real) {
 }
 
@@ -60,18 +60,19 @@ OpcodeSettingVirtualInputPortState::OpcodeSettingVirtualInputPortState(
  * Constructor.
  *
  * @param Operation Operation of the port.
- * @param executor OperationExecutor to use to execute the operation when it's
- *                 triggered.
+ * @param operationIndex Index of the operation in the dispatch tables of
+ *                       the parent FU, used to find the executor of the
+ *                       operation when it's triggered.
  * @param parent Parent function unit.
  * @param real The real port in which this port belongs to.
  */
 OpcodeSettingVirtualInputPortState::OpcodeSettingVirtualInputPortState(
     Operation& operation,
-    OperationExecutor& executor,
+    std::size_t operationIndex,
     FUState& parent,
     InputPortState& real) : 
     InputPortState(parent, real.value().width()), 
-    operation_(operation), executor_(&executor),
+    operation_(operation), indexed_(true), operationIndex_(operationIndex),
     real_(real) {
 }
 
@@ -88,8 +89,8 @@ OpcodeSettingVirtualInputPortState::~OpcodeSettingVirtualInputPortState() {
 void
 OpcodeSettingVirtualInputPortState::setValue(const SimValue& value) {
 
-    if (executor_ != NULL) {
-        parent_->setOperation(operation_, *executor_);
+    if (indexed_) {
+        parent_->setOperation(operationIndex_);
     } else {
         parent_->setOperation(operation_);
     }
@@ -40,7 +40,6 @@
 
 class Operation;
 class FUState;
-class OperationExecutor;
 
 /**
  * Operation setting input port state.
@@ -52,7 +51,7 @@ class OpcodeSettingVirtualInputPortState : public InputPortState {
 public:
     OpcodeSettingVirtualInputPortState(
         Operation& operation, 
-        OperationExecutor& executor,
+        std::size_t operationIndex,
         FUState& parent, 
         InputPortState& real);
 
@@ -77,10 +76,13 @@ private:
         const OpcodeSettingVirtualInputPortState&);
     /// Operation of the port.
     Operation& operation_;
-    /// Operation executor used to execute the operation in the target FU,
+    /// True if the index of the operation in the dispatch tables of the
+    /// target FU is known.
+    bool indexed_;
+    /// Index of the operation in the dispatch tables of the target FU,
     /// this is an optimization to avoid searching for the executor every
     /// time the operation is triggered.
-    OperationExecutor* executor_;
+    std::size_t operationIndex_;
     /// Real input port.
     InputPortState& real_;
 };
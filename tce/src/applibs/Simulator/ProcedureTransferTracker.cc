@@ -32,6 +32,7 @@
 
 #include "ProcedureTransferTracker.hh"
 #include "ExecutionTrace.hh"
+#include "BinaryTraceWriter.hh"
 #include "Application.hh"
 #include "SimulatorFrontend.hh"
 #include "SimulatorToolbox.hh"
@@ -58,7 +59,23 @@
 ProcedureTransferTracker::ProcedureTransferTracker(
     SimulatorFrontend& subject,
     ExecutionTrace& traceDB) : Listener(),
-    subject_(subject), traceDB_(traceDB), previousInstruction_(NULL) {
+    subject_(subject), traceDB_(&traceDB), binaryTrace_(NULL),
+    previousInstruction_(NULL) {
+    subject.eventHandler().registerListener(
+        SimulationEventHandler::SE_CYCLE_END, this);
+}
+
+/**
+ * Constructor.
+ *
+ * @param subject The SimulationController which is observed.
+ * @param binaryTrace The binary trace in which the trace is stored.
+ */
+ProcedureTransferTracker::ProcedureTransferTracker(
+    SimulatorFrontend& subject,
+    BinaryTraceWriter& binaryTrace) : Listener(),
+    subject_(subject), traceDB_(NULL), binaryTrace_(&binaryTrace),
+    previousInstruction_(NULL) {
     subject.eventHandler().registerListener(
         SimulationEventHandler::SE_CYCLE_END, this);
 }
@@ -129,15 +146,17 @@ ProcedureTransferTracker::handleEvent() {
         }
     }  
     previousInstruction_ = &currentInstruction;
+    const ExecutionTrace::ProcedureEntryType type =
+        entry ? ExecutionTrace::PT_ENTRY : ExecutionTrace::PT_EXIT;
     try {
-        if (entry) {
-            traceDB_.addProcedureTransfer(
+        if (binaryTrace_ != NULL) {
+            binaryTrace_->addProcedureTransfer(
                 subject_.cycleCount(), subject_.lastExecutedInstruction(), 
-                lastControlFlowInstructionAddress, ExecutionTrace::PT_ENTRY);
+                lastControlFlowInstructionAddress, type);
         } else {
-            traceDB_.addProcedureTransfer(
+            traceDB_->addProcedureTransfer(
                 subject_.cycleCount(), subject_.lastExecutedInstruction(), 
-                lastControlFlowInstructionAddress, ExecutionTrace::PT_EXIT);
+                lastControlFlowInstructionAddress, type);
         }
     } catch (const Exception& e) {
         debugLog("Error while writing TraceDB: " + e.errorMessage());
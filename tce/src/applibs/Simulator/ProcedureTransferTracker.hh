@@ -37,6 +37,7 @@
 
 class SimulatorFrontend;
 class ExecutionTrace;
+class BinaryTraceWriter;
 
 namespace TTAProgram {
     class Instruction;
@@ -52,6 +53,9 @@ public:
     ProcedureTransferTracker(
         SimulatorFrontend& subject, 
         ExecutionTrace& traceDB);
+    ProcedureTransferTracker(
+        SimulatorFrontend& subject, 
+        BinaryTraceWriter& binaryTrace);
     virtual ~ProcedureTransferTracker();
 
     virtual void handleEvent();
@@ -59,8 +63,10 @@ public:
 private:
     /// the tracked SimulatorFrontend instance
     SimulatorFrontend& subject_;
-    /// the trace database to store the trace to
-    ExecutionTrace& traceDB_;
+    /// the trace database to store the trace to, or NULL
+    ExecutionTrace* traceDB_;
+    /// the binary trace to store the trace to, or NULL
+    BinaryTraceWriter* binaryTrace_;
     /// the previously executed instruction
     const TTAProgram::Instruction* previousInstruction_;
 };
@@ -120,6 +120,45 @@ public:
     }
 };
 
+/**
+ * Setting action that sets the binary trace format of simulation.
+ */
+class SetBinaryTrace {
+public:
+
+    /**
+     * Sets the binary tracing of the simulation.
+     *
+     * @param simFront SimulatorFrontend to set the binary tracing for.
+     * @param newValue Value to set.
+     * @return True if setting was successful.
+     */
+    static bool execute(
+        SimulatorInterpreter&, SimulatorFrontend& simFront, bool newValue) {
+        simFront.setBinaryTracing(newValue);
+        return true;
+    }
+
+    /**
+     * Returns the default value of this setting.
+     *
+     * @return The default value.
+     */
+    static const DataObject& defaultValue() {
+        static const DataObject defaultValue_("0");
+        return defaultValue_;
+    }
+    
+    /**
+     * Should the action warn if program & machine exist and value was changed
+     * 
+     * @return boolean value on whether or not to warn
+     */
+    static bool warnOnExistingProgramAndMachine() {
+        return true;
+    }
+};
+
 /**
  * Setting action that sets the register file access tracking of simulation.
  */
@@ -662,6 +701,11 @@ SettingCommand::SettingCommand() :
             SimulatorToolbox::textGenerator().text(
                 Texts::TXT_INTERP_SETTING_BUSTRACE).str());
 
+    settings_["binary_trace"] =
+        new TemplatedSimulatorSetting<BooleanSetting, SetBinaryTrace>(
+            SimulatorToolbox::textGenerator().text(
+                Texts::TXT_INTERP_SETTING_BINARYTRACE).str());
+
     settings_["rf_tracking"] =
         new TemplatedSimulatorSetting<BooleanSetting, SetRFTracking>(
             SimulatorToolbox::textGenerator().text(
@@ -80,6 +80,8 @@ POP_CLANG_DIAGS
 #include "Instruction.hh"
 #include "ExecutionTracker.hh"
 #include "ExecutionTrace.hh"
+#include "BinaryTraceWriter.hh"
+#include "BackgroundTraceWriter.hh"
 #include "SimulatorConstants.hh"
 #include "StopPointManager.hh"
 #include "TPEFTools.hh"
@@ -121,16 +123,17 @@ SimulatorFrontend::SimulatorFrontend(SimulationType backendType) :
     programFileName_(""), programOwnedByFrontend_(false), 
     currentBackend_(backendType),
     disassembler_(NULL), traceFileName_(""), executionTracing_(false),
-    busTracing_(false), 
+    busTracing_(false), binaryTracing_(false),
     rfAccessTracing_(false), procedureTransferTracing_(false), 
     saveProfileData_(false), saveUtilizationData_(false),
-    traceDB_(NULL), lastTraceDB_(NULL),
+    traceDB_(NULL), lastTraceDB_(NULL), binaryTrace_(NULL),
     executionTracker_(NULL), busTracker_(NULL),
     rfAccessTracker_(NULL), procedureTransferTracker_(NULL),
     stopPointManager_(NULL),  utilizationStats_(NULL), tpef_(NULL),
     fuResourceConflictDetection_(true),
     printNextInstruction_(true), printSimulationTimeStatistics_(false),
-    staticCompilation_(true), traceFileNameSetByUser_(false), outputStream_(0),
+    staticCompilation_(true), blockCountersOnly_(false),
+    traceFileNameSetByUser_(false), outputStream_(0),
     memoryAccessTracking_(false), eventHandler_(NULL), lastRunCycleCount_(0),
     lastRunTime_(0.0), simulationTimeout_(0), leaveCompiledDirty_(false),
     memorySystem_(NULL), zeroFillMemoriesOnReset_(true) {
@@ -515,6 +518,41 @@ SimulatorFrontend::initializeDataMemories(
  
 }
 
+/**
+ * Loads a memory image file to a data memory of the simulated machine.
+ *
+ * The image overrides the initialization data of the program. It is lost
+ * if the data memories are initialized again, that is, when a new program
+ * is loaded.
+ *
+ * @param addressSpaceName The name of the address space of the memory.
+ * @param offset Offset of the image from the start of the address space,
+ *               in MAUs.
+ * @param fileName The image file.
+ * @param format The format of the image file.
+ * @param mausPerLine Width of the memory lines of the image in MAUs.
+ * @return The number of loaded MAUs.
+ * @exception IllegalMachine If no machine is loaded.
+ * @exception InstanceNotFound If there is no memory for the address space.
+ * @exception IOException If the image file could not be read.
+ * @exception OutOfRange If the image does not fit in the address space or
+ *                       the MAU or line width is not supported.
+ */
+std::size_t
+SimulatorFrontend::loadMemoryImage(
+    const std::string& addressSpaceName, Word offset,
+    const std::string& fileName, MemorySystem::ImageFormat format,
+    int mausPerLine) {
+
+    if (memorySystem_ == NULL) {
+        throw IllegalMachine(
+            __FILE__, __LINE__, __func__,
+            "No machine loaded for memory image loading.");
+    }
+    return memorySystem_->loadImage(
+        addressSpaceName, offset, fileName, format, mausPerLine);
+}
+
 /**
  * Loads a new machine to be simulated from an ADF file.
  *
@@ -1409,13 +1447,20 @@ SimulatorFrontend::stoppedByUser() const {
  * In case no traces are enabled, this method does nothing. Making
  * multiple calls to this method is not harmful.
  *
+ * With binary tracing, the execution, procedure transfer and bus traces
+ * are written to a binary file next to the trace database (the name of
+ * the database with ".bin" appended). The trace database then stores only
+ * the statistics collected at the end of the simulation. The binary trace
+ * can be stored in the database afterwards with ttatraceconv.
+ *
  * @exception IOException In case trace database file could not be accessed.
  */
 void
 SimulatorFrontend::initializeTracing() {
+    const bool binaryBusTracing = binaryTracing_ && busTracing_;
     if (executionTracing_ || rfAccessTracing_ || 
         procedureTransferTracing_ || saveProfileData_ || 
-        saveUtilizationData_) {
+        saveUtilizationData_ || binaryBusTracing) {
 
         // initialize the data base
         if (traceDB_ == NULL) {
@@ -1439,10 +1484,28 @@ SimulatorFrontend::initializeTracing() {
             /// @note May throw IOException.
             traceDB_ = ExecutionTrace::open(traceFileName_);
         }
+        if (!binaryTracing_ && 
+            (executionTracing_ || procedureTransferTracing_)) {
+            // write the per cycle records in a thread of their own so 
+            // the simulation waits for disk only when the buffers fill up
+            traceDB_->startBackgroundWriter(
+                BackgroundTraceWriter::DEFAULT_BUFFER_SIZE, false);
+        }
+        if (binaryTracing_ && binaryTrace_ == NULL &&
+            (executionTracing_ || procedureTransferTracing_ ||
+             busTracing_)) {
+            /// @note May throw IOException.
+            binaryTrace_ = new BinaryTraceWriter(traceFileName_ + ".bin");
+        }
         if (executionTracing_ && executionTracker_ == NULL) {
             assert(simCon_ != NULL);
             assert(traceDB_ != NULL);
-            executionTracker_ = new ExecutionTracker(*simCon_, *traceDB_);
+            if (binaryTrace_ != NULL) {
+                executionTracker_ = 
+                    new ExecutionTracker(*simCon_, *binaryTrace_);
+            } else {
+                executionTracker_ = new ExecutionTracker(*simCon_, *traceDB_);
+            }
         }
 
         if (rfAccessTracing_) {
@@ -1451,11 +1514,21 @@ SimulatorFrontend::initializeTracing() {
         }
         if (procedureTransferTracing_) {
             assert(traceDB_ != NULL);
-            procedureTransferTracker_ = new ProcedureTransferTracker(
-                *this, *traceDB_);
+            if (binaryTrace_ != NULL) {
+                procedureTransferTracker_ = new ProcedureTransferTracker(
+                    *this, *binaryTrace_);
+            } else {
+                procedureTransferTracker_ = new ProcedureTransferTracker(
+                    *this, *traceDB_);
+            }
         }
     }
 
+    if (binaryBusTracing && busTracker_ == NULL) {
+        assert(binaryTrace_ != NULL);
+        busTracker_ = new BusTracker(*this, *binaryTrace_);
+    }
+
     // For perfomance reasons bus trace is written directly to an ascii
     // output file instead of the trace database.
     if (busTracing_ && busTracker_ == NULL) {
@@ -1499,6 +1572,10 @@ SimulatorFrontend::finishSimulation() {
     executionTracker_ = NULL;
 
     if (traceDB_ != NULL) {
+        // write the buffered records before the statistics
+        traceDB_->stopBackgroundWriter();
+        reportBackgroundTraceWriting(*traceDB_);
+
         // flush the concurrent RF access trace data
         if (rfAccessTracing_) {
             assert(rfAccessTracker_ != NULL);
@@ -1645,11 +1722,47 @@ SimulatorFrontend::finishSimulation() {
     rfAccessTracker_ = NULL;
     delete procedureTransferTracker_;
     procedureTransferTracker_ = NULL;
+    // flushes the buffered records
+    delete binaryTrace_;
+    binaryTrace_ = NULL;
     delete utilizationStats_;
     utilizationStats_ = NULL;
 
 }
 
+/**
+ * Reports the trace records that were dropped, or that the simulation
+ * had to wait for, while writing the trace in the background.
+ *
+ * Lost records are always reported as a warning, the waits only with
+ * increased verbosity.
+ *
+ * @param traceDB The trace database.
+ */
+void
+SimulatorFrontend::reportBackgroundTraceWriting(
+    const ExecutionTrace& traceDB) const {
+
+    const BackgroundTraceWriter* writer = traceDB.backgroundWriter();
+    if (writer == NULL) {
+        return;
+    }
+    const std::size_t lost = 
+        writer->droppedRecords() + writer->failedRecords();
+    if (lost > 0) {
+        Application::warningStream()
+            << "warning: " << lost << " trace records were not written to "
+            << traceFileName_ << "." << std::endl;
+    }
+    if (writer->backpressuredRecords() > 0 &&
+        Application::verboseLevel() > Application::VERBOSE_LEVEL_DEFAULT) {
+        Application::logStream()
+            << "Simulation waited for the trace writer on "
+            << writer->backpressuredRecords() << " trace records."
+            << std::endl;
+    }
+}
+
 /**
  * Initializes the memory system according to the address spaces in the
  * loaded machine.
@@ -1755,6 +1868,16 @@ SimulatorFrontend::busTracing() const {
     return busTracing_;
 }
 
+/**
+ * Returns true in case the traces are written to a binary trace file.
+ *
+ * @return True in case binary tracing is enabled.
+ */
+bool
+SimulatorFrontend::binaryTracing() const {
+    return binaryTracing_;
+}
+
 /**
  * Returns true in case register file access tracing is enabled.
  *
@@ -1794,6 +1917,17 @@ SimulatorFrontend::utilizationDataSaving() const {
     return saveUtilizationData_;
 }
 
+/**
+ * Returns true if the compiled simulation counts only basic block
+ * executions.
+ *
+ * @return True if only the basic block execution counters are generated.
+ */
+bool
+SimulatorFrontend::blockCountersOnly() const {
+    return blockCountersOnly_;
+}
+
 /**
  * Returns true if the compiled simulation uses static compilation
  * 
@@ -1857,6 +1991,17 @@ SimulatorFrontend::setBusTracing(bool value) {
     busTracing_ = value;
 }
 
+/**
+ * Sets the binary tracing on or off.
+ *
+ * @param value Are the execution, procedure transfer and bus traces
+ *              written to a binary trace file.
+ */
+void
+SimulatorFrontend::setBinaryTracing(bool value) {
+    binaryTracing_ = value;
+}
+
 /**
  * Sets the register file access tracing on or off.
  *
@@ -1920,6 +2065,23 @@ SimulatorFrontend::setStaticCompilation(bool value) {
     staticCompilation_ = value;
 }
 
+/**
+ * Sets the compiled simulator to count only basic block executions.
+ *
+ * By default the generated code also counts the executions of each
+ * guarded move so that squashed moves are not included in the utilization
+ * statistics. When only the basic block executions are counted, guarded
+ * moves are assumed to be executed every time their basic block is.
+ *
+ * Has no effect when running interpretive simulation.
+ *
+ * @param value new value to be set
+ */
+void
+SimulatorFrontend::setBlockCountersOnly(bool value) {
+    blockCountersOnly_ = value;
+}
+
 /**
  * Returns the output stream
  * 
@@ -47,6 +47,7 @@
 #include "RemoteController.hh"
 #include "SimulatorConstants.hh"
 #include "BaseType.hh"
+#include "MemorySystem.hh"
 
 class SimValue;
 class StateData;
@@ -54,6 +55,7 @@ class MachineState;
 class POMDisassembler;
 class ExecutionTracker;
 class ExecutionTrace;
+class BinaryTraceWriter;
 class StopPointManager;
 class MemorySystem;
 class UtilizationStats;
@@ -157,17 +159,20 @@ public:
 
     bool executionTracing() const;
     bool busTracing() const;
+    bool binaryTracing() const;
     bool rfAccessTracing() const;
     bool procedureTransferTracing() const;
     bool profileDataSaving() const;
     bool utilizationDataSaving() const;
     bool staticCompilation() const;
+    bool blockCountersOnly() const;
 
     const RFAccessTracker& rfAccessTracker() const;
 
     void setCompiledSimulation(bool value);
     void setExecutionTracing(bool value);
     void setBusTracing(bool value);
+    void setBinaryTracing(bool value);
     void setRFAccessTracing(bool value);
     void setProcedureTransferTracing(bool value);
     void setProfileDataSaving(bool value);
@@ -175,6 +180,7 @@ public:
     void setTraceDBFileName(const std::string& fileName);
     void setTimeout(unsigned int value);
     void setStaticCompilation(bool value);
+    void setBlockCountersOnly(bool value);
     
     std::ostream& outputStream();
     void setOutputStream(std::ostream& stream);
@@ -253,11 +259,17 @@ public:
 
     void initializeDataMemories(const TTAMachine::AddressSpace* onlyOne=NULL);
 
+    std::size_t loadMemoryImage(
+        const std::string& addressSpaceName, Word offset,
+        const std::string& fileName, MemorySystem::ImageFormat format,
+        int mausPerLine = 1);
+
 protected:
     virtual void initializeSimulation();
 
     void initializeTracing();
     void initializeDisassembler() const;
+    void reportBackgroundTraceWriting(const ExecutionTrace& traceDB) const;
     void initializeMemorySystem();
     void setControllerForMemories(RemoteController* con);
     bool hasStopReason(StopReason reason) const;
@@ -301,6 +313,9 @@ protected:
     /// Is bus tracing, i.e., storing the values of buses in each
     /// clock cycle enabled.
     bool busTracing_;
+    /// Are the execution, procedure transfer and bus traces written to
+    /// a binary trace file instead of the trace database.
+    bool binaryTracing_;
     /// Is register file (concurrent) access tracking enabled.
     bool rfAccessTracing_;
     /// Is procedure transfer access tracking enabled.
@@ -313,6 +328,8 @@ protected:
     ExecutionTrace* traceDB_;
     /// Last produced execution trace database.
     ExecutionTrace* lastTraceDB_;
+    /// The binary trace file, used if binary tracing is enabled.
+    BinaryTraceWriter* binaryTrace_;
     /// The simple execution tracker for storing trace of executed 
     /// instructions.
     ExecutionTracker* executionTracker_;
@@ -340,6 +357,9 @@ protected:
     bool printSimulationTimeStatistics_;
     /// True if the compiled simulation should use static compilation
     bool staticCompilation_;
+    /// True if the compiled simulation should count only basic block
+    /// executions.
+    bool blockCountersOnly_;
     /// Flag that indicates is the trace file name set by user.
     bool traceFileNameSetByUser_;
     /// Default output stream
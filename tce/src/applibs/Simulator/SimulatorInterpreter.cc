@@ -60,6 +60,7 @@
 #include "CommandsCommand.hh"
 #include "SymbolAddressCommand.hh"
 #include "MemWriteCommand.hh"
+#include "MemImageCommand.hh"
 
 /**
  * Constructor.
@@ -105,6 +106,7 @@ SimulatorInterpreter::SimulatorInterpreter(
     addCustomCommand(new KillCommand());
     addCustomCommand(new MemDumpCommand());
     addCustomCommand(new MemWriteCommand());
+    addCustomCommand(new MemImageCommand());
     addCustomCommand(new WatchCommand());
     addCustomCommand(new CommandsCommand());
     addCustomCommand(new SymbolAddressCommand());
@@ -160,6 +160,31 @@ SimulatorTextGenerator::SimulatorTextGenerator() {
         "Read [size] in bytes is optional."
         );
 
+    addText(
+        Texts::TXT_INTERP_HELP_LOADIMAGE,
+        "Loads a data memory image generated by generatebits to memory "
+        "in large blocks\n\n"
+
+        "\tload_image [/a address_space_name] [/f format] [/w width] "
+        "filename [offset]\n\n"
+
+        "Parameter /a can be used to select the address space if there are "
+        "multiple address spaces in the target machine.\n\n"
+
+        "Parameter /f selects the format of the image: binary (default), "
+        "ascii or array. The MAUs of a binary image are packed bit by bit "
+        "starting from the most significant bit of the first byte.\n\n"
+
+        "Parameter /w gives the data memory width in MAUs the image was "
+        "generated with (generatebits -w), by default 1. The MAU order "
+        "that generatebits reverses on each line of little-endian data is "
+        "restored.\n\n"
+
+        "The image is loaded starting from [offset] MAUs from the start of "
+        "the address space, by default 0. The image is lost when a new "
+        "program is loaded."
+        );
+
     addText(
         Texts::TXT_CLI_ONLINE_HELP, 
         "The interactive simulation can be controlled by using "
@@ -294,6 +319,10 @@ SimulatorTextGenerator::SimulatorTextGenerator() {
 
         "Displays the total execution cycle count.\n\n"
 
+        "\tproc pc\n\n"
+
+        "Displays the address of the next instruction to execute.\n\n"
+
         "\tproc mapping\n\n"
 
         "Displays information of address spaces of the loaded processor.\n\n"
@@ -373,7 +402,14 @@ SimulatorTextGenerator::SimulatorTextGenerator() {
         "A watch stops the simulation whenever the given expression changes "
         "its value. Interpreter prompts for the expression after this command "
         "is entered. It is possible to add a condition to a watch, to control "
-        "when the simulator must stop with increased precision.\n\n");
+        "when the simulator must stop with increased precision.\n\n"
+
+        "\twatch read|write|access [/a address-space] first [last]\n\n"
+
+        "Creates a memory watch that stops the simulation when a load or "
+        "store touches the given address range. Memory watches are not "
+        "checked at every instruction, so they do not slow down the "
+        "simulation.\n\n");
 
     addText(
         Texts::TXT_INTERP_HELP_TBREAK,
@@ -444,6 +480,10 @@ SimulatorTextGenerator::SimulatorTextGenerator() {
     addText(Texts::TXT_INTERP_SETTING_BUSTRACE,             
             "Writing of the bus trace.");
 
+    addText(Texts::TXT_INTERP_SETTING_BINARYTRACE,             
+            "Writing of the execution, procedure transfer and bus traces "
+            "to a binary trace file.");
+
     addText(
         Texts::TXT_INTERP_SETTING_FU_CONFLICT_DETECTION,
         "Function unit resource conflict detection (disable for speedup).");
@@ -507,6 +547,11 @@ SimulatorTextGenerator::SimulatorTextGenerator() {
         Texts::TXT_STATIC_COMPILATION,
         "Use static compilation when running compiled simulation. ");
 
+    addText(
+        Texts::TXT_BLOCK_COUNTERS_ONLY,
+        "Count only basic block executions when running compiled simulation "
+        "(enable for speedup, guarded moves are counted as executed).");
+
     addText(Texts::TXT_STATUS_STOPPED, "Program stopped at address %d.");
     addText(Texts::TXT_STATUS_FINISHED, "Simulation finished.");            
     addText(
@@ -106,6 +106,8 @@ namespace Texts {
         ///< Help text for command "x" of the CLI.
         TXT_INTERP_HELP_LOADDATA,
         ///< Help text for command "load_data" of the CLI.
+        TXT_INTERP_HELP_LOADIMAGE,
+        ///< Help text for command "load_image" of the CLI.
         TXT_CLI_ONLINE_HELP, 
         ///< Online help text.
         TXT_CMD_LINE_HELP,
@@ -144,6 +146,7 @@ namespace Texts {
         ///< In case user tried to set a setting with illegal parameter.
         TXT_INTERP_SETTING_EXECTRACE,
         TXT_INTERP_SETTING_BUSTRACE,
+        TXT_INTERP_SETTING_BINARYTRACE,
         TXT_INTERP_SETTING_RFTRACKING,
         TXT_INTERP_SETTING_HISTORY_FILENAME,
         TXT_INTERP_SETTING_NEXT_INSTRUCTION_PRINTING,
@@ -157,6 +160,8 @@ namespace Texts {
         ///< Simulation timeout in seconds
         TXT_STATIC_COMPILATION,
         ///< Use static compilation when using compiled simulator
+        TXT_BLOCK_COUNTERS_ONLY,
+        ///< Count only basic block executions in compiled simulator
         TXT_INTERP_HELP_COMMANDS_AVAILABLE,
         ///< Description of the execution trace setting.
         TXT_STATUS_STOPPED,
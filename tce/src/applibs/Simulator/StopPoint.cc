@@ -131,6 +131,7 @@ void
 StopPoint::setCondition(const ConditionScript& condition) {
     conditional_ = true;
     condition_ = condition.copy();
+    nativeCondition_.reset();
 }
 
 /**
@@ -143,6 +144,7 @@ StopPoint::removeCondition() {
     conditional_ = false;
     delete condition_;
     condition_ = NULL;
+    nativeCondition_.reset();
 }
 
 /**
@@ -174,6 +176,31 @@ StopPoint::isConditional() const {
     return conditional_;
 }
 
+/**
+ * Sets the native version of the current condition of the stop point.
+ *
+ * The native condition is evaluated instead of the condition script until
+ * the condition is changed or removed.
+ *
+ * @param condition The compiled condition, must give the same value as the
+ *                  condition script.
+ */
+void
+StopPoint::setNativeCondition(NativeExpression::Pointer condition) {
+    nativeCondition_ = condition;
+}
+
+/**
+ * Tells whether the native version of the condition is evaluated instead
+ * of the condition script.
+ *
+ * @return True if the stop point has a native condition.
+ */
+bool
+StopPoint::hasNativeCondition() const {
+    return nativeCondition_.get() != NULL;
+}
+
 /**
  * Sets the number of times the condition for firing the stop point is
  * to be disabled before enabling it.
@@ -217,6 +244,9 @@ StopPoint::isConditionOK() {
     if (conditional_) {
         assert(condition_ != NULL);
         try {
+            if (nativeCondition_) {
+                return nativeCondition_->value() != 0;
+            }
             return condition_->conditionOk();
         } catch (const Exception& e) {
             Application::logStream() 
@@ -36,6 +36,7 @@
 #include "ConditionScript.hh"
 #include "SimulatorConstants.hh"
 #include "BaseType.hh"
+#include "NativeExpression.hh"
 
 class SimulationController;
 class SimulationEventHandler;
@@ -68,6 +69,8 @@ public:
     virtual void removeCondition();
     virtual const ConditionScript& condition() const;
     virtual bool isConditional() const;
+    virtual void setNativeCondition(NativeExpression::Pointer condition);
+    virtual bool hasNativeCondition() const;
 
     virtual void setIgnoreCount(unsigned int count);
     virtual unsigned int ignoreCount() const;
@@ -92,6 +95,9 @@ protected:
     /// The condition which is used to determine whether the breakpoint
     /// should be fired or not.
     ConditionScript* condition_;
+    /// The condition compiled to native code, evaluated instead of the
+    /// condition script if set.
+    NativeExpression::Pointer nativeCondition_;
     /// The number of times the condition is to be ignored before enabling
     /// the breakpoint.
     unsigned int ignoreCount_;
@@ -40,12 +40,19 @@
 #include "SimulationController.hh"
 #include "MapTools.hh"
 #include "Application.hh"
+#include "Breakpoint.hh"
+#include "Watch.hh"
+#include "MemoryWatch.hh"
+#include "NativeExpression.hh"
 
 using std::string;
 using std::vector;
 using std::map;
 using std::make_pair;
 
+/// Breakpoints at higher addresses are not stored in the address index.
+static const InstructionAddress MAX_INDEXED_ADDRESS = 1 << 24;
+
 
 /**
  * Constructor.
@@ -56,7 +63,9 @@ using std::make_pair;
 StopPointManager::StopPointManager(
     TTASimulationController& controller, 
     SimulationEventHandler& eventHandler) :
-    handleCount_(0), lastStopCycle_(0), controller_(controller),
+    handleCount_(0), unindexedStopPoints_(0), memoryWatchTriggered_(false),
+    lastStopCycle_(0),
+    controller_(controller),
     eventHandler_(eventHandler) {
 }
 
@@ -65,6 +74,13 @@ StopPointManager::StopPointManager(
  * Destructor.
  */
 StopPointManager::~StopPointManager() {
+    for (StopPointIndex::iterator i = stopPoints_.begin();
+         i != stopPoints_.end(); ++i) {
+        MemoryWatch* watch = dynamic_cast<MemoryWatch*>((*i).second);
+        if (watch != NULL) {
+            watch->memory()->removeWatch((*i).first);
+        }
+    }
     MapTools::deleteAllValues(stopPoints_);
 }
 
@@ -88,6 +104,16 @@ StopPointManager::add(const StopPoint& stopPoint) {
     handles_.push_back(handleCount_);
 
     toAdd->setEnabled(true);
+    compileNativeExpressions(*toAdd);
+    updateAddressIndex();
+
+    MemoryWatch* memoryWatch = dynamic_cast<MemoryWatch*>(toAdd);
+    if (memoryWatch != NULL) {
+        memoryWatch->memory()->addWatch(
+            handleCount_, memoryWatch->firstAddress(),
+            memoryWatch->lastAddress(), memoryWatch->watchesReads(),
+            memoryWatch->watchesWrites(), *this);
+    }
 
     if (stopPoints_.size() == 1) {
         // this is the first added stop point, enable event
@@ -119,8 +145,14 @@ StopPointManager::deleteStopPoint(unsigned int handle) {
         }
     }
 
+    MemoryWatch* memoryWatch = dynamic_cast<MemoryWatch*>(stopPoint);
+    if (memoryWatch != NULL) {
+        memoryWatch->memory()->removeWatch(handle);
+    }
+
     delete stopPoint;
     stopPoint = NULL;
+    updateAddressIndex();
 
     if (stopPoints_.size() == 0) {
         // this was the last stop point, disable event listening
@@ -295,7 +327,9 @@ StopPointManager::setIgnore(unsigned int handle, unsigned int count) {
 void
 StopPointManager::setCondition(
     unsigned int handle, const ConditionScript& condition) {
-    findStopPoint(handle)->setCondition(condition);
+    StopPoint* stopPoint = findStopPoint(handle);
+    stopPoint->setCondition(condition);
+    compileNativeExpressions(*stopPoint);
 }
 
 /**
@@ -330,6 +364,61 @@ StopPointManager::findStopPoint(unsigned int handle) {
     }
 }
 
+/**
+ * Compiles the condition and the watched expression of the stop point to
+ * native code, if possible.
+ *
+ * The scripts that cannot be compiled are evaluated with Tcl as before.
+ *
+ * @param stopPoint The stop point.
+ */
+void
+StopPointManager::compileNativeExpressions(StopPoint& stopPoint) {
+    SimulatorFrontend& frontend = controller_.frontend();
+    if (stopPoint.isConditional() &&
+        !stopPoint.condition().script().empty()) {
+        stopPoint.setNativeCondition(
+            NativeExpression::compile(
+                stopPoint.condition().script().at(0), frontend));
+    }
+    Watch* watch = dynamic_cast<Watch*>(&stopPoint);
+    if (watch != NULL && !watch->expression().script().empty()) {
+        watch->setNativeExpression(
+            NativeExpression::compileCommand(
+                watch->expression().script().at(0), frontend));
+    }
+}
+
+/**
+ * Rebuilds the index of the breakpoint addresses.
+ *
+ * The index lets handleEvent() skip the instructions without breakpoints
+ * when all stop points are breakpoints.
+ */
+void
+StopPointManager::updateAddressIndex() {
+    breakpointAddresses_.clear();
+    unindexedStopPoints_ = 0;
+    for (StopPointIndex::const_iterator i = stopPoints_.begin();
+         i != stopPoints_.end(); ++i) {
+        if (dynamic_cast<const MemoryWatch*>((*i).second) != NULL) {
+            // memory watches are triggered by the memory accesses
+            continue;
+        }
+        const Breakpoint* breakpoint =
+            dynamic_cast<const Breakpoint*>((*i).second);
+        if (breakpoint == NULL ||
+            breakpoint->address() >= MAX_INDEXED_ADDRESS) {
+            ++unindexedStopPoints_;
+            continue;
+        }
+        if (breakpoint->address() >= breakpointAddresses_.size()) {
+            breakpointAddresses_.resize(breakpoint->address() + 1, false);
+        }
+        breakpointAddresses_[breakpoint->address()] = true;
+    }
+}
+
 /**
  * Returns the handle of a stop causing stop point with given index in the
  * container of stop causing stop points.
@@ -366,7 +455,8 @@ StopPointManager::stopCausingStopPoint(unsigned int index) const {
  */
 unsigned int 
 StopPointManager::stopCausingStopPointCount() const {
-    if (lastStopCycle_ != controller_.clockCount()) {
+    if (lastStopCycle_ != controller_.clockCount() &&
+        !memoryWatchTriggered_) {
         return 0;
     }
     std::size_t count = 0;
@@ -378,6 +468,90 @@ StopPointManager::stopCausingStopPointCount() const {
     return count;        
 }
 
+/**
+ * Decides whether a triggered stop point stops the simulation.
+ *
+ * Takes care of the ignore count, the condition and the disabling of the
+ * stop point.
+ *
+ * @param stopPoint The triggered stop point.
+ * @return True if the simulation should stop.
+ */
+bool
+StopPointManager::isStopping(StopPoint& stopPoint) {
+    if (stopPoint.ignoreCount() == 0 && stopPoint.isConditionOK()) {
+        if (controller_.stopReasonCount() == 0) {
+            // the first stop request of the run, forget the memory watches
+            // that stopped the previous run
+            clearMemoryWatchTriggers();
+        }
+        controller_.prepareToStop(SRE_BREAKPOINT);
+        lastStopCycle_ = controller_.clockCount();
+        if (stopPoint.isDisabledAfterTriggered()) {
+            stopPoint.setEnabled(false);
+        }
+        return true;
+    } else if (stopPoint.isConditionOK()) {
+        // decrease the ignore count only if the (possible) condition
+        // of the breakpoint is also true
+        stopPoint.decreaseIgnoreCount();
+    }
+    return false;
+}
+
+/**
+ * Clears the triggered status of the memory watches.
+ */
+void
+StopPointManager::clearMemoryWatchTriggers() {
+    if (!memoryWatchTriggered_) {
+        return;
+    }
+    for (StopPointIndex::iterator i = stopPoints_.begin();
+         i != stopPoints_.end(); ++i) {
+        MemoryWatch* watch = dynamic_cast<MemoryWatch*>((*i).second);
+        if (watch != NULL) {
+            watch->setTriggered(false);
+        }
+    }
+    memoryWatchTriggered_ = false;
+}
+
+/**
+ * Stops simulation if the memory watch with the given handle requests it.
+ *
+ * Called by the watched memory when an access touches the watched range.
+ * Accesses made while the simulation is not running, for example by the
+ * memory commands of the user interface, are ignored.
+ *
+ * @param handle The handle of the memory watch.
+ */
+void
+StopPointManager::memoryWatchTriggered(
+    unsigned int handle, Word, int, bool) {
+
+    if (controller_.state() != TTASimulationController::STA_RUNNING) {
+        return;
+    }
+    StopPointIndex::iterator found = stopPoints_.find(handle);
+    if (found == stopPoints_.end()) {
+        return;
+    }
+    MemoryWatch& watch = dynamic_cast<MemoryWatch&>(*(*found).second);
+    if (!watch.isEnabled() ||
+        (watch.isTriggered() && lastStopCycle_ == controller_.clockCount())) {
+        // disabled or already stopped by another MAU of the same access
+        return;
+    }
+    if (isStopping(watch)) {
+        watch.setTriggered(true);
+        memoryWatchTriggered_ = true;
+        if (watch.isDeletedAfterTriggered()) {
+            deleteStopPoint(handle);
+        }
+    }
+}
+
 
 /**
  * Stops simulation if there is at least one stop point requesting it.
@@ -387,6 +561,15 @@ StopPointManager::stopCausingStopPointCount() const {
 void
 StopPointManager::handleEvent() {
 
+    if (unindexedStopPoints_ == 0) {
+        // only breakpoints, nothing to do unless one of them is at the
+        // new instruction address
+        InstructionAddress pc = controller_.programCounter();
+        if (pc >= breakpointAddresses_.size() || !breakpointAddresses_[pc]) {
+            return;
+        }
+    }
+
     // find all the stop points watching the new instruction address
     StopPointIndex::iterator i = stopPoints_.begin();
     HandleContainer toBeDeletedStopPoints;
@@ -394,25 +577,13 @@ StopPointManager::handleEvent() {
         
         StopPoint& stopPoint = *(*i).second;
         const int handle = (*i).first;
-        if (stopPoint.isEnabled() && stopPoint.isTriggered()) {
+        if (stopPoint.isEnabled() && stopPoint.isTriggered() &&
+            dynamic_cast<MemoryWatch*>(&stopPoint) == NULL) {
             // we found a stop point that is triggered at this clock cycle
 
-            if (stopPoint.ignoreCount() == 0 && stopPoint.isConditionOK()) {
-
-                controller_.prepareToStop(SRE_BREAKPOINT);
-                lastStopCycle_ = controller_.clockCount();
-                if (stopPoint.isDisabledAfterTriggered()) {
-                    stopPoint.setEnabled(false);
-                }
-
-                if (stopPoint.isDeletedAfterTriggered()) {
-                    toBeDeletedStopPoints.push_back(handle);
-                }
-                
-            } else if (stopPoint.isConditionOK()) {
-                // decrease the ignore count only if the (possible) condition
-                // of the breakpoint is also true
-                stopPoint.decreaseIgnoreCount();
+            if (isStopping(stopPoint) &&
+                stopPoint.isDeletedAfterTriggered()) {
+                toBeDeletedStopPoints.push_back(handle);
             }
         }
         ++i;
@@ -40,6 +40,7 @@
 #include "StopPoint.hh"
 #include "SimulatorConstants.hh"
 #include "Listener.hh"
+#include "Memory.hh"
 
 class TTASimulationController;
 class SimulationEventHandler;
@@ -47,7 +48,7 @@ class SimulationEventHandler;
 /**
  * Keeps book of user-set simulation stop points.
  */
-class StopPointManager : public Listener {
+class StopPointManager : public Listener, public MemoryWatchListener {
 public:
     StopPointManager(
         TTASimulationController& controller, 
@@ -80,6 +81,8 @@ public:
     unsigned int stopCausingStopPointCount() const;
 
     void handleEvent();
+    virtual void memoryWatchTriggered(
+        unsigned int handle, Word address, int count, bool write);
 
 private:
     /// The breakpoint storage.
@@ -88,6 +91,10 @@ private:
     typedef std::vector<unsigned int> HandleContainer;
 
     StopPoint* findStopPoint(unsigned int handle);
+    void compileNativeExpressions(StopPoint& stopPoint);
+    void updateAddressIndex();
+    bool isStopping(StopPoint& stopPoint);
+    void clearMemoryWatchTriggers();
 
     /// The stop points.
     StopPointIndex stopPoints_;
@@ -95,6 +102,14 @@ private:
     HandleContainer handles_;
     /// Represents the next free handle.
     unsigned int handleCount_;
+    /// Tells for each instruction address whether there is a breakpoint
+    /// at it.
+    std::vector<bool> breakpointAddresses_;
+    /// The count of stop points that are not in the address index and must
+    /// be checked at every instruction.
+    std::size_t unindexedStopPoints_;
+    /// Tells whether a memory watch may be marked as triggered.
+    bool memoryWatchTriggered_;
     /// The clock cycle in which simulation was stopped last.
     ClockCycleCount lastStopCycle_;
     /// The simulation controller to use to stop the simulation.
@@ -49,7 +49,8 @@ Watch::Watch(
     const SimulatorFrontend& frontend, 
     const ExpressionScript& expression) :
     StopPoint(), expression_(expression), frontend_(frontend),
-    isTriggered_(false), lastCheckedCycle_(0) {
+    isTriggered_(false), lastCheckedCycle_(0), hasLastValue_(false),
+    lastValue_(0) {
 }
 
 /**
@@ -97,6 +98,53 @@ Watch::expression() const {
 void
 Watch::setExpression(const ExpressionScript& expression) {
     expression_ = expression;
+    nativeExpression_.reset();
+}
+
+/**
+ * Sets the native version of the watched expression.
+ *
+ * The native expression is evaluated instead of the expression script
+ * until the expression is changed. Its current value is the value the
+ * later values are compared to.
+ *
+ * @param expression The compiled expression, must give the same value as
+ *                   the expression script.
+ */
+void
+Watch::setNativeExpression(NativeExpression::Pointer expression) {
+    nativeExpression_ = expression;
+    hasLastValue_ = false;
+    if (nativeExpression_) {
+        try {
+            lastValue_ = nativeExpression_->value();
+            hasLastValue_ = true;
+        } catch (const Exception&) {
+        }
+    }
+}
+
+/**
+ * Tells whether the native version of the watched expression is evaluated
+ * instead of the expression script.
+ *
+ * @return True if the watch has a native expression.
+ */
+bool
+Watch::hasNativeExpression() const {
+    return nativeExpression_.get() != NULL;
+}
+
+/**
+ * Evaluates the native expression and tells whether its value changed.
+ */
+bool
+Watch::nativeResultChanged() const {
+    long long value = nativeExpression_->value();
+    bool changed = hasLastValue_ && value != lastValue_;
+    lastValue_ = value;
+    hasLastValue_ = true;
+    return changed;
 }
 
 /**
@@ -112,7 +160,8 @@ Watch::isTriggered() const {
         // simulation clock has changed since the last expression check,
         // let's see if the watch expression value has changed
         try {
-            isTriggered_ = expression_.resultChanged();
+            isTriggered_ = nativeExpression_ ?
+                nativeResultChanged() : expression_.resultChanged();
         } catch (const Exception&) {
             // for example simulation might not be initialized in every
             // check so the script throws, we'll assume that no triggering
@@ -58,8 +58,12 @@ public:
 
     virtual const ExpressionScript& expression() const;
     virtual void setExpression(const ExpressionScript& expression);
+    virtual void setNativeExpression(NativeExpression::Pointer expression);
+    virtual bool hasNativeExpression() const;
 
 private:
+    bool nativeResultChanged() const;
+
     /// Static copying not allowed (should use copy()).
     Watch(const Watch& source);
     /// The expression that is watched.
@@ -72,6 +76,13 @@ private:
     /// The simulation clock cycle in which the expression was checked the
     /// last time.
     mutable ClockCycleCount lastCheckedCycle_;
+    /// The expression compiled to native code, evaluated instead of the
+    /// expression script if set.
+    NativeExpression::Pointer nativeExpression_;
+    /// Tells whether lastValue_ holds a valid value.
+    mutable bool hasLastValue_;
+    /// The value of the native expression in the previous check.
+    mutable long long lastValue_;
 };
 
 #endif
@@ -39,6 +39,8 @@
 #include "Breakpoint.hh"
 #include "ExpressionScript.hh"
 #include "Watch.hh"
+#include "MemoryWatch.hh"
+#include "StringTools.hh"
 
 #include <iostream>
 
@@ -65,14 +67,19 @@ WatchCommand::~WatchCommand() {
  * value. It is possible to add a condition to  a watch, to control when 
  * the Simulator must stop with increased precision. 
  *
- * @param arguments None. The expression is queried from the user.
+ * With arguments, creates a memory watch that stops the simulation when
+ * a load or a store touches the given address range.
+ *
+ * @param arguments None, in which case the expression is queried from the
+ *                  user, or read|write|access [/a address space] first
+ *                  address [last address].
  * @return True in case simulation is initialized and arguments are ok.
  * @exception NumberFormatException Is never thrown by this command.
  */
 bool
 WatchCommand::execute(const std::vector<DataObject>& arguments) {
-    if (!checkArgumentCount(arguments.size() - 1, 0, 0)) {
-        return false;
+    if (arguments.size() > 1) {
+        return addMemoryWatch(arguments);
     }
 
     ExpressionScript expression(NULL, "");
@@ -87,6 +94,77 @@ WatchCommand::execute(const std::vector<DataObject>& arguments) {
     return printBreakpointInfo(stopPointManager.add(watch));
 }
 
+/**
+ * Creates a memory watch.
+ *
+ * @param arguments read|write|access [/a address space] first address
+ *                  [last address].
+ * @return True in case the watch was created.
+ */
+bool
+WatchCommand::addMemoryWatch(const std::vector<DataObject>& arguments) {
+    const int argumentCount = arguments.size() - 1;
+    if (!checkArgumentCount(argumentCount, 2, 5) || !checkProgramLoaded()) {
+        return false;
+    }
+
+    const std::string kind =
+        StringTools::stringToLower(arguments.at(1).stringValue());
+    const bool reads = kind == "read" || kind == "access";
+    const bool writes = kind == "write" || kind == "access";
+    if (!reads && !writes) {
+        interpreter()->setError(
+            SimulatorToolbox::textGenerator().text(
+                Texts::TXT_ILLEGAL_ARGUMENTS).str());
+        return false;
+    }
+
+    size_t nextArg = 2;
+    std::string addressSpaceName = "";
+    if (StringTools::ciEqual(arguments.at(nextArg).stringValue(), "/a")) {
+        if (argumentCount < 4) {
+            interpreter()->setError(
+                SimulatorToolbox::textGenerator().text(
+                    Texts::TXT_ILLEGAL_ARGUMENTS).str());
+            return false;
+        }
+        addressSpaceName = arguments.at(nextArg + 1).stringValue();
+        nextArg += 2;
+    }
+
+    std::size_t firstAddress = 0;
+    if (!setMemoryAddress(
+            arguments.at(nextArg).stringValue(), addressSpaceName,
+            firstAddress)) {
+        return false;
+    }
+    std::size_t lastAddress = firstAddress;
+    if (arguments.size() > nextArg + 1 &&
+        !setMemoryAddress(
+            arguments.at(nextArg + 1).stringValue(), addressSpaceName,
+            lastAddress)) {
+        return false;
+    }
+    if (arguments.size() > nextArg + 2 || lastAddress < firstAddress) {
+        interpreter()->setError(
+            SimulatorToolbox::textGenerator().text(
+                Texts::TXT_ILLEGAL_ARGUMENTS).str());
+        return false;
+    }
+
+    MemorySystem::MemoryPtr memory;
+    if (!setMemoryPointer(memory, addressSpaceName)) {
+        return false;
+    }
+
+    MemoryWatch watch(
+        memory, addressSpaceName, firstAddress, lastAddress, reads, writes);
+
+    StopPointManager& stopPointManager = 
+        simulatorFrontend().stopPointManager();
+    return printBreakpointInfo(stopPointManager.add(watch));
+}
+
 /**
  * Returns the help text for this command.
  * 
@@ -51,5 +51,8 @@ public:
 
     virtual bool execute(const std::vector<DataObject>& arguments);
     virtual std::string helpText() const;
+
+private:
+    bool addMemoryWatch(const std::vector<DataObject>& arguments);
 };
 #endif
@@ -0,0 +1,231 @@
+/*
+    Copyright (c) 2002-2026 Tampere University.
+
+    This file is part of TTA-Based Codesign Environment (TCE).
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+ */
+/**
+ * @file BackgroundTraceWriter.cc
+ *
+ * Definition of BackgroundTraceWriter class.
+ *
+ * @note rating: red
+ */
+
+#include <boost/bind.hpp>
+
+#include "BackgroundTraceWriter.hh"
+
+const std::size_t BackgroundTraceWriter::DEFAULT_BUFFER_SIZE = 1 << 16;
+
+/**
+ * Constructor.
+ *
+ * Starts the writer thread.
+ *
+ * @param traceDB The trace database to write to. Must stay alive until
+ *                the writer is stopped.
+ * @param bufferSize Count of records per buffer.
+ * @param dropWhenFull Drop the records that do not fit in a full buffer
+ *                     instead of waiting for the writer.
+ */
+BackgroundTraceWriter::BackgroundTraceWriter(
+    ExecutionTrace& traceDB, std::size_t bufferSize, bool dropWhenFull) :
+    traceDB_(traceDB), dropWhenFull_(dropWhenFull),
+    instructionExecutions_(bufferSize), procedureTransfers_(bufferSize),
+    writing_(false), stopping_(false), written_(0), dropped_(0),
+    backpressured_(0), failed_(0),
+    thread_(boost::bind(&BackgroundTraceWriter::run, this)) {
+}
+
+/**
+ * Destructor.
+ *
+ * Writes the buffered records and stops the writer thread.
+ */
+BackgroundTraceWriter::~BackgroundTraceWriter() {
+    stop();
+}
+
+/**
+ * Adds an instruction execution record to be written.
+ *
+ * @param record The record.
+ */
+void
+BackgroundTraceWriter::addInstructionExecution(
+    const ExecutionTrace::InstructionExecutionRecord& record) {
+    add(instructionExecutions_, record);
+}
+
+/**
+ * Adds a procedure transfer record to be written.
+ *
+ * @param record The record.
+ */
+void
+BackgroundTraceWriter::addProcedureTransfer(
+    const ExecutionTrace::ProcedureTransferRecord& record) {
+    add(procedureTransfers_, record);
+}
+
+/**
+ * Adds a record to a buffer.
+ *
+ * Waits for the writer, or drops the record, if the buffer is full.
+ *
+ * @param buffer The buffer.
+ * @param record The record.
+ */
+template <typename Record>
+void
+BackgroundTraceWriter::add(RingBuffer<Record>& buffer, const Record& record) {
+    boost::unique_lock<boost::mutex> lock(mutex_);
+    if (buffer.full()) {
+        if (dropWhenFull_) {
+            ++dropped_;
+            return;
+        }
+        ++backpressured_;
+        while (buffer.full()) {
+            spaceFreed_.wait(lock);
+        }
+    }
+    // the writer waits only when all the buffers are empty
+    const bool wakeWriter = buffersEmpty();
+    buffer.push(record);
+    if (wakeWriter) {
+        recordsAdded_.notify_one();
+    }
+}
+
+/**
+ * Waits until all the records added so far have been written.
+ */
+void
+BackgroundTraceWriter::flush() {
+    boost::unique_lock<boost::mutex> lock(mutex_);
+    while (!buffersEmpty() || writing_) {
+        batchWritten_.wait(lock);
+    }
+}
+
+/**
+ * Writes the buffered records and stops the writer thread.
+ *
+ * Records must not be added after stopping. Calling this more than once
+ * is not harmful.
+ */
+void
+BackgroundTraceWriter::stop() {
+    {
+        boost::lock_guard<boost::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    recordsAdded_.notify_one();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+/**
+ * Returns the count of records written to the database.
+ */
+std::size_t
+BackgroundTraceWriter::writtenRecords() const {
+    boost::lock_guard<boost::mutex> lock(mutex_);
+    return written_;
+}
+
+/**
+ * Returns the count of records dropped because of a full buffer.
+ */
+std::size_t
+BackgroundTraceWriter::droppedRecords() const {
+    boost::lock_guard<boost::mutex> lock(mutex_);
+    return dropped_;
+}
+
+/**
+ * Returns the count of records for which the simulation had to wait for
+ * space in a buffer.
+ */
+std::size_t
+BackgroundTraceWriter::backpressuredRecords() const {
+    boost::lock_guard<boost::mutex> lock(mutex_);
+    return backpressured_;
+}
+
+/**
+ * Returns the count of records that could not be written to the database.
+ */
+std::size_t
+BackgroundTraceWriter::failedRecords() const {
+    boost::lock_guard<boost::mutex> lock(mutex_);
+    return failed_;
+}
+
+/**
+ * Returns true if there are no buffered records. Expects the caller to
+ * hold the mutex.
+ */
+bool
+BackgroundTraceWriter::buffersEmpty() const {
+    return instructionExecutions_.empty() && procedureTransfers_.empty();
+}
+
+/**
+ * The main loop of the writer thread.
+ *
+ * Takes all buffered records at once and writes them outside of the
+ * lock so the simulation can fill the buffers meanwhile.
+ */
+void
+BackgroundTraceWriter::run() {
+    std::vector<ExecutionTrace::InstructionExecutionRecord> executions;
+    std::vector<ExecutionTrace::ProcedureTransferRecord> transfers;
+    while (true) {
+        {
+            boost::unique_lock<boost::mutex> lock(mutex_);
+            while (buffersEmpty() && !stopping_) {
+                recordsAdded_.wait(lock);
+            }
+            if (buffersEmpty()) {
+                return;
+            }
+            instructionExecutions_.popAll(executions);
+            procedureTransfers_.popAll(transfers);
+            writing_ = true;
+        }
+        spaceFreed_.notify_all();
+
+        const std::size_t failed =
+            traceDB_.writeInstructionExecutions(executions) +
+            traceDB_.writeProcedureTransfers(transfers);
+
+        {
+            boost::lock_guard<boost::mutex> lock(mutex_);
+            written_ += executions.size() + transfers.size() - failed;
+            failed_ += failed;
+            writing_ = false;
+        }
+        batchWritten_.notify_all();
+    }
+}
@@ -0,0 +1,148 @@
+/*
+    Copyright (c) 2002-2026 Tampere University.
+
+    This file is part of TTA-Based Codesign Environment (TCE).
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+ */
+/**
+ * @file BackgroundTraceWriter.hh
+ *
+ * Declaration of BackgroundTraceWriter class.
+ *
+ * @note rating: red
+ */
+
+#ifndef TTA_BACKGROUND_TRACE_WRITER_HH
+#define TTA_BACKGROUND_TRACE_WRITER_HH
+
+#include <vector>
+#include <cstddef>
+
+#include <boost/thread.hpp>
+
+#include "ExecutionTrace.hh"
+
+/**
+ * Writes the per cycle records of an execution trace in a thread of
+ * its own.
+ *
+ * The simulation thread appends the records to bounded ring buffers,
+ * one per record type, and the writer thread moves them to the trace
+ * database in batches. The simulation thread waits only when a buffer
+ * is full. Alternatively the records that do not fit in the buffer can
+ * be dropped. Both cases are counted so they can be reported.
+ */
+class BackgroundTraceWriter {
+public:
+    /// Default count of records per buffer.
+    static const std::size_t DEFAULT_BUFFER_SIZE;
+
+    BackgroundTraceWriter(
+        ExecutionTrace& traceDB, 
+        std::size_t bufferSize = DEFAULT_BUFFER_SIZE,
+        bool dropWhenFull = false);
+    virtual ~BackgroundTraceWriter();
+
+    void addInstructionExecution(
+        const ExecutionTrace::InstructionExecutionRecord& record);
+    void addProcedureTransfer(
+        const ExecutionTrace::ProcedureTransferRecord& record);
+
+    void flush();
+    void stop();
+
+    std::size_t writtenRecords() const;
+    std::size_t droppedRecords() const;
+    std::size_t backpressuredRecords() const;
+    std::size_t failedRecords() const;
+
+private:
+    /**
+     * Fixed size FIFO of records.
+     */
+    template <typename Record>
+    class RingBuffer {
+    public:
+        RingBuffer(std::size_t capacity) :
+            records_(capacity), first_(0), size_(0) {}
+
+        bool empty() const { return size_ == 0; }
+        bool full() const { return size_ == records_.size(); }
+
+        void push(const Record& record) {
+            records_[(first_ + size_) % records_.size()] = record;
+            ++size_;
+        }
+
+        /// Moves all records in the buffer to the given vector.
+        void popAll(std::vector<Record>& records) {
+            records.clear();
+            for (std::size_t i = 0; i < size_; ++i) {
+                records.push_back(records_[(first_ + i) % records_.size()]);
+            }
+            first_ = (first_ + size_) % records_.size();
+            size_ = 0;
+        }
+    private:
+        std::vector<Record> records_;
+        std::size_t first_;
+        std::size_t size_;
+    };
+
+    bool buffersEmpty() const;
+    template <typename Record>
+    void add(RingBuffer<Record>& buffer, const Record& record);
+    void run();
+
+    /// The trace database the records are written to.
+    ExecutionTrace& traceDB_;
+    /// Drop the records that do not fit in a full buffer instead of
+    /// waiting for the writer.
+    bool dropWhenFull_;
+    /// Buffered instruction executions.
+    RingBuffer<ExecutionTrace::InstructionExecutionRecord> 
+    instructionExecutions_;
+    /// Buffered procedure transfers.
+    RingBuffer<ExecutionTrace::ProcedureTransferRecord> procedureTransfers_;
+    /// Protects the buffers, the flags and the counters.
+    mutable boost::mutex mutex_;
+    /// Signaled when records are added to empty buffers or stopping.
+    boost::condition_variable recordsAdded_;
+    /// Signaled when the writer has taken the records from the buffers.
+    boost::condition_variable spaceFreed_;
+    /// Signaled when the writer has written a batch.
+    boost::condition_variable batchWritten_;
+    /// Is the writer writing a batch.
+    bool writing_;
+    /// Has stop been requested.
+    bool stopping_;
+    /// Count of records written to the database.
+    std::size_t written_;
+    /// Count of records dropped because of full buffer.
+    std::size_t dropped_;
+    /// Count of records that had to wait for space in a buffer.
+    std::size_t backpressured_;
+    /// Count of records that could not be written to the database.
+    std::size_t failed_;
+    /// The writer thread.
+    boost::thread thread_;
+};
+
+#endif
@@ -0,0 +1,337 @@
+/*
+    Copyright (c) 2002-2026 Tampere University.
+
+    This file is part of TTA-Based Codesign Environment (TCE).
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+ */
+/**
+ * @file BinaryTraceReader.cc
+ *
+ * Definition of BinaryTraceReader class.
+ *
+ * @note rating: red
+ */
+
+#include <cstring>
+
+#include "BinaryTraceReader.hh"
+#include "BinaryTraceWriter.hh"
+#include "ExecutionTrace.hh"
+#include "SimValue.hh"
+#include "Conversion.hh"
+
+/**
+ * Constructor.
+ *
+ * Opens the trace file and checks its header.
+ *
+ * @param fileName Name of the binary trace file.
+ * @exception IOException If the file cannot be opened or it is not a
+ *                        binary trace of a supported version.
+ */
+BinaryTraceReader::BinaryTraceReader(const std::string& fileName) :
+    fileName_(fileName),
+    stream_(fileName.c_str(), std::ios::in | std::ios::binary),
+    position_(0) {
+
+    if (!stream_) {
+        throw IOException(
+            __FILE__, __LINE__, __func__,
+            "Unable to open binary trace file " + fileName + ".");
+    }
+
+    const std::string& magic = BinaryTraceWriter::MAGIC;
+    std::vector<char> header(magic.size() + 1);
+    stream_.read(&header[0], header.size());
+    if (!stream_ || std::memcmp(&header[0], magic.c_str(), header.size())) {
+        throw IOException(
+            __FILE__, __LINE__, __func__,
+            fileName + " is not a binary trace file.");
+    }
+    unsigned long long version = readUnsigned();
+    if (version != BinaryTraceWriter::FORMAT_VERSION) {
+        throw IOException(
+            __FILE__, __LINE__, __func__,
+            "Unsupported binary trace version " +
+            Conversion::toString(version) + " in " + fileName + ".");
+    }
+}
+
+/**
+ * Destructor.
+ */
+BinaryTraceReader::~BinaryTraceReader() {
+    stream_.close();
+}
+
+/**
+ * Stores all records of the binary trace in the given trace database.
+ *
+ * @param traceDB The trace database, open for writing.
+ * @return Count of the converted records.
+ * @exception IOException If the trace file is corrupted or writing the
+ *                        database failed.
+ */
+std::size_t
+BinaryTraceReader::convert(ExecutionTrace& traceDB) {
+
+    std::size_t converted = 0;
+    unsigned char type = 0;
+    std::size_t records = 0;
+    while (readBlock(type, records)) {
+        switch (type) {
+        case BinaryTraceWriter::BT_NAMES: {
+            for (std::size_t i = 0; i < records; ++i) {
+                std::size_t length = decodeUnsigned();
+                if (position_ + length > payload_.size()) {
+                    throw IOException(
+                        __FILE__, __LINE__, __func__,
+                        "Truncated name in " + fileName_ + ".");
+                }
+                names_.push_back(
+                    std::string(
+                        payload_.begin() + position_,
+                        payload_.begin() + position_ + length));
+                position_ += length;
+            }
+            break;
+        }
+        case BinaryTraceWriter::BT_INSTRUCTION_EXECUTION: {
+            std::vector<ClockCycleCount> cycles(records);
+            ClockCycleCount previousCycle = 0;
+            for (std::size_t i = 0; i < records; ++i) {
+                cycles[i] = decodeCycle(previousCycle);
+            }
+            long long previousAddress = 0;
+            for (std::size_t i = 0; i < records; ++i) {
+                traceDB.addInstructionExecution(
+                    cycles[i], decodeAddress(previousAddress));
+            }
+            converted += records;
+            break;
+        }
+        case BinaryTraceWriter::BT_PROCEDURE_TRANSFER: {
+            std::vector<ClockCycleCount> cycles(records);
+            std::vector<InstructionAddress> addresses(records);
+            std::vector<InstructionAddress> sources(records);
+            ClockCycleCount previousCycle = 0;
+            for (std::size_t i = 0; i < records; ++i) {
+                cycles[i] = decodeCycle(previousCycle);
+            }
+            long long previousAddress = 0;
+            for (std::size_t i = 0; i < records; ++i) {
+                addresses[i] = decodeAddress(previousAddress);
+            }
+            previousAddress = 0;
+            for (std::size_t i = 0; i < records; ++i) {
+                sources[i] = decodeAddress(previousAddress);
+            }
+            for (std::size_t i = 0; i < records; ++i) {
+                traceDB.addProcedureTransfer(
+                    cycles[i], addresses[i], sources[i],
+                    static_cast<ExecutionTrace::ProcedureEntryType>(
+                        decodeByte()));
+            }
+            converted += records;
+            break;
+        }
+        case BinaryTraceWriter::BT_BUS_ACTIVITY: {
+            std::vector<ClockCycleCount> cycles(records);
+            std::vector<unsigned long long> buses(records);
+            std::vector<unsigned long long> segments(records);
+            std::vector<unsigned char> flags(records);
+            ClockCycleCount previousCycle = 0;
+            for (std::size_t i = 0; i < records; ++i) {
+                cycles[i] = decodeCycle(previousCycle);
+            }
+            for (std::size_t i = 0; i < records; ++i) {
+                buses[i] = decodeUnsigned();
+            }
+            for (std::size_t i = 0; i < records; ++i) {
+                segments[i] = decodeUnsigned();
+            }
+            for (std::size_t i = 0; i < records; ++i) {
+                flags[i] = decodeByte();
+            }
+            SimValue value(64);
+            for (std::size_t i = 0; i < records; ++i) {
+                const bool squash = flags[i] & BinaryTraceWriter::BAF_SQUASH;
+                if (flags[i] & BinaryTraceWriter::BAF_DATA) {
+                    unsigned long long bits = decodeUnsigned();
+                    DoubleWord data = 0;
+                    std::memcpy(&data, &bits, sizeof(data));
+                    value = data;
+                    traceDB.addBusActivity(
+                        cycles[i], name(buses[i]), name(segments[i]),
+                        squash, value);
+                } else {
+                    traceDB.addBusActivity(
+                        cycles[i], name(buses[i]), name(segments[i]),
+                        squash);
+                }
+            }
+            converted += records;
+            break;
+        }
+        default:
+            // blocks of unknown types are skipped so that newer writers
+            // can add record types without breaking older converters
+            break;
+        }
+    }
+    return converted;
+}
+
+/**
+ * Reads the next block of the file to the payload buffer.
+ *
+ * @param type The type of the read block is stored here.
+ * @param records The count of records in the block is stored here.
+ * @return False if the end of file was reached.
+ * @exception IOException If the block is truncated or uses an unsupported
+ *                        encoding.
+ */
+bool
+BinaryTraceReader::readBlock(unsigned char& type, std::size_t& records) {
+    int typeByte = stream_.get();
+    if (typeByte == std::char_traits<char>::eof()) {
+        return false;
+    }
+    type = static_cast<unsigned char>(typeByte);
+    int flags = stream_.get();
+    if (flags != 0) {
+        throw IOException(
+            __FILE__, __LINE__, __func__,
+            "Unsupported block encoding in " + fileName_ + ".");
+    }
+    records = readUnsigned();
+    std::size_t size = readUnsigned();
+    payload_.resize(size);
+    if (size > 0) {
+        stream_.read(reinterpret_cast<char*>(&payload_[0]), size);
+    }
+    if (!stream_) {
+        throw IOException(
+            __FILE__, __LINE__, __func__,
+            "Truncated block in " + fileName_ + ".");
+    }
+    position_ = 0;
+    return true;
+}
+
+/**
+ * Reads a variable length integer directly from the file.
+ */
+unsigned long long
+BinaryTraceReader::readUnsigned() {
+    unsigned long long value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        int byte = stream_.get();
+        if (byte == std::char_traits<char>::eof()) {
+            break;
+        }
+        value |= static_cast<unsigned long long>(byte & 0x7f) << shift;
+        if ((byte & 0x80) == 0) {
+            return value;
+        }
+    }
+    throw IOException(
+        __FILE__, __LINE__, __func__,
+        "Corrupted binary trace file " + fileName_ + ".");
+}
+
+/**
+ * Decodes a variable length integer from the payload.
+ */
+unsigned long long
+BinaryTraceReader::decodeUnsigned() {
+    unsigned long long value = 0;
+    for (int shift = 0; shift < 64 && position_ < payload_.size();
+         shift += 7) {
+        unsigned char byte = payload_[position_++];
+        value |= static_cast<unsigned long long>(byte & 0x7f) << shift;
+        if ((byte & 0x80) == 0) {
+            return value;
+        }
+    }
+    throw IOException(
+        __FILE__, __LINE__, __func__,
+        "Corrupted block in " + fileName_ + ".");
+}
+
+/**
+ * Decodes a zigzag encoded integer from the payload.
+ */
+long long
+BinaryTraceReader::decodeSigned() {
+    unsigned long long value = decodeUnsigned();
+    return static_cast<long long>(value >> 1) ^ -static_cast<long long>(
+        value & 1);
+}
+
+/**
+ * Decodes a delta encoded cycle from the payload.
+ *
+ * @param previous The previous cycle of the column, updated.
+ */
+ClockCycleCount
+BinaryTraceReader::decodeCycle(ClockCycleCount& previous) {
+    previous += decodeSigned();
+    return previous;
+}
+
+/**
+ * Decodes a delta encoded instruction address from the payload.
+ *
+ * @param previous The previous address of the column, updated.
+ */
+InstructionAddress
+BinaryTraceReader::decodeAddress(long long& previous) {
+    previous += decodeSigned();
+    return static_cast<InstructionAddress>(previous);
+}
+
+/**
+ * Decodes a single byte from the payload.
+ */
+unsigned char
+BinaryTraceReader::decodeByte() {
+    if (position_ >= payload_.size()) {
+        throw IOException(
+            __FILE__, __LINE__, __func__,
+            "Corrupted block in " + fileName_ + ".");
+    }
+    return payload_[position_++];
+}
+
+/**
+ * Returns the name at the given dictionary index.
+ *
+ * @exception IOException If the name has not been defined.
+ */
+const std::string&
+BinaryTraceReader::name(unsigned long long index) const {
+    if (index >= names_.size()) {
+        throw IOException(
+            __FILE__, __LINE__, __func__,
+            "Undefined name index in " + fileName_ + ".");
+    }
+    return names_[index];
+}
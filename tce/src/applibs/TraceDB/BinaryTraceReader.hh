@@ -0,0 +1,77 @@
+/*
+    Copyright (c) 2002-2026 Tampere University.
+
+    This file is part of TTA-Based Codesign Environment (TCE).
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+ */
+/**
+ * @file BinaryTraceReader.hh
+ *
+ * Declaration of BinaryTraceReader class.
+ *
+ * @note rating: red
+ */
+
+#ifndef TTA_BINARY_TRACE_READER_HH
+#define TTA_BINARY_TRACE_READER_HH
+
+#include <string>
+#include <vector>
+#include <fstream>
+
+#include "SimulatorConstants.hh"
+#include "Exception.hh"
+
+class ExecutionTrace;
+
+/**
+ * Reads a binary trace written by BinaryTraceWriter and stores its
+ * records in an execution trace database.
+ */
+class BinaryTraceReader {
+public:
+    BinaryTraceReader(const std::string& fileName);
+    virtual ~BinaryTraceReader();
+
+    std::size_t convert(ExecutionTrace& traceDB);
+
+private:
+    bool readBlock(unsigned char& type, std::size_t& records);
+    unsigned long long decodeUnsigned();
+    long long decodeSigned();
+    ClockCycleCount decodeCycle(ClockCycleCount& previous);
+    InstructionAddress decodeAddress(long long& previous);
+    unsigned char decodeByte();
+    unsigned long long readUnsigned();
+    const std::string& name(unsigned long long index) const;
+
+    /// Name of the trace file.
+    std::string fileName_;
+    /// The trace file.
+    std::ifstream stream_;
+    /// The name dictionary read so far.
+    std::vector<std::string> names_;
+    /// Payload of the current block.
+    std::vector<unsigned char> payload_;
+    /// Read position in the payload of the current block.
+    std::size_t position_;
+};
+
+#endif
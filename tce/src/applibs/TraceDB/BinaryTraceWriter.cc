@@ -0,0 +1,405 @@
+/*
+    Copyright (c) 2002-2026 Tampere University.
+
+    This file is part of TTA-Based Codesign Environment (TCE).
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+ */
+/**
+ * @file BinaryTraceWriter.cc
+ *
+ * Definition of BinaryTraceWriter class.
+ *
+ * @note rating: red
+ */
+
+#include <cstring>
+
+#include "BinaryTraceWriter.hh"
+#include "Application.hh"
+
+const std::string BinaryTraceWriter::MAGIC = "TCEBTRC";
+const unsigned int BinaryTraceWriter::FORMAT_VERSION = 1;
+const std::size_t BinaryTraceWriter::BLOCK_RECORDS = 4096;
+
+/**
+ * Constructor.
+ *
+ * Creates the trace file and writes its header.
+ *
+ * @param fileName Name of the trace file. An existing file is overwritten.
+ * @exception IOException If the file cannot be opened for writing.
+ */
+BinaryTraceWriter::BinaryTraceWriter(const std::string& fileName) :
+    fileName_(fileName),
+    stream_(
+        fileName.c_str(),
+        std::ios::out | std::ios::binary | std::ios::trunc) {
+
+    if (!stream_) {
+        throw IOException(
+            __FILE__, __LINE__, __func__,
+            "Unable to open binary trace file " + fileName +
+            " for writing.");
+    }
+    stream_.write(MAGIC.c_str(), MAGIC.size() + 1);
+    payload_.clear();
+    encodeUnsigned(payload_, FORMAT_VERSION);
+    stream_.write(
+        reinterpret_cast<const char*>(&payload_[0]), payload_.size());
+    payload_.clear();
+}
+
+/**
+ * Destructor.
+ *
+ * Writes the buffered records to the file.
+ */
+BinaryTraceWriter::~BinaryTraceWriter() {
+    try {
+        flush();
+    } catch (const Exception& e) {
+        Application::writeToErrorLog(
+            __FILE__, __LINE__, __func__, e.errorMessage());
+    }
+    stream_.close();
+}
+
+/**
+ * Returns the dictionary index of a name, adding it if needed.
+ *
+ * The clients that write the same names repeatedly can look up the index
+ * once and use it in the records afterwards.
+ *
+ * @param name The name.
+ * @return The index of the name.
+ */
+unsigned int
+BinaryTraceWriter::nameIndex(const std::string& name) {
+    std::map<std::string, unsigned int>::const_iterator i =
+        nameIndices_.find(name);
+    if (i != nameIndices_.end()) {
+        return i->second;
+    }
+    unsigned int index = nameIndices_.size();
+    nameIndices_[name] = index;
+    newNames_.push_back(name);
+    return index;
+}
+
+/**
+ * Adds an instruction execution record.
+ *
+ * @param cycle The clock cycle on which the instruction was executed.
+ * @param address The address of the executed instruction.
+ * @exception IOException If a full block could not be written.
+ */
+void
+BinaryTraceWriter::addInstructionExecution(
+    ClockCycleCount cycle, InstructionAddress address) {
+    instructionExecutions_.cycles.push_back(cycle);
+    instructionExecutions_.addresses.push_back(address);
+    if (instructionExecutions_.cycles.size() >= BLOCK_RECORDS) {
+        flushInstructionExecutions();
+    }
+}
+
+/**
+ * Adds a procedure transfer record.
+ *
+ * @param cycle The clock cycle in which the transfer occured.
+ * @param address The instruction address to which the execution changed.
+ * @param sourceAddress The address of the call or the return.
+ * @param type Type of the transfer.
+ * @exception IOException If a full block could not be written.
+ */
+void
+BinaryTraceWriter::addProcedureTransfer(
+    ClockCycleCount cycle, InstructionAddress address,
+    InstructionAddress sourceAddress,
+    ExecutionTrace::ProcedureEntryType type) {
+    procedureTransfers_.cycles.push_back(cycle);
+    procedureTransfers_.addresses.push_back(address);
+    procedureTransfers_.sourceAddresses.push_back(sourceAddress);
+    procedureTransfers_.types.push_back(static_cast<unsigned char>(type));
+    if (procedureTransfers_.cycles.size() >= BLOCK_RECORDS) {
+        flushProcedureTransfers();
+    }
+}
+
+/**
+ * Adds a bus activity record.
+ *
+ * The value is stored as the 64 bit pattern TraceDB derives its integer
+ * and floating point columns from.
+ *
+ * @param cycle The clock cycle in which the bus activity happened.
+ * @param bus The dictionary index of the bus name.
+ * @param segment The dictionary index of the segment name.
+ * @param squash Whether the transfer was squashed or not.
+ * @param data The data transferred.
+ * @exception IOException If a full block could not be written.
+ */
+void
+BinaryTraceWriter::addBusActivity(
+    ClockCycleCount cycle, unsigned int bus, unsigned int segment,
+    bool squash, const SimValue& data) {
+
+    unsigned char flags = squash ? BAF_SQUASH : 0;
+    busActivity_.cycles.push_back(cycle);
+    busActivity_.buses.push_back(bus);
+    busActivity_.segments.push_back(segment);
+    if (!squash && &data != &NullSimValue::instance()) {
+        flags |= BAF_DATA;
+        DoubleWord value = data.doubleWordValue();
+        unsigned long long bits = 0;
+        std::memcpy(&bits, &value, sizeof(bits));
+        busActivity_.values.push_back(bits);
+    }
+    busActivity_.flags.push_back(flags);
+
+    if (busActivity_.cycles.size() >= BLOCK_RECORDS) {
+        flushBusActivity();
+    }
+}
+
+/**
+ * Adds a bus activity record.
+ *
+ * @param cycle The clock cycle in which the bus activity happened.
+ * @param busId The name of the bus.
+ * @param segmentId The name of the segment in the bus.
+ * @param squash Whether the transfer was squashed or not.
+ * @param data The data transferred.
+ * @exception IOException If a full block could not be written.
+ */
+void
+BinaryTraceWriter::addBusActivity(
+    ClockCycleCount cycle, const ExecutionTrace::BusID& busId,
+    const ExecutionTrace::SegmentID& segmentId, bool squash,
+    const SimValue& data) {
+    addBusActivity(
+        cycle, nameIndex(busId), nameIndex(segmentId), squash, data);
+}
+
+/**
+ * Writes all buffered records to the file.
+ *
+ * @exception IOException If writing failed.
+ */
+void
+BinaryTraceWriter::flush() {
+    flushInstructionExecutions();
+    flushProcedureTransfers();
+    flushBusActivity();
+    flushNames();
+    stream_.flush();
+    if (!stream_) {
+        throw IOException(
+            __FILE__, __LINE__, __func__,
+            "Error while writing binary trace file " + fileName_ + ".");
+    }
+}
+
+/**
+ * Writes the names added after the last dictionary block.
+ *
+ * Called before every data block so a reader always knows the names
+ * the block refers to.
+ */
+void
+BinaryTraceWriter::flushNames() {
+    if (newNames_.empty()) {
+        return;
+    }
+    payload_.clear();
+    for (std::size_t i = 0; i < newNames_.size(); ++i) {
+        const std::string& name = newNames_[i];
+        encodeUnsigned(payload_, name.size());
+        payload_.insert(payload_.end(), name.begin(), name.end());
+    }
+    writeBlock(BT_NAMES, newNames_.size());
+    newNames_.clear();
+}
+
+/**
+ * Writes the buffered instruction executions as one block.
+ */
+void
+BinaryTraceWriter::flushInstructionExecutions() {
+    const std::size_t records = instructionExecutions_.cycles.size();
+    if (records == 0) {
+        return;
+    }
+    payload_.clear();
+    encodeCycles(payload_, instructionExecutions_.cycles);
+    encodeAddresses(payload_, instructionExecutions_.addresses);
+    writeBlock(BT_INSTRUCTION_EXECUTION, records);
+    instructionExecutions_.cycles.clear();
+    instructionExecutions_.addresses.clear();
+}
+
+/**
+ * Writes the buffered procedure transfers as one block.
+ */
+void
+BinaryTraceWriter::flushProcedureTransfers() {
+    const std::size_t records = procedureTransfers_.cycles.size();
+    if (records == 0) {
+        return;
+    }
+    payload_.clear();
+    encodeCycles(payload_, procedureTransfers_.cycles);
+    encodeAddresses(payload_, procedureTransfers_.addresses);
+    encodeAddresses(payload_, procedureTransfers_.sourceAddresses);
+    payload_.insert(
+        payload_.end(), procedureTransfers_.types.begin(),
+        procedureTransfers_.types.end());
+    writeBlock(BT_PROCEDURE_TRANSFER, records);
+    procedureTransfers_.cycles.clear();
+    procedureTransfers_.addresses.clear();
+    procedureTransfers_.sourceAddresses.clear();
+    procedureTransfers_.types.clear();
+}
+
+/**
+ * Writes the buffered bus activity as one block.
+ */
+void
+BinaryTraceWriter::flushBusActivity() {
+    const std::size_t records = busActivity_.cycles.size();
+    if (records == 0) {
+        return;
+    }
+    flushNames();
+    payload_.clear();
+    encodeCycles(payload_, busActivity_.cycles);
+    for (std::size_t i = 0; i < records; ++i) {
+        encodeUnsigned(payload_, busActivity_.buses[i]);
+    }
+    for (std::size_t i = 0; i < records; ++i) {
+        encodeUnsigned(payload_, busActivity_.segments[i]);
+    }
+    payload_.insert(
+        payload_.end(), busActivity_.flags.begin(), busActivity_.flags.end());
+    for (std::size_t i = 0; i < busActivity_.values.size(); ++i) {
+        encodeUnsigned(payload_, busActivity_.values[i]);
+    }
+    writeBlock(BT_BUS_ACTIVITY, records);
+    busActivity_.cycles.clear();
+    busActivity_.buses.clear();
+    busActivity_.segments.clear();
+    busActivity_.flags.clear();
+    busActivity_.values.clear();
+}
+
+/**
+ * Writes the current payload to the file as a block.
+ *
+ * A block starts with its type, a flags byte (reserved for compressed
+ * payloads, always zero in this version), the count of records and the
+ * size of the payload in bytes.
+ *
+ * @param type Type of the block.
+ * @param records Count of records in the payload.
+ * @exception IOException If writing failed.
+ */
+void
+BinaryTraceWriter::writeBlock(BlockType type, std::size_t records) {
+    std::vector<unsigned char> header;
+    header.push_back(static_cast<unsigned char>(type));
+    header.push_back(0);
+    encodeUnsigned(header, records);
+    encodeUnsigned(header, payload_.size());
+    stream_.write(reinterpret_cast<const char*>(&header[0]), header.size());
+    stream_.write(
+        reinterpret_cast<const char*>(&payload_[0]), payload_.size());
+    if (!stream_) {
+        throw IOException(
+            __FILE__, __LINE__, __func__,
+            "Error while writing binary trace file " + fileName_ + ".");
+    }
+}
+
+/**
+ * Appends an unsigned integer to the buffer as a variable length integer.
+ *
+ * Seven bits are stored per byte, the highest bit tells whether more
+ * bytes follow.
+ *
+ * @param buffer The buffer.
+ * @param value The value to append.
+ */
+void
+BinaryTraceWriter::encodeUnsigned(
+    std::vector<unsigned char>& buffer, unsigned long long value) {
+    while (value >= 0x80) {
+        buffer.push_back(static_cast<unsigned char>(value | 0x80));
+        value >>= 7;
+    }
+    buffer.push_back(static_cast<unsigned char>(value));
+}
+
+/**
+ * Appends a signed integer to the buffer as a zigzag encoded variable
+ * length integer.
+ *
+ * @param buffer The buffer.
+ * @param value The value to append.
+ */
+void
+BinaryTraceWriter::encodeSigned(
+    std::vector<unsigned char>& buffer, long long value) {
+    encodeUnsigned(
+        buffer,
+        (static_cast<unsigned long long>(value) << 1) ^
+        static_cast<unsigned long long>(value >> 63));
+}
+
+/**
+ * Appends a column of cycles as differences to the previous cycle.
+ *
+ * The first cycle of a block is relative to zero so that each block can
+ * be decoded alone.
+ */
+void
+BinaryTraceWriter::encodeCycles(
+    std::vector<unsigned char>& buffer,
+    const std::vector<ClockCycleCount>& cycles) {
+    ClockCycleCount previous = 0;
+    for (std::size_t i = 0; i < cycles.size(); ++i) {
+        encodeSigned(buffer, cycles[i] - previous);
+        previous = cycles[i];
+    }
+}
+
+/**
+ * Appends a column of instruction addresses as differences to the
+ * previous address.
+ */
+void
+BinaryTraceWriter::encodeAddresses(
+    std::vector<unsigned char>& buffer,
+    const std::vector<InstructionAddress>& addresses) {
+    long long previous = 0;
+    for (std::size_t i = 0; i < addresses.size(); ++i) {
+        encodeSigned(buffer, static_cast<long long>(addresses[i]) - previous);
+        previous = addresses[i];
+    }
+}
@@ -0,0 +1,163 @@
+/*
+    Copyright (c) 2002-2026 Tampere University.
+
+    This file is part of TTA-Based Codesign Environment (TCE).
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+ */
+/**
+ * @file BinaryTraceWriter.hh
+ *
+ * Declaration of BinaryTraceWriter class.
+ *
+ * @note rating: red
+ */
+
+#ifndef TTA_BINARY_TRACE_WRITER_HH
+#define TTA_BINARY_TRACE_WRITER_HH
+
+#include <string>
+#include <vector>
+#include <map>
+#include <fstream>
+
+#include "ExecutionTrace.hh"
+#include "SimValue.hh"
+#include "SimulatorConstants.hh"
+#include "Exception.hh"
+
+/**
+ * Writes the high volume simulation traces to a compact binary file.
+ *
+ * The file is append-only and consists of a header followed by blocks.
+ * Each block stores up to BLOCK_RECORDS records of one event type in
+ * columnar form: all cycles of the block first, then all addresses, etc.
+ * Cycles and addresses are delta encoded and every value is stored as
+ * a variable length integer. Bus and segment names are stored once in
+ * dictionary blocks and referred to with their indices.
+ *
+ * The binary trace is converted to the TraceDB schema offline with
+ * BinaryTraceReader.
+ */
+class BinaryTraceWriter {
+public:
+    /// Types of the blocks in the binary trace file.
+    enum BlockType {
+        BT_NAMES = 1,                ///< name dictionary entries
+        BT_INSTRUCTION_EXECUTION = 2,///< executed instruction addresses
+        BT_PROCEDURE_TRANSFER = 3,   ///< procedure entries and exits
+        BT_BUS_ACTIVITY = 4          ///< bus values
+    };
+
+    /// Flags of a bus activity record.
+    enum BusActivityFlags {
+        BAF_SQUASH = 1,              ///< the transport was squashed
+        BAF_DATA = 2                 ///< the record carries a value
+    };
+
+    /// The identifier in the beginning of a binary trace file.
+    static const std::string MAGIC;
+    /// The version of the binary trace format.
+    static const unsigned int FORMAT_VERSION;
+    /// Maximum count of records in a block.
+    static const std::size_t BLOCK_RECORDS;
+
+    BinaryTraceWriter(const std::string& fileName);
+    virtual ~BinaryTraceWriter();
+
+    unsigned int nameIndex(const std::string& name);
+
+    void addInstructionExecution(
+        ClockCycleCount cycle, InstructionAddress address);
+
+    void addProcedureTransfer(
+        ClockCycleCount cycle, InstructionAddress address,
+        InstructionAddress sourceAddress,
+        ExecutionTrace::ProcedureEntryType type);
+
+    void addBusActivity(
+        ClockCycleCount cycle, unsigned int bus, unsigned int segment,
+        bool squash, const SimValue& data = NullSimValue::instance());
+
+    void addBusActivity(
+        ClockCycleCount cycle, const ExecutionTrace::BusID& busId,
+        const ExecutionTrace::SegmentID& segmentId, bool squash,
+        const SimValue& data = NullSimValue::instance());
+
+    void flush();
+
+    static void encodeUnsigned(
+        std::vector<unsigned char>& buffer, unsigned long long value);
+    static void encodeSigned(
+        std::vector<unsigned char>& buffer, long long value);
+
+private:
+    /// Buffered instruction execution records.
+    struct InstructionExecutionColumns {
+        std::vector<ClockCycleCount> cycles;
+        std::vector<InstructionAddress> addresses;
+    };
+    /// Buffered procedure transfer records.
+    struct ProcedureTransferColumns {
+        std::vector<ClockCycleCount> cycles;
+        std::vector<InstructionAddress> addresses;
+        std::vector<InstructionAddress> sourceAddresses;
+        std::vector<unsigned char> types;
+    };
+    /// Buffered bus activity records.
+    struct BusActivityColumns {
+        std::vector<ClockCycleCount> cycles;
+        std::vector<unsigned int> buses;
+        std::vector<unsigned int> segments;
+        std::vector<unsigned char> flags;
+        std::vector<unsigned long long> values;
+    };
+
+    void flushNames();
+    void flushInstructionExecutions();
+    void flushProcedureTransfers();
+    void flushBusActivity();
+    void writeBlock(BlockType type, std::size_t records);
+
+    static void encodeCycles(
+        std::vector<unsigned char>& buffer,
+        const std::vector<ClockCycleCount>& cycles);
+    static void encodeAddresses(
+        std::vector<unsigned char>& buffer,
+        const std::vector<InstructionAddress>& addresses);
+
+    /// Name of the trace file.
+    std::string fileName_;
+    /// The trace file.
+    std::ofstream stream_;
+    /// Indices of the names in the dictionary.
+    std::map<std::string, unsigned int> nameIndices_;
+    /// Names added to the dictionary after the last written block.
+    std::vector<std::string> newNames_;
+    /// Buffered instruction executions.
+    InstructionExecutionColumns instructionExecutions_;
+    /// Buffered procedure transfers.
+    ProcedureTransferColumns procedureTransfers_;
+    /// Buffered bus activity.
+    BusActivityColumns busActivity_;
+    /// Payload of the block being written.
+    std::vector<unsigned char> payload_;
+};
+
+#endif
@@ -37,6 +37,7 @@
 #include "ExecutionTrace.hh"
 #include "Conversion.hh"
 #include "InstructionExecution.hh"
+#include "BackgroundTraceWriter.hh"
 #include "FileSystem.hh"
 #include "SQLite.hh"
 #include "SimValue.hh"
@@ -105,6 +106,48 @@ const std::string CQ_TOTALS =
 "       value_name TEXT NOT NULL,"
 "       integer_value INTEGER);";
 
+/// data insertion queries (IQ), compiled once and executed with bindings
+
+const std::string IQ_INSTRUCTION_EXECUTION =
+"INSERT INTO instruction_execution(cycle, address) VALUES(?, ?);";
+
+const std::string IQ_PROCEDURE_ADDRESS_RANGE =
+"INSERT INTO procedure_address_range(first_address, last_address, "
+"procedure_name) VALUES(?, ?, ?);";
+
+const std::string IQ_BUS_ACTIVITY =
+"INSERT INTO bus_activity(cycle, bus, segment, squash, "
+"data_as_int, data_as_double) VALUES(?, ?, ?, ?, ?, ?);";
+
+const std::string IQ_CONCURRENT_REGISTER_FILE_ACCESS =
+"INSERT INTO concurrent_register_file_access("
+"register_file, reads, writes, count) VALUES(?, ?, ?, ?);";
+
+const std::string IQ_REGISTER_ACCESS =
+"INSERT INTO register_access("
+"register_file, register_index, reads, writes) VALUES(?, ?, ?, ?);";
+
+const std::string IQ_FU_OPERATION_TRIGGERS =
+"INSERT INTO fu_operation_triggers(function_unit, operation, count) "
+"VALUES(?, ?, ?);";
+
+const std::string IQ_SOCKET_WRITE_COUNTS =
+"INSERT INTO socket_write_counts(socket, writes) VALUES(?, ?);";
+
+const std::string IQ_BUS_WRITE_COUNTS =
+"INSERT INTO bus_write_counts(bus, writes) VALUES(?, ?);";
+
+const std::string IQ_TOTALS =
+"INSERT INTO totals(value_name, integer_value) VALUES(?, ?);";
+
+/// values of the squash column of bus_activity
+const std::string SQUASH_TRUE = "TRUE";
+const std::string SQUASH_FALSE = "FALSE";
+const std::string CYCLE_COUNT_VALUE_NAME = "cycle_count";
+
+/// the count of records after which the transaction is committed
+const std::size_t COMMIT_INTERVAL = 1 << 18;
+
 /// the version number of the database schema
 const int DB_VERSION = 1;
 
@@ -123,6 +166,8 @@ const int DB_VERSION = 1;
  * fileName.calls       The call trace, produced with 
  *                      'procedure_transfer_tracking' setting of ttasim 
  *                      (e.g. foobar.tpef.1.trace.calls).
+ *                      Opening a writable existing database appends
+ *                      to its call trace.
  * fileName.profile     The instruction execution counts, produced with
  *                      'profile_data_saving' setting of ttasim
  *                      (e.g. foobar.tpef.1.trace.profile).
@@ -180,16 +225,19 @@ ExecutionTrace::open() {
 ExecutionTrace::ExecutionTrace(const std::string& fileName, bool readOnly) : 
     fileName_(fileName), callTrace_(
         (fileName + ".calls").c_str(), 
-        (FileSystem::fileExists(fileName) || readOnly) ? 
-        std::fstream::in : 
-        std::fstream::out | std::fstream::trunc),
+        readOnly ? std::fstream::in :
+        (FileSystem::fileExists(fileName) ?
+         std::fstream::in | std::fstream::out | std::fstream::app :
+         std::fstream::out | std::fstream::trunc)),
     instructionProfile_(
         (fileName + ".profile").c_str(), 
         (FileSystem::fileExists(fileName) || readOnly) ? 
         std::fstream::in : 
         std::fstream::out | std::fstream::trunc),
     readOnly_(readOnly), db_(new SQLite()), 
-    dbConnection_(NULL), instructionExecution_(NULL)  {
+    dbConnection_(NULL), instructionExecution_(NULL),
+    backgroundWriter_(NULL), backgroundWriting_(false),
+    uncommittedRecords_(0) {
 }
 
 /**
@@ -202,11 +250,23 @@ ExecutionTrace::ExecutionTrace(const std::string& fileName, bool readOnly) :
 ExecutionTrace::~ExecutionTrace() {
 
     try {
+        // writes the records still in the buffers
+        delete backgroundWriter_;
+        backgroundWriter_ = NULL;
+        backgroundWriting_ = false;
+
         if (instructionExecution_ != NULL) {
             delete instructionExecution_;
             instructionExecution_ = NULL;
         }
 
+        // the compiled statements must be freed before closing
+        for (std::map<std::string, RelationalDBQueryResult*>::iterator i =
+                 preparedQueries_.begin(); i != preparedQueries_.end(); ++i) {
+            delete i->second;
+        }
+        preparedQueries_.clear();
+
         if (dbConnection_ != NULL) {
             dbConnection_->commit();
             try {
@@ -278,18 +338,137 @@ ExecutionTrace::initialize() {
 void
 ExecutionTrace::addInstructionExecution(
     ClockCycleCount cycle, InstructionAddress address) {
-    const std::string query =
-      (boost::format(
-        "INSERT INTO instruction_execution(cycle, address) VALUES(" 
-	"%.0f, %d);") % cycle % address).str();
+
+    if (backgroundWriting_) {
+        InstructionExecutionRecord record = {cycle, address};
+        backgroundWriter_->addInstructionExecution(record);
+        return;
+    }
+
+    boost::lock_guard<boost::mutex> lock(dbMutex_);
+    insertInstructionExecution(cycle, address);
+}
+
+/**
+ * Inserts an instruction execution record to the database.
+ *
+ * Expects the caller to hold the database lock.
+ *
+ * @param cycle The clock cycle on which the instruction execution happened.
+ * @param address The address of the executed instruction.
+ * @exception IOException In case an error in adding the data happened.
+ */
+void
+ExecutionTrace::insertInstructionExecution(
+    ClockCycleCount cycle, InstructionAddress address) {
 
     assert(dbConnection_ != NULL);
 
     try {
-        dbConnection_->updateQuery(query);
+        RelationalDBQueryResult& query = 
+            preparedQuery(IQ_INSTRUCTION_EXECUTION);
+        query.bindInt64(1, cycle);
+        query.bindInt64(2, address);
+        query.execute();
     } catch (const RelationalDBException& e) {
         throw IOException(__FILE__, __LINE__, __func__, e.errorMessage());
     }
+    recordWritten();
+}
+
+/**
+ * Writes a batch of instruction execution records to the database.
+ *
+ * The records that cannot be written are skipped.
+ *
+ * @param records The records.
+ * @return The count of records that could not be written.
+ */
+std::size_t
+ExecutionTrace::writeInstructionExecutions(
+    const std::vector<InstructionExecutionRecord>& records) {
+
+    boost::lock_guard<boost::mutex> lock(dbMutex_);
+    std::size_t failed = 0;
+    for (std::size_t i = 0; i < records.size(); ++i) {
+        try {
+            insertInstructionExecution(records[i].cycle, records[i].address);
+        } catch (const IOException& e) {
+            debugLog("Error while writing TraceDB: " + e.errorMessage());
+            ++failed;
+        }
+    }
+    return failed;
+}
+
+/**
+ * Writes a batch of procedure transfer records to the call trace.
+ *
+ * @param records The records.
+ * @return The count of records that could not be written.
+ */
+std::size_t
+ExecutionTrace::writeProcedureTransfers(
+    const std::vector<ProcedureTransferRecord>& records) {
+
+    boost::lock_guard<boost::mutex> lock(dbMutex_);
+    for (std::size_t i = 0; i < records.size(); ++i) {
+        const ProcedureTransferRecord& record = records[i];
+        callTrace_ 
+            << record.cycle << "\t" << record.address << "\t" 
+            << record.sourceAddress << "\t" << record.type << "\n";
+    }
+    return callTrace_.good() ? 0 : records.size();
+}
+
+/**
+ * Starts writing the instruction executions and procedure transfers in
+ * a background thread.
+ *
+ * After this, addInstructionExecution() and addProcedureTransfer() only
+ * buffer the records. Errors in writing them are not reported to the
+ * caller but counted by the writer. Does nothing if the writer is
+ * already running.
+ *
+ * @param bufferSize Count of records to buffer per record type.
+ * @param dropWhenFull Drop the records that do not fit in a full buffer
+ *                     instead of waiting for the writer.
+ */
+void
+ExecutionTrace::startBackgroundWriter(
+    std::size_t bufferSize, bool dropWhenFull) {
+    if (backgroundWriting_) {
+        return;
+    }
+    delete backgroundWriter_;
+    backgroundWriter_ = 
+        new BackgroundTraceWriter(*this, bufferSize, dropWhenFull);
+    backgroundWriting_ = true;
+}
+
+/**
+ * Writes the buffered records and stops the background writer.
+ *
+ * The writer statistics remain available through backgroundWriter().
+ * The records added after this are written directly.
+ */
+void
+ExecutionTrace::stopBackgroundWriter() {
+    if (!backgroundWriting_) {
+        return;
+    }
+    backgroundWriter_->stop();
+    backgroundWriting_ = false;
+}
+
+/**
+ * Returns the background writer.
+ *
+ * @return The background writer, or NULL if it has not been started.
+ */
+const BackgroundTraceWriter*
+ExecutionTrace::backgroundWriter() const {
+    return backgroundWriter_;
 }
 
 /**
@@ -335,20 +514,21 @@ void
 ExecutionTrace::addProcedureAddressRange(
     InstructionAddress firstAddress, InstructionAddress lastAddress,
     const std::string& procedureName) {
-    const std::string query =
-        "INSERT INTO procedure_address_range(first_address, last_address, "
-        "procedure_name) VALUES(" + 
-        Conversion::toString(firstAddress) + ", " + 
-        Conversion::toString(lastAddress) + ", '" + 
-        procedureName + "');";
 
+    boost::lock_guard<boost::mutex> lock(dbMutex_);
     assert(dbConnection_ != NULL);
 
     try {
-        dbConnection_->updateQuery(query);
+        RelationalDBQueryResult& query = 
+            preparedQuery(IQ_PROCEDURE_ADDRESS_RANGE);
+        query.bindInt64(1, firstAddress);
+        query.bindInt64(2, lastAddress);
+        query.bindString(3, procedureName);
+        query.execute();
     } catch (const RelationalDBException& e) {
         throw IOException(__FILE__, __LINE__, __func__, e.errorMessage());
     }
+    recordWritten();
 }
 
 /**
@@ -361,6 +541,11 @@ ExecutionTrace::addProcedureAddressRange(
  */
 InstructionExecution&
 ExecutionTrace::instructionExecutions() {
+    if (backgroundWriting_) {
+        backgroundWriter_->flush();
+    }
+
+    boost::lock_guard<boost::mutex> lock(dbMutex_);
     if (instructionExecution_ != NULL) {
         delete instructionExecution_;
         instructionExecution_ = NULL;
@@ -391,36 +576,34 @@ void
 ExecutionTrace::addBusActivity(
     ClockCycleCount cycle, const BusID& busId, const SegmentID& segmentId,
     bool squash, const SimValue& data) {
-    std::string query = 
-        "INSERT INTO bus_activity(cycle, bus, segment, squash, "
-        "data_as_int, data_as_double) VALUES(" + 
-        Conversion::toString(cycle) + ", '" + busId + "', '" + segmentId + 
-        "', ";
-
-    if (squash) 
-        query += "'TRUE'";
-    else
-        query += "'FALSE'";
-
-    std::string doubleString = Conversion::toString(data.doubleWordValue());
-    if (doubleString == "nan")
-        doubleString = "NULL";
-
-    if (!squash && &data != &NullSimValue::instance())
-        query += ", " + Conversion::toString(data.uIntWordValue()) + ", " + 
-            doubleString + ")";        
-    else
-        query += ", 0, 0.0)";
- 
 
+    boost::lock_guard<boost::mutex> lock(dbMutex_);
     assert(dbConnection_ != NULL);
 
     try {
-        dbConnection_->updateQuery(query);
+        RelationalDBQueryResult& query = preparedQuery(IQ_BUS_ACTIVITY);
+        query.bindInt64(1, cycle);
+        query.bindString(2, busId);
+        query.bindString(3, segmentId);
+        query.bindString(4, squash ? SQUASH_TRUE : SQUASH_FALSE);
+        if (!squash && &data != &NullSimValue::instance()) {
+            query.bindInt64(5, data.uIntWordValue());
+            const double doubleValue = data.doubleWordValue();
+            if (doubleValue != doubleValue) {
+                // NaN
+                query.bindNull(6);
+            } else {
+                query.bindDouble(6, doubleValue);
+            }
+        } else {
+            query.bindInt64(5, 0);
+            query.bindDouble(6, 0.0);
+        }
+        query.execute();
     } catch (const RelationalDBException& e) {
-        debugLog(std::string("query: ") + query);
         throw IOException(__FILE__, __LINE__, __func__, e.errorMessage());
     }
+    recordWritten();
 }
 
 /**
@@ -440,23 +623,23 @@ void
 ExecutionTrace::addConcurrentRegisterFileAccessCount(
     RegisterFileID registerFile, RegisterAccessCount reads,
     RegisterAccessCount writes, ClockCycleCount count) {
-    const std::string query =
-        std::string("") +
-        "INSERT INTO concurrent_register_file_access("
-        "                register_file, reads, writes, count) "
-        "VALUES('" + registerFile + "', " +
-        Conversion::toString(reads) + ", " +
-        Conversion::toString(writes) + ", " +
-        Conversion::toString(count) + ")";
 
+    boost::lock_guard<boost::mutex> lock(dbMutex_);
     assert(dbConnection_ != NULL);
 
     try {
-        dbConnection_->updateQuery(query);
+        RelationalDBQueryResult& query = 
+            preparedQuery(IQ_CONCURRENT_REGISTER_FILE_ACCESS);
+        query.bindString(1, registerFile);
+        query.bindInt64(2, reads);
+        query.bindInt64(3, writes);
+        query.bindInt64(4, count);
+        query.execute();
     } catch (const RelationalDBException& e) {
-        debugLog(query + " failed!");
+        debugLog(IQ_CONCURRENT_REGISTER_FILE_ACCESS + " failed!");
         throw IOException(__FILE__, __LINE__, __func__, e.errorMessage());
     }
+    recordWritten();
 }
 
 /**
@@ -475,21 +658,22 @@ void
 ExecutionTrace::addRegisterAccessCount(
     RegisterFileID registerFile, RegisterID registerIndex,
     ClockCycleCount reads, ClockCycleCount writes) {
-    const std::string query =
-        (boost::format(
-            "INSERT INTO register_access("
-            "                register_file, register_index, reads, writes) "
-            "VALUES('%s', %d, %.0f, %.0f)") 
-         % registerFile % registerIndex % reads % writes).str();
 
+    boost::lock_guard<boost::mutex> lock(dbMutex_);
     assert(dbConnection_ != NULL);
 
     try {
-        dbConnection_->updateQuery(query);
+        RelationalDBQueryResult& query = preparedQuery(IQ_REGISTER_ACCESS);
+        query.bindString(1, registerFile);
+        query.bindInt(2, registerIndex);
+        query.bindInt64(3, reads);
+        query.bindInt64(4, writes);
+        query.execute();
     } catch (const RelationalDBException& e) {
-        debugLog(query + " failed!");
+        debugLog(IQ_REGISTER_ACCESS + " failed!");
         throw IOException(__FILE__, __LINE__, __func__, e.errorMessage());
     }
+    recordWritten();
 }
 
 /**
@@ -503,6 +687,7 @@ ExecutionTrace::addRegisterAccessCount(
  */
 ExecutionTrace::ConcurrentRFAccessCountList*
 ExecutionTrace::registerFileAccessCounts(RegisterFileID registerFile) const {
+    boost::lock_guard<boost::mutex> lock(dbMutex_);
     ConcurrentRFAccessCountList* accesses = NULL;
     try {
         assert(dbConnection_ != NULL);
@@ -546,21 +731,22 @@ void
 ExecutionTrace::addFunctionUnitOperationTriggerCount(
     FunctionUnitID functionUnit, OperationID operation,
     OperationTriggerCount count) {
-    const std::string query =
-        std::string("") +
-        "INSERT INTO fu_operation_triggers("
-        "                function_unit, operation, count) "
-        "VALUES('" + functionUnit + "', '" + operation + "', " +
-        Conversion::toString(count) + ")";
 
+    boost::lock_guard<boost::mutex> lock(dbMutex_);
     assert(dbConnection_ != NULL);
 
     try {
-        dbConnection_->updateQuery(query);
+        RelationalDBQueryResult& query = 
+            preparedQuery(IQ_FU_OPERATION_TRIGGERS);
+        query.bindString(1, functionUnit);
+        query.bindString(2, operation);
+        query.bindInt64(3, count);
+        query.execute();
     } catch (const RelationalDBException& e) {
-        debugLog(query + " failed!");
+        debugLog(IQ_FU_OPERATION_TRIGGERS + " failed!");
         throw IOException(__FILE__, __LINE__, __func__, e.errorMessage());
     }
+    recordWritten();
 }
 
 /**
@@ -575,6 +761,14 @@ void
 ExecutionTrace::addProcedureTransfer(
     ClockCycleCount cycle, InstructionAddress address,
     InstructionAddress sourceAddress, ProcedureEntryType type) {
+
+    if (backgroundWriting_) {
+        ProcedureTransferRecord record = {cycle, address, sourceAddress, type};
+        backgroundWriter_->addProcedureTransfer(record);
+        return;
+    }
+
+    boost::lock_guard<boost::mutex> lock(dbMutex_);
     callTrace_ 
         << cycle << "\t" << address << "\t" << sourceAddress << "\t" 
         << type << std::endl;
@@ -590,6 +784,7 @@ ExecutionTrace::addProcedureTransfer(
 ExecutionTrace::FUOperationTriggerCountList*
 ExecutionTrace::functionUnitOperationTriggerCounts(
     FunctionUnitID functionUnit) const {
+    boost::lock_guard<boost::mutex> lock(dbMutex_);
     FUOperationTriggerCountList* accesses = NULL;
     try {
         assert(dbConnection_ != NULL);
@@ -629,19 +824,21 @@ ExecutionTrace::functionUnitOperationTriggerCounts(
  */
 void
 ExecutionTrace::addSocketWriteCount(SocketID socket, ClockCycleCount count) {
-    const std::string query =
-        std::string("") +
-        "INSERT INTO socket_write_counts(socket, writes) "
-        "VALUES('" + socket + "', " + Conversion::toString(count) + ")";
 
+    boost::lock_guard<boost::mutex> lock(dbMutex_);
     assert(dbConnection_ != NULL);
 
     try {
-        dbConnection_->updateQuery(query);
+        RelationalDBQueryResult& query = 
+            preparedQuery(IQ_SOCKET_WRITE_COUNTS);
+        query.bindString(1, socket);
+        query.bindInt64(2, count);
+        query.execute();
     } catch (const RelationalDBException& e) {
-        debugLog(query + " failed!");
+        debugLog(IQ_SOCKET_WRITE_COUNTS + " failed!");
         throw IOException(__FILE__, __LINE__, __func__, e.errorMessage());
     }
+    recordWritten();
 }
 
 /**
@@ -655,6 +852,7 @@ ExecutionTrace::addSocketWriteCount(SocketID socket, ClockCycleCount count) {
 ClockCycleCount
 ExecutionTrace::socketWriteCount(SocketID socket) const {
 
+    boost::lock_guard<boost::mutex> lock(dbMutex_);
     RelationalDBQueryResult* result = NULL;
     ClockCycleCount count = 0;
     try {
@@ -686,19 +884,20 @@ ExecutionTrace::socketWriteCount(SocketID socket) const {
  */
 void
 ExecutionTrace::addBusWriteCount(BusID bus, ClockCycleCount count) {
-    const std::string query =
-        std::string("") +
-        "INSERT INTO bus_write_counts(bus, writes) "
-        "VALUES('" + bus + "', " + Conversion::toString(count) + ")";
 
+    boost::lock_guard<boost::mutex> lock(dbMutex_);
     assert(dbConnection_ != NULL);
 
     try {
-        dbConnection_->updateQuery(query);
+        RelationalDBQueryResult& query = preparedQuery(IQ_BUS_WRITE_COUNTS);
+        query.bindString(1, bus);
+        query.bindInt64(2, count);
+        query.execute();
     } catch (const RelationalDBException& e) {
-        debugLog(query + " failed!");
+        debugLog(IQ_BUS_WRITE_COUNTS + " failed!");
         throw IOException(__FILE__, __LINE__, __func__, e.errorMessage());
     }
+    recordWritten();
 }
 
 /**
@@ -712,6 +911,7 @@ ExecutionTrace::addBusWriteCount(BusID bus, ClockCycleCount count) {
 ClockCycleCount
 ExecutionTrace::busWriteCount(BusID bus) const {
 
+    boost::lock_guard<boost::mutex> lock(dbMutex_);
     RelationalDBQueryResult* result = NULL;
     ClockCycleCount count = 0;
     try {
@@ -739,19 +939,20 @@ ExecutionTrace::busWriteCount(BusID bus) const {
  */
 void
 ExecutionTrace::setSimulatedCycleCount(ClockCycleCount count) {
-    const std::string query =
-        std::string("") +
-        "INSERT INTO totals(value_name, integer_value) "
-        "VALUES('cycle_count', " + Conversion::toString(count) + ")";
 
+    boost::lock_guard<boost::mutex> lock(dbMutex_);
     assert(dbConnection_ != NULL);
 
     try {
-        dbConnection_->updateQuery(query);
+        RelationalDBQueryResult& query = preparedQuery(IQ_TOTALS);
+        query.bindString(1, CYCLE_COUNT_VALUE_NAME);
+        query.bindInt64(2, count);
+        query.execute();
     } catch (const RelationalDBException& e) {
-        debugLog(query + " failed!");
+        debugLog(IQ_TOTALS + " failed!");
         throw IOException(__FILE__, __LINE__, __func__, e.errorMessage());
     }
+    recordWritten();
 }
 
 /**
@@ -762,6 +963,7 @@ ExecutionTrace::setSimulatedCycleCount(ClockCycleCount count) {
  */
 ClockCycleCount
 ExecutionTrace::simulatedCycleCount() const {
+    boost::lock_guard<boost::mutex> lock(dbMutex_);
     RelationalDBQueryResult* result = NULL;
     try {
         result = dbConnection_->query(
@@ -785,3 +987,49 @@ ExecutionTrace::simulatedCycleCount() const {
         throw IOException(__FILE__, __LINE__, __func__, e.errorMessage());
     }
 }
+
+/**
+ * Returns a compiled statement for the given query.
+ *
+ * The statement is compiled on the first request and reused afterwards.
+ * Expects the caller to hold the database lock.
+ *
+ * @param query The SQL of the statement, with ? for the parameters.
+ * @return The statement.
+ * @exception RelationalDBException If the query could not be compiled.
+ */
+RelationalDBQueryResult&
+ExecutionTrace::preparedQuery(const std::string& query) const {
+    std::map<std::string, RelationalDBQueryResult*>::const_iterator i =
+        preparedQueries_.find(query);
+    if (i != preparedQueries_.end()) {
+        return *i->second;
+    }
+    assert(dbConnection_ != NULL);
+    RelationalDBQueryResult* statement = dbConnection_->query(query, false);
+    preparedQueries_[query] = statement;
+    return *statement;
+}
+
+/**
+ * Counts a written record and commits the transaction periodically.
+ *
+ * Committing every COMMIT_INTERVAL records bounds the memory used by
+ * the open transaction while keeping the transactions large. Expects the
+ * caller to hold the database lock.
+ *
+ * @exception IOException If the commit failed.
+ */
+void
+ExecutionTrace::recordWritten() {
+    if (++uncommittedRecords_ < COMMIT_INTERVAL) {
+        return;
+    }
+    uncommittedRecords_ = 0;
+    try {
+        // commits the current transaction and starts a new one
+        dbConnection_->beginTransaction();
+    } catch (const RelationalDBException& e) {
+        throw IOException(__FILE__, __LINE__, __func__, e.errorMessage());
+    }
+}
@@ -35,9 +35,11 @@
 #include <string>
 #include <vector>
 #include <list>
+#include <map>
 #include <fstream>
 
 #include "boost/tuple/tuple.hpp"
+#include "boost/thread/mutex.hpp"
 
 #include "SimValue.hh"
 #include "FileSystem.hh"
@@ -46,12 +48,18 @@
 
 
 class InstructionExecution;
+class RelationalDBQueryResult;
+class BackgroundTraceWriter;
 
 /**
  * The main class of the Execution Trace Database (TraceDB).
  *
  * Access to the execution trace database happens through the interface of 
  * this class.
+ *
+ * The methods can be called from multiple threads. The instruction
+ * executions and procedure transfers can be written by a background
+ * writer thread, see startBackgroundWriter().
  */
 class ExecutionTrace {
 public:
@@ -98,6 +106,20 @@ public:
         PT_EXIT = 1  ///< procedure exit
     };
 
+    /// an instruction execution record
+    struct InstructionExecutionRecord {
+        ClockCycleCount cycle;
+        InstructionAddress address;
+    };
+
+    /// a procedure transfer record
+    struct ProcedureTransferRecord {
+        ClockCycleCount cycle;
+        InstructionAddress address;
+        InstructionAddress sourceAddress;
+        ProcedureEntryType type;
+    };
+
     /// type to be used as a key for storing concurrent RF access info
     typedef boost::tuple<
         RegisterAccessCount, /* concurrent reads */
@@ -181,6 +203,16 @@ public:
 
     InstructionExecution& instructionExecutions();
 
+    std::size_t writeInstructionExecutions(
+        const std::vector<InstructionExecutionRecord>& records);
+
+    std::size_t writeProcedureTransfers(
+        const std::vector<ProcedureTransferRecord>& records);
+
+    void startBackgroundWriter(std::size_t bufferSize, bool dropWhenFull);
+    void stopBackgroundWriter();
+    const BackgroundTraceWriter* backgroundWriter() const;
+
     static ExecutionTrace* open(const std::string& fileName);
 
     virtual ~ExecutionTrace();
@@ -192,6 +224,10 @@ protected:
 
 private:
     void initialize();
+    RelationalDBQueryResult& preparedQuery(const std::string& query) const;
+    void insertInstructionExecution(
+        ClockCycleCount cycle, InstructionAddress address);
+    void recordWritten();
 
     /// Filename of the trace database (sqlite file).
     const std::string& fileName_;
@@ -207,6 +243,16 @@ private:
     RelationalDBConnection* dbConnection_;
     /// Handle object for the queries of instruction executions.
     InstructionExecution* instructionExecution_;
+    /// Compiled statements, indexed by their SQL.
+    mutable std::map<std::string, RelationalDBQueryResult*> preparedQueries_;
+    /// Serializes the accesses to the database and the trace files.
+    mutable boost::mutex dbMutex_;
+    /// The background writer, NULL if not started.
+    BackgroundTraceWriter* backgroundWriter_;
+    /// Is the background writer running.
+    bool backgroundWriting_;
+    /// Count of records written after the last commit.
+    std::size_t uncommittedRecords_;
     
 };
 
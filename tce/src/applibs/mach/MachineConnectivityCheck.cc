@@ -56,8 +56,277 @@
 #include "MoveNode.hh"
 #include "MoveGuard.hh"
 #include "Guard.hh"
+#include "BitMatrix.hh"
 
 using namespace TTAMachine;
+
+/// Count of machines whose connectivity indices are kept at the same time.
+static const std::size_t MAX_CONNECTIVITY_INDICES = 16;
+
+/**
+ * Bus reachability of the ports, units and guards of a machine.
+ *
+ * The columns of the bit matrices are the buses of the machine. A row of
+ * the port read (write) matrix has '1' for each bus the port can read from
+ * (write to), the rows of the unit matrices are unions of the rows of the
+ * ports of the unit, and a row of the guard matrix has '1' for each bus
+ * that supports the guard. Connectivity queries are ANDs of the rows.
+ *
+ * Guards on different buses that are equal share a row.
+ */
+class MachineConnectivityCheck::ConnectivityIndex {
+public:
+    explicit ConnectivityIndex(const Machine& machine);
+    ~ConnectivityIndex();
+
+    unsigned long version() const { return version_; }
+
+    int portIndex(const Port& port) const;
+    int unitIndex(const Unit& unit) const;
+    int guardIndex(const Guard& guard) const;
+
+    const BitMatrix& portReads() const { return *portReads_; }
+    const BitMatrix& portWrites() const { return *portWrites_; }
+    const BitMatrix& unitReads() const { return *unitReads_; }
+    const BitMatrix& unitWrites() const { return *unitWrites_; }
+    const BitMatrix& guardBuses() const { return *guardBuses_; }
+
+    void rowBuses(
+        const BitMatrix& matrix, int row,
+        std::vector<const Bus*>& buses) const;
+    void sharedBuses(
+        const BitMatrix& first, int firstRow,
+        const BitMatrix& second, int secondRow,
+        std::vector<const Bus*>& buses) const;
+
+private:
+    /// Copying not allowed.
+    ConnectivityIndex(const ConnectivityIndex&);
+    /// Assignment not allowed.
+    ConnectivityIndex& operator=(const ConnectivityIndex&);
+
+    static void setBuses(
+        const Socket* socket, const std::map<const Bus*, int>& busIndices,
+        BitMatrix& matrix, int row);
+
+    /// The connectivity version of the machine the index was built from.
+    unsigned long version_;
+    /// The buses of the machine in the column order.
+    std::vector<const Bus*> buses_;
+    /// Row indices of the ports.
+    std::map<const Port*, int> ports_;
+    /// Row indices of the units.
+    std::map<const Unit*, int> units_;
+    /// Row indices of the guards.
+    std::map<const Guard*, int> guards_;
+    /// Buses the ports read from.
+    BitMatrix* portReads_;
+    /// Buses the ports write to.
+    BitMatrix* portWrites_;
+    /// Buses the units read from.
+    BitMatrix* unitReads_;
+    /// Buses the units write to.
+    BitMatrix* unitWrites_;
+    /// Buses that support the guards.
+    BitMatrix* guardBuses_;
+};
+
+/**
+ * Builds the connectivity index of the given machine.
+ *
+ * @param machine The machine.
+ */
+MachineConnectivityCheck::ConnectivityIndex::ConnectivityIndex(
+    const Machine& machine) :
+    version_(machine.connectivityVersion()) {
+
+    std::map<const Bus*, int> busIndices;
+    Machine::BusNavigator busNav = machine.busNavigator();
+    for (int i = 0; i < busNav.count(); ++i) {
+        busIndices[busNav.item(i)] = buses_.size();
+        buses_.push_back(busNav.item(i));
+    }
+
+    std::vector<const Unit*> units;
+    Machine::FunctionUnitNavigator fuNav = machine.functionUnitNavigator();
+    for (int i = 0; i < fuNav.count(); ++i) {
+        units.push_back(fuNav.item(i));
+    }
+    if (machine.controlUnit() != NULL) {
+        units.push_back(machine.controlUnit());
+    }
+    Machine::RegisterFileNavigator rfNav = machine.registerFileNavigator();
+    for (int i = 0; i < rfNav.count(); ++i) {
+        units.push_back(rfNav.item(i));
+    }
+    Machine::ImmediateUnitNavigator iuNav = machine.immediateUnitNavigator();
+    for (int i = 0; i < iuNav.count(); ++i) {
+        units.push_back(iuNav.item(i));
+    }
+
+    std::vector<const Port*> ports;
+    for (std::size_t u = 0; u < units.size(); ++u) {
+        units_[units[u]] = u;
+        for (int p = 0; p < units[u]->portCount(); ++p) {
+            ports_[units[u]->port(p)] = ports.size();
+            ports.push_back(units[u]->port(p));
+        }
+    }
+
+    // group the guards that are equal
+    std::vector<const Guard*> guardClasses;
+    std::vector<std::vector<int> > guardClassBuses;
+    for (std::size_t b = 0; b < buses_.size(); ++b) {
+        for (int g = 0; g < buses_[b]->guardCount(); ++g) {
+            const Guard* guard = buses_[b]->guard(g);
+            std::size_t c = 0;
+            while (c < guardClasses.size() &&
+                   !guardClasses[c]->isEqual(*guard)) {
+                ++c;
+            }
+            if (c == guardClasses.size()) {
+                guardClasses.push_back(guard);
+                guardClassBuses.push_back(std::vector<int>());
+            }
+            guards_[guard] = c;
+            guardClassBuses[c].push_back(b);
+        }
+    }
+
+    const int busCount = buses_.size();
+    portReads_ = new BitMatrix(busCount, ports.size(), false);
+    portWrites_ = new BitMatrix(busCount, ports.size(), false);
+    unitReads_ = new BitMatrix(busCount, units.size(), false);
+    unitWrites_ = new BitMatrix(busCount, units.size(), false);
+    guardBuses_ = new BitMatrix(busCount, guardClasses.size(), false);
+
+    for (std::size_t u = 0; u < units.size(); ++u) {
+        for (int p = 0; p < units[u]->portCount(); ++p) {
+            const Port& port = *units[u]->port(p);
+            const int row = ports_[&port];
+            setBuses(port.inputSocket(), busIndices, *portReads_, row);
+            setBuses(port.outputSocket(), busIndices, *portWrites_, row);
+            setBuses(port.inputSocket(), busIndices, *unitReads_, u);
+            setBuses(port.outputSocket(), busIndices, *unitWrites_, u);
+        }
+    }
+    for (std::size_t c = 0; c < guardClassBuses.size(); ++c) {
+        for (std::size_t b = 0; b < guardClassBuses[c].size(); ++b) {
+            guardBuses_->setBit(guardClassBuses[c][b], c, true);
+        }
+    }
+}
+
+/**
+ * Destructor.
+ */
+MachineConnectivityCheck::ConnectivityIndex::~ConnectivityIndex() {
+    delete portReads_;
+    delete portWrites_;
+    delete unitReads_;
+    delete unitWrites_;
+    delete guardBuses_;
+}
+
+/**
+ * Sets the bits of the buses the given socket is connected to.
+ *
+ * @param socket The socket, can be NULL.
+ * @param busIndices The column indices of the buses.
+ * @param matrix The matrix to update.
+ * @param row The row to update.
+ */
+void
+MachineConnectivityCheck::ConnectivityIndex::setBuses(
+    const Socket* socket, const std::map<const Bus*, int>& busIndices,
+    BitMatrix& matrix, int row) {
+
+    if (socket == NULL) {
+        return;
+    }
+    for (int i = 0; i < socket->segmentCount(); ++i) {
+        std::map<const Bus*, int>::const_iterator bus =
+            busIndices.find(socket->segment(i)->parentBus());
+        if (bus != busIndices.end()) {
+            matrix.setBit(bus->second, row, true);
+        }
+    }
+}
+
+/**
+ * Returns the row of the given port in the port matrices.
+ *
+ * @return The row, or -1 if the port is not in the machine of the index.
+ */
+int
+MachineConnectivityCheck::ConnectivityIndex::portIndex(
+    const Port& port) const {
+
+    std::map<const Port*, int>::const_iterator i = ports_.find(&port);
+    return i == ports_.end() ? -1 : i->second;
+}
+
+/**
+ * Returns the row of the given unit in the unit matrices.
+ *
+ * @return The row, or -1 if the unit is not in the machine of the index.
+ */
+int
+MachineConnectivityCheck::ConnectivityIndex::unitIndex(
+    const Unit& unit) const {
+
+    std::map<const Unit*, int>::const_iterator i = units_.find(&unit);
+    return i == units_.end() ? -1 : i->second;
+}
+
+/**
+ * Returns the row of the given guard in the guard matrix.
+ *
+ * @return The row, or -1 if the guard is not in the machine of the index.
+ */
+int
+MachineConnectivityCheck::ConnectivityIndex::guardIndex(
+    const Guard& guard) const {
+
+    std::map<const Guard*, int>::const_iterator i = guards_.find(&guard);
+    return i == guards_.end() ? -1 : i->second;
+}
+
+/**
+ * Collects the buses that are set in the given row.
+ *
+ * @param buses The buses are appended here.
+ */
+void
+MachineConnectivityCheck::ConnectivityIndex::rowBuses(
+    const BitMatrix& matrix, int row,
+    std::vector<const Bus*>& buses) const {
+
+    for (std::size_t b = 0; b < buses_.size(); ++b) {
+        if (matrix.bitAt(b, row)) {
+            buses.push_back(buses_[b]);
+        }
+    }
+}
+
+/**
+ * Collects the buses that are set in both of the given rows.
+ *
+ * @param buses The buses are appended here.
+ */
+void
+MachineConnectivityCheck::ConnectivityIndex::sharedBuses(
+    const BitMatrix& first, int firstRow,
+    const BitMatrix& second, int secondRow,
+    std::vector<const Bus*>& buses) const {
+
+    for (std::size_t b = 0; b < buses_.size(); ++b) {
+        if (first.bitAt(b, firstRow) && second.bitAt(b, secondRow)) {
+            buses.push_back(buses_[b]);
+        }
+    }
+}
+
 /**
  * Constructor for using this generic class directly.
  */
@@ -114,14 +383,24 @@ MachineConnectivityCheck::isConnected(
     const TTAMachine::Port& destinationPort,
     const Guard* guard) {
 
-    // TODO: replace this cache's second value(bool) with set of buses.
-    PortPortBoolMap::const_iterator
-        i = portPortCache_.find(PortPortPair(&sourcePort, &destinationPort));
-    if (i != portPortCache_.end()) {
-        if (i->second == false || guard == NULL) {
-            return i->second;
+    const ConnectivityIndex* index =
+        connectivityIndex(sourcePort.parentUnit()->machine());
+    if (index != NULL) {
+        const int source = index->portIndex(sourcePort);
+        const int destination = index->portIndex(destinationPort);
+        const int guardRow = guard == NULL ? -1 : index->guardIndex(*guard);
+        if (source != -1 && destination != -1) {
+            if (guard == NULL) {
+                return index->portWrites().rowConflictsWith(
+                    source, index->portReads(), destination);
+            } else if (guardRow != -1) {
+                return index->portWrites().rowConflictsWith(
+                    source, index->portReads(), destination,
+                    index->guardBuses(), guardRow);
+            }
         }
     }
+
     std::set<const TTAMachine::Bus*> sourceBuses;
     MachineConnectivityCheck::appendConnectedDestinationBuses(
         sourcePort, sourceBuses);
@@ -133,8 +412,6 @@ MachineConnectivityCheck::isConnected(
     std::set<const TTAMachine::Bus*> sharedBuses;
     SetTools::intersection(sourceBuses, destinationBuses, sharedBuses);
     if (sharedBuses.size() > 0) {
-        portPortCache_[PortPortPair(&sourcePort,&destinationPort)] = true;
-
         if (guard == NULL) {
             return true;
         }
@@ -148,7 +425,6 @@ MachineConnectivityCheck::isConnected(
              
         return false; // bus found but lacks the guards
     } else {
-        portPortCache_[PortPortPair(&sourcePort,&destinationPort)] = false;
         return false;
     }
 }
@@ -167,26 +443,17 @@ MachineConnectivityCheck::canTransportImmediate(
     const TTAMachine::BaseRegisterFile& destRF,
     const Guard* guard) {
 
-    std::set<const TTAMachine::Bus*> buses;
-    MachineConnectivityCheck::appendConnectedSourceBuses(destRF, buses);
-
-    for (auto bus : buses) {
-        int requiredBits = 
-            MachineConnectivityCheck::requiredImmediateWidth(
-                bus->signExtends(), immediate, *destRF.machine());
-        if (bus->immediateWidth() < requiredBits) {
-            continue;
-        }
-        
-        if (guard == NULL) {
-            return true;
-        } else {
-            if (bus->hasGuard(*guard)) {
-                return true;
-            }
-        }
+    std::vector<const TTAMachine::Bus*> buses;
+    const ConnectivityIndex* index = connectivityIndex(destRF.machine());
+    const int row = index == NULL ? -1 : index->unitIndex(destRF);
+    if (row != -1) {
+        index->rowBuses(index->unitReads(), row, buses);
+    } else {
+        std::set<const TTAMachine::Bus*> busSet;
+        appendConnectedSourceBuses(destRF, busSet);
+        buses.assign(busSet.begin(), busSet.end());
     }
-    return false;
+    return canTransportImmediate(immediate, buses, *destRF.machine(), guard);
 }
 
 /**
@@ -203,26 +470,54 @@ MachineConnectivityCheck::canTransportImmediate(
     const TTAMachine::Port& destinationPort,
     const Guard* guard) {
 
-    std::set<const TTAMachine::Bus*> buses;
-    MachineConnectivityCheck::appendConnectedSourceBuses(
-        destinationPort, buses);
+    const Machine& machine = *destinationPort.parentUnit()->machine();
+    std::vector<const TTAMachine::Bus*> buses;
+    const ConnectivityIndex* index = connectivityIndex(&machine);
+    const int row = index == NULL ? -1 : index->portIndex(destinationPort);
+    if (row != -1) {
+        index->rowBuses(index->portReads(), row, buses);
+    } else {
+        std::set<const TTAMachine::Bus*> busSet;
+        appendConnectedSourceBuses(destinationPort, busSet);
+        buses.assign(busSet.begin(), busSet.end());
+    }
+    return canTransportImmediate(immediate, buses, machine, guard);
+}
 
-    for (auto i = buses.begin(); i != buses.end(); ++i) {
-        const TTAMachine::Bus& bus = **i;
+/**
+ * Checks whether an immediate can be transported on any of the given buses.
+ *
+ * The width the immediate requires is computed once for each extension
+ * mode instead of once for each bus.
+ *
+ * @param immediate The immediate to transport.
+ * @param buses The buses connected to the destination.
+ * @param machine The machine of the buses.
+ * @param guard The guard the move must use, or NULL.
+ * @return True if some bus has a wide enough short immediate field and
+ * supports the guard.
+ */
+bool
+MachineConnectivityCheck::canTransportImmediate(
+    const TTAProgram::TerminalImmediate& immediate,
+    const std::vector<const TTAMachine::Bus*>& buses,
+    const TTAMachine::Machine& machine,
+    const TTAMachine::Guard* guard) {
 
-        int requiredBits = 
-            MachineConnectivityCheck::requiredImmediateWidth(
-                bus.signExtends(), immediate, 
-                *destinationPort.parentUnit()->machine());
-        if (bus.immediateWidth() < requiredBits) {
+    // the required widths with zero and sign extension, -1 if not computed
+    int requiredBits[2] = {-1, -1};
+    for (std::size_t i = 0; i < buses.size(); ++i) {
+        const TTAMachine::Bus& bus = *buses[i];
+        int& required = requiredBits[bus.signExtends() ? 1 : 0];
+        if (required == -1) {
+            required = requiredImmediateWidth(
+                bus.signExtends(), immediate, machine);
+        }
+        if (bus.immediateWidth() < required) {
             continue;
         }
-        if (guard == NULL) {
+        if (guard == NULL || bus.hasGuard(*guard)) {
             return true;
-        } else {
-            if (bus.hasGuard(*guard)) {
-                return true;
-            }
         }
     }
     return false;
@@ -258,11 +553,16 @@ MachineConnectivityCheck::isConnected(
     const TTAMachine::BaseRegisterFile& sourceRF,
     const TTAMachine::Port& destPort) {
 
-    RfPortBoolMap::const_iterator
-        i = rfPortCache_.find(RfPortPair(&sourceRF, &destPort));
-    if (i != rfPortCache_.end()) {
-        return i->second;
-    }    
+    const ConnectivityIndex* index = connectivityIndex(sourceRF.machine());
+    if (index != NULL) {
+        const int source = index->unitIndex(sourceRF);
+        const int destination = index->portIndex(destPort);
+        if (source != -1 && destination != -1) {
+            return index->unitWrites().rowConflictsWith(
+                source, index->portReads(), destination);
+        }
+    }
+
     std::set<const TTAMachine::Bus*> destBuses = connectedSourceBuses(destPort);
     std::set<const TTAMachine::Bus*> srcBuses;
 
@@ -276,13 +576,7 @@ MachineConnectivityCheck::isConnected(
     std::set<const TTAMachine::Bus*> sharedBuses;
     SetTools::intersection(
         srcBuses, destBuses, sharedBuses);
-    if (sharedBuses.size() > 0) {
-        rfPortCache_[RfPortPair(&sourceRF,&destPort)] = true;
-        return true;
-    } else {
-        rfPortCache_[RfPortPair(&sourceRF,&destPort)] = false;
-        return false;
-    }
+    return sharedBuses.size() > 0;
 }
 
 /**
@@ -300,14 +594,24 @@ MachineConnectivityCheck::isConnected(
     const TTAMachine::BaseRegisterFile& sourceRF,
     const TTAMachine::BaseRegisterFile& destRF,
     const TTAMachine::Guard* guard) {
-    
-    RfRfBoolMap::const_iterator
-        i = rfRfCache_.find(RfRfPair(&sourceRF, &destRF));
-    if (i != rfRfCache_.end()) {
-        if (i->second == false || guard == NULL) {
-            return i->second;
+
+    const ConnectivityIndex* index = connectivityIndex(sourceRF.machine());
+    if (index != NULL) {
+        const int source = index->unitIndex(sourceRF);
+        const int destination = index->unitIndex(destRF);
+        const int guardRow = guard == NULL ? -1 : index->guardIndex(*guard);
+        if (source != -1 && destination != -1) {
+            if (guard == NULL) {
+                return index->unitWrites().rowConflictsWith(
+                    source, index->unitReads(), destination);
+            } else if (guardRow != -1) {
+                return index->unitWrites().rowConflictsWith(
+                    source, index->unitReads(), destination,
+                    index->guardBuses(), guardRow);
+            }
         }
     }
+
     std::set<const TTAMachine::Bus*> srcBuses;
     appendConnectedDestinationBuses(sourceRF, srcBuses);
 
@@ -317,7 +621,6 @@ MachineConnectivityCheck::isConnected(
     std::set<const TTAMachine::Bus*> sharedBuses;
     SetTools::intersection(srcBuses, dstBuses, sharedBuses);
     if (sharedBuses.size() > 0) {
-        rfRfCache_[RfRfPair(&sourceRF,&destRF)] = true;
         if (guard == NULL) {
             return true;
         }
@@ -330,7 +633,6 @@ MachineConnectivityCheck::isConnected(
         }
         return false; // bus found but lacks the guards
     } else {
-        rfRfCache_[RfRfPair(&sourceRF,&destRF)] = false;
         return false;
     }
 }
@@ -349,7 +651,17 @@ bool
 MachineConnectivityCheck::isConnected(
     const TTAMachine::BaseRegisterFile& sourceRF,
     const TTAMachine::FunctionUnit& destFU) {
-    
+
+    const ConnectivityIndex* index = connectivityIndex(sourceRF.machine());
+    if (index != NULL) {
+        const int source = index->unitIndex(sourceRF);
+        const int destination = index->unitIndex(destFU);
+        if (source != -1 && destination != -1) {
+            return index->unitWrites().rowConflictsWith(
+                source, index->unitReads(), destination);
+        }
+    }
+
     std::set<const TTAMachine::Bus*> srcBuses;
     appendConnectedDestinationBuses(sourceRF, srcBuses);
 
@@ -376,10 +688,14 @@ MachineConnectivityCheck::isConnected(
     const TTAMachine::Port& sourcePort,
     const TTAMachine::RegisterFile& destRF) {
 
-    PortRfBoolMap::const_iterator
-        i = portRfCache_.find(PortRfPair(&sourcePort, &destRF));
-    if (i != portRfCache_.end()) {
-        return i->second;
+    const ConnectivityIndex* index = connectivityIndex(destRF.machine());
+    if (index != NULL) {
+        const int source = index->portIndex(sourcePort);
+        const int destination = index->unitIndex(destRF);
+        if (source != -1 && destination != -1) {
+            return index->portWrites().rowConflictsWith(
+                source, index->unitReads(), destination);
+        }
     }
 
     std::set<const TTAMachine::Bus*> sourceBuses =
@@ -395,14 +711,7 @@ MachineConnectivityCheck::isConnected(
     
     std::set<const TTAMachine::Bus*> sharedBuses;
     SetTools::intersection(sourceBuses, destBuses, sharedBuses);
-
-    if (sharedBuses.size() > 0) {
-        portRfCache_[PortRfPair(&sourcePort,&destRF)] = true;
-        return true;
-    } else {
-        portRfCache_[PortRfPair(&sourcePort,&destRF)] = false;
-        return false;
-    }
+    return sharedBuses.size() > 0;
 }
 
 /**
@@ -1355,10 +1664,40 @@ MachineConnectivityCheck::addAnnotatedFUs(std::set<TCEString>& candidateFUs,
 }
 
 /* These are static */
-MachineConnectivityCheck::PortPortBoolMap MachineConnectivityCheck::portPortCache_;
-MachineConnectivityCheck::RfRfBoolMap MachineConnectivityCheck::rfRfCache_;
-MachineConnectivityCheck::RfPortBoolMap MachineConnectivityCheck::rfPortCache_;
-MachineConnectivityCheck::PortRfBoolMap MachineConnectivityCheck::portRfCache_;
+MachineConnectivityCheck::ConnectivityIndexMap
+MachineConnectivityCheck::connectivityIndices_;
+
+/**
+ * Returns the connectivity index of the given machine.
+ *
+ * The index is built at the first query and rebuilt when the connectivity
+ * version of the machine has changed since, that is, when the machine has
+ * been edited. The indices of a limited count of machines are kept.
+ *
+ * @param machine The machine, can be NULL.
+ * @return The index, or NULL if the machine is NULL.
+ */
+const MachineConnectivityCheck::ConnectivityIndex*
+MachineConnectivityCheck::connectivityIndex(const Machine* machine) {
+
+    if (machine == NULL) {
+        return NULL;
+    }
+    ConnectivityIndexMap::iterator i = connectivityIndices_.find(machine);
+    if (i != connectivityIndices_.end()) {
+        if (i->second->version() == machine->connectivityVersion()) {
+            return i->second;
+        }
+        delete i->second;
+        connectivityIndices_.erase(i);
+    }
+    if (connectivityIndices_.size() >= MAX_CONNECTIVITY_INDICES) {
+        AssocTools::deleteAllValues(connectivityIndices_);
+    }
+    ConnectivityIndex* index = new ConnectivityIndex(*machine);
+    connectivityIndices_[machine] = index;
+    return index;
+}
 
 
 bool
@@ -1425,27 +1764,30 @@ MachineConnectivityCheck::isConnectedWithBothGuards(
     const TTAMachine::BaseRegisterFile& sourceRF,
     const TTAMachine::BaseRegisterFile& destRF,
     std::pair<const RegisterFile*,int> guardReg) {
-    
-    RfRfBoolMap::const_iterator
-        i = rfRfCache_.find(RfRfPair(&sourceRF, &destRF));
-    if (i != rfRfCache_.end()) {
-        if (i->second == false) {
-            return false;
-        }
-    }
-    std::set<const TTAMachine::Bus*> srcBuses;
-    appendConnectedDestinationBuses(sourceRF, srcBuses);
 
-    std::set<const TTAMachine::Bus*> dstBuses;
-    appendConnectedSourceBuses(destRF, dstBuses);
+    std::vector<const TTAMachine::Bus*> sharedBuses;
+    const ConnectivityIndex* index = connectivityIndex(sourceRF.machine());
+    const int source = index == NULL ? -1 : index->unitIndex(sourceRF);
+    const int destination = index == NULL ? -1 : index->unitIndex(destRF);
+    if (source != -1 && destination != -1) {
+        index->sharedBuses(
+            index->unitWrites(), source, index->unitReads(), destination,
+            sharedBuses);
+    } else {
+        std::set<const TTAMachine::Bus*> srcBuses;
+        appendConnectedDestinationBuses(sourceRF, srcBuses);
 
-    std::set<const TTAMachine::Bus*> sharedBuses;
-    SetTools::intersection(srcBuses, dstBuses, sharedBuses);
+        std::set<const TTAMachine::Bus*> dstBuses;
+        appendConnectedSourceBuses(destRF, dstBuses);
+
+        std::set<const TTAMachine::Bus*> busSet;
+        SetTools::intersection(srcBuses, dstBuses, busSet);
+        sharedBuses.assign(busSet.begin(), busSet.end());
+    }
 
     bool trueOK = false;
     bool falseOK = false;
     if (sharedBuses.size() > 0) {
-        rfRfCache_[RfRfPair(&sourceRF,&destRF)] = true;
         for (auto bus: sharedBuses) {
             std::pair<bool, bool> guardsOK = hasBothGuards(bus, guardReg);
             trueOK |= guardsOK.first;
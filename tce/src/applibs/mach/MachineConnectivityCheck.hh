@@ -221,27 +221,22 @@ public:
 protected:
     MachineConnectivityCheck(const std::string& shortDesc_);
 private:
-    typedef std::pair<const TTAMachine::Port*,const TTAMachine::Port*> 
-    PortPortPair;
+    class ConnectivityIndex;
 
-    typedef std::pair<const TTAMachine::BaseRegisterFile*,
-                      const TTAMachine::BaseRegisterFile*> RfRfPair;
-    
-    typedef std::pair<const TTAMachine::BaseRegisterFile*,
-                      const TTAMachine::Port*> RfPortPair;
-    
-    typedef std::pair<const TTAMachine::Port*,
-                      const TTAMachine::BaseRegisterFile*> PortRfPair;
-
-    typedef std::map<PortPortPair,bool> PortPortBoolMap;
-    typedef std::map<RfRfPair,bool> RfRfBoolMap;
-    typedef std::map<RfPortPair,bool> RfPortBoolMap;
-    typedef std::map<PortRfPair,bool> PortRfBoolMap;
-
-    static PortPortBoolMap portPortCache_;
-    static RfRfBoolMap rfRfCache_;
-    static RfPortBoolMap rfPortCache_;
-    static PortRfBoolMap portRfCache_;
+    typedef std::map<const TTAMachine::Machine*, ConnectivityIndex*>
+    ConnectivityIndexMap;
+
+    static const ConnectivityIndex* connectivityIndex(
+        const TTAMachine::Machine* machine);
+
+    static bool canTransportImmediate(
+        const TTAProgram::TerminalImmediate& immediate,
+        const std::vector<const TTAMachine::Bus*>& buses,
+        const TTAMachine::Machine& machine,
+        const TTAMachine::Guard* guard);
+
+    /// Connectivity indices of the recently queried machines.
+    static ConnectivityIndexMap connectivityIndices_;
 };
 
 #endif
@@ -244,6 +244,9 @@ Bus::setImmediateWidth(int width) {
         throw OutOfRange(__FILE__, __LINE__, procName);
     }
     immWidth_ = width;
+    if (machine() != NULL) {
+        machine()->connectivityChanged();
+    }
 }
 
 /**
@@ -251,7 +254,7 @@ Bus::setImmediateWidth(int width) {
  */
 void
 Bus::setZeroExtends() {
-    extensionMode_ = Machine::ZERO;
+    setExtensionMode(Machine::ZERO);
 }
 
 
@@ -260,7 +263,7 @@ Bus::setZeroExtends() {
  */
 void
 Bus::setSignExtends() {
-    extensionMode_ = Machine::SIGN;
+    setExtensionMode(Machine::SIGN);
 }
 
 
@@ -270,6 +273,9 @@ Bus::setSignExtends() {
 void
 Bus::setExtensionMode(const Machine::Extension extension) {
     extensionMode_ = extension;
+    if (machine() != NULL) {
+        machine()->connectivityChanged();
+    }
 }
 
 
@@ -415,6 +421,9 @@ Bus::addGuard(Guard& guard) {
     }
 
     guards_.push_back(&guard);
+    if (machine() != NULL) {
+        machine()->connectivityChanged();
+    }
 }
 
 /**
@@ -429,6 +438,9 @@ Bus::removeGuard(Guard& guard) {
     // run time check: can be called from Guard destructor only
     assert(guard.parentBus() == NULL);
     ContainerTools::removeValueIfExists(guards_, &guard);
+    if (machine() != NULL) {
+        machine()->connectivityChanged();
+    }
 }
 
 
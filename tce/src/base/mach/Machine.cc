@@ -68,11 +68,13 @@ const string Machine::OSKEY_ALWAYS_WRITE_BACK_RESULTS
 const string Machine::OSKEY_TRIGGER_INVALIDATES_OLD_RESULTS 
 	= "trigger-invalidates";
 const string Machine::OSKEY_FUNCTION_UNITS_ORDERED = "fu-ordered";
+unsigned long Machine::lastConnectivityVersion_ = 0;
 
 /**
  * Constructor.
  */
 Machine::Machine() : 
+    connectivityVersion_(++lastConnectivityVersion_),
     controlUnit_(NULL), doValidityChecks_(true), 
     machineTester_(new MachineTester(*this)), 
     dummyMachineTester_(new DummyMachineTester(*this)),
@@ -92,7 +94,8 @@ Machine::Machine() :
  * @param old The machine to be copied.
  */
 Machine::Machine(const Machine& old) : 
-    Serializable(), controlUnit_(NULL), doValidityChecks_(false),
+    Serializable(), connectivityVersion_(++lastConnectivityVersion_),
+    controlUnit_(NULL), doValidityChecks_(false),
     machineTester_(new MachineTester(*this)), 
     dummyMachineTester_(new DummyMachineTester(*this)),
     littleEndian_(old.littleEndian_) {
@@ -317,6 +320,7 @@ Machine::setGlobalControl(ControlUnit& unit) {
         unit.setMachine(*this);
     } else {
         controlUnit_ = &unit;
+        connectivityChanged();
     }
 }
 
@@ -544,6 +548,7 @@ Machine::unsetGlobalControl() {
     } else {
         if (controlUnit_->machine() == NULL) {
             controlUnit_ = NULL;
+            connectivityChanged();
         } else {
             controlUnit_->unsetMachine();
         }
@@ -868,6 +873,33 @@ Machine::writeToADF(const std::string& adfFileName) const {
     serializer.writeMachine(*this);
 }
 
+/**
+ * Returns the version of the interconnection network of the machine.
+ *
+ * The version changes whenever units, ports, sockets, buses or guards are
+ * added, removed or connected differently, or when the immediate support
+ * of a bus changes. Versions are unique among all machines of the process,
+ * so the version identifies the connectivity even when a deleted machine
+ * is replaced by another one in the same address.
+ *
+ * @return The connectivity version.
+ */
+unsigned long
+Machine::connectivityVersion() const {
+    return connectivityVersion_;
+}
+
+/**
+ * Gives the machine a new connectivity version.
+ *
+ * Called by the machine components when the interconnection network
+ * changes so that analyses cached per machine get rebuilt.
+ */
+void
+Machine::connectivityChanged() {
+    connectivityVersion_ = ++lastConnectivityVersion_;
+}
+
 /**
  * Returns a hash string of the machine to determine quickly
  * in case two machines are the same.
@@ -138,6 +138,9 @@ public:
 
     TCEString hash() const;
 
+    unsigned long connectivityVersion() const;
+    void connectivityChanged();
+
     bool hasOperation(const TCEString& opName) const;
 
     /**
@@ -267,6 +270,12 @@ private:
         ContainerType& container,
         ObjectState* parent);
 
+    /// Version of the interconnection network, changes at every edit.
+    /// Declared before the component containers so that it outlives them.
+    unsigned long connectivityVersion_;
+    /// The last version given to any machine.
+    static unsigned long lastConnectivityVersion_;
+
     /// Contains all the busses attached to the machine.
     ComponentContainer<Bus> busses_;
     /// Contains all the sockets attached to the machine.
@@ -141,6 +141,7 @@ Socket::setDirection(Direction direction) {
     MachineTester& tester = machine()->machineTester();
     if (tester.canSetDirection(*this, direction)) {
         direction_ = direction;
+        machine()->connectivityChanged();
     } else {
         string errorMsg = MachineTestReporter::socketDirectionSettingError(
             *this, direction, tester);
@@ -178,6 +179,7 @@ Socket::attachBus(Segment& bus) {
         const Connection* conn = new Connection(*this, bus);
         busses_.push_back(conn);
         bus.attachSocket(*this);
+        machine()->connectivityChanged();
     } else {
         assert(false);
     }
@@ -228,6 +230,9 @@ Socket::detachBus(Segment& bus) {
     if (segmentCount() == 0) {
         direction_ = UNKNOWN;
     }
+    if (machine() != NULL) {
+        machine()->connectivityChanged();
+    }
 }
 
 /**
@@ -592,6 +597,9 @@ Socket::removeConnection(const Connection* connection) {
 void
 Socket::attachPort(Port& port) {
     ports_.push_back(&port);
+    if (machine() != NULL) {
+        machine()->connectivityChanged();
+    }
 }
 
 
@@ -605,6 +613,9 @@ Socket::attachPort(Port& port) {
 void
 Socket::detachPort(const Port& port) {
     ContainerTools::removeValueIfExists(ports_, &port);
+    if (machine() != NULL) {
+        machine()->connectivityChanged();
+    }
 }
 
 
@@ -91,6 +91,34 @@ DirectAccessMemory::fillWithZeros() {
     data_->clear();
 }
 
+/**
+ * Stores a block of MAUs to the memory storage a page at a time.
+ *
+ * @param address The first target address.
+ * @param data The MAUs to write.
+ * @param count Number of MAUs to write.
+ */
+void
+DirectAccessMemory::writeBlockDirectly(
+    Word address, const Memory::MAU* data, int count) {
+
+    data_->write(address - start_, data, count);
+}
+
+/**
+ * Reads a block of MAUs from the memory storage a page at a time.
+ *
+ * @param address The first address to read.
+ * @param data The read MAUs are stored here.
+ * @param count Number of MAUs to read.
+ */
+void
+DirectAccessMemory::readBlockDirectly(
+    Word address, Memory::MAU* data, int count) {
+
+    data_->read(address - start_, data, count);
+}
+
 /**
  * Writes a single MAU using the fastest possible method.
  *
@@ -51,6 +51,9 @@ class MemoryContents;
  * Note that all range checking is disabled for fastest possible simulation
  * model. In case you are unsure of your simulated input correctness, use
  * the old simulation engine for verification.
+ *
+ * The fast access methods do not check the memory watches either. Their
+ * callers must call checkWatches() in case hasWatches() returns true.
  */
 class DirectAccessMemory : public Memory {
 public:
@@ -115,6 +118,10 @@ public:
     using Memory::write;
     using Memory::read;
 
+protected:
+    virtual void writeBlockDirectly(Word address, const MAU* data, int count);
+    virtual void readBlockDirectly(Word address, MAU* data, int count);
+
 private:
     /// Copying not allowed.
     DirectAccessMemory(const DirectAccessMemory&);
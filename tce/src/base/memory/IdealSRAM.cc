@@ -108,4 +108,28 @@ IdealSRAM::fillWithZeros() {
     data_->clear();
 }
 
+/**
+ * Stores a block of MAUs to the memory storage a page at a time.
+ *
+ * @param address The first target address.
+ * @param data The MAUs to write.
+ * @param count Number of MAUs to write.
+ */
+void
+IdealSRAM::writeBlockDirectly(Word address, const MAU* data, int count) {
+    data_->write(address - start_, data, count);
+}
+
+/**
+ * Reads a block of MAUs from the memory storage a page at a time.
+ *
+ * @param address The first address to read.
+ * @param data The read MAUs are stored here.
+ * @param count Number of MAUs to read.
+ */
+void
+IdealSRAM::readBlockDirectly(Word address, MAU* data, int count) {
+    data_->read(address - start_, data, count);
+}
+
 
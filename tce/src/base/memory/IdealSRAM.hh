@@ -65,6 +65,10 @@ public:
 
     virtual void fillWithZeros();
 
+protected:
+    virtual void writeBlockDirectly(Word address, const MAU* data, int count);
+    virtual void readBlockDirectly(Word address, MAU* data, int count);
+
 private:
     /// Copying not allowed.
     IdealSRAM(const IdealSRAM&);
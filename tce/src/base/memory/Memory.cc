@@ -56,7 +56,7 @@
 Memory::Memory(Word start, Word end, Word MAUSize, bool littleEndian) : 
     littleEndian_(littleEndian), 
     start_(start), end_(end), MAUSize_(MAUSize),
-    writeRequests_(new RequestQueue()) {
+    writeRequests_(new RequestQueue()), watchFirst_(0), watchLast_(0) {
 
     const std::size_t maxMAUSize =
         static_cast<int>(sizeof(MinimumAddressableUnit) * BYTE_BITWIDTH);
@@ -112,6 +112,7 @@ void
 Memory::writeDirectlyBE(Word address, int count, UIntWord data) {
 
     checkRange(address, count);
+    checkWatches(address, count, true);
 
     Memory::MAU MAUData[MAX_ACCESS_SIZE];
     unpackBE(data, count, MAUData);
@@ -137,6 +138,7 @@ void
 Memory::writeDirectlyLE(Word address, int count, UIntWord data) {
 
     checkRange(address, count);
+    checkWatches(address, count, true);
 
     Memory::MAU MAUData[MAX_ACCESS_SIZE];
     unpackLE(data, count, MAUData);
@@ -146,6 +148,89 @@ Memory::writeDirectlyLE(Word address, int count, UIntWord data) {
     }
 }
 
+/**
+ * Writes a block of consecutive memory locations directly without waiting
+ * to the end of the clock.
+ *
+ * This is used for loading large initial memory contents, for which the
+ * write requests of the normal interface would be too slow. The MAUs are
+ * stored as given, so they must fit in the MAU width of the memory.
+ *
+ * @param address The first target address.
+ * @param data The MAUs to write.
+ * @param count Number of MAUs to write.
+ * @exception OutOfRange in case the block is out of the address space.
+ */
+void
+Memory::writeBlock(Word address, const MAU* data, int count) {
+
+    if (count <= 0) {
+        return;
+    }
+    checkRange(address, count);
+    checkWatches(address, count, true);
+
+    writeBlockDirectly(address, data, count);
+}
+
+/**
+ * Stores a block of MAUs to the memory storage.
+ *
+ * The default implementation writes the MAUs one at a time. Derived
+ * classes can override this with a faster one depending on the storage
+ * used. No range checking.
+ *
+ * @param address The first target address.
+ * @param data The MAUs to write.
+ * @param count Number of MAUs to write.
+ */
+void
+Memory::writeBlockDirectly(Word address, const MAU* data, int count) {
+    for (int i = 0; i < count; ++i) {
+        write(address + i, data[i]);
+    }
+}
+
+/**
+ * Reads a block of consecutive memory locations.
+ *
+ * Like the other reads, does not see the writes requested in the current
+ * cycle.
+ *
+ * @param address The first address to read.
+ * @param data The read MAUs are stored here. Must have room for count MAUs.
+ * @param count Number of MAUs to read.
+ * @exception OutOfRange in case the block is out of the address space.
+ */
+void
+Memory::readBlock(Word address, MAU* data, int count) {
+
+    if (count <= 0) {
+        return;
+    }
+    checkRange(address, count);
+    checkWatches(address, count, false);
+
+    readBlockDirectly(address, data, count);
+}
+
+/**
+ * Reads a block of MAUs from the memory storage.
+ *
+ * The default implementation reads the MAUs one at a time. No range
+ * checking.
+ *
+ * @param address The first address to read.
+ * @param data The read MAUs are stored here.
+ * @param count Number of MAUs to read.
+ */
+void
+Memory::readBlockDirectly(Word address, MAU* data, int count) {
+    for (int i = 0; i < count; ++i) {
+        data[i] = read(address + i);
+    }
+}
+
 
 /**
  * Reads a single memory location.
@@ -194,6 +279,7 @@ void
 Memory::writeBE(Word address, int count, UIntWord data) {
 
     checkRange(address, count);
+    checkWatches(address, count, true);
 
     Memory::MAU MAUData[MAX_ACCESS_SIZE];
     unpackBE(data, count, MAUData);
@@ -221,6 +307,7 @@ void
 Memory::writeLE(Word address, int count, UIntWord data) {
 
     checkRange(address, count);
+    checkWatches(address, count, true);
 
     Memory::MAU MAUData[MAX_ACCESS_SIZE];
     unpackLE(data, count, MAUData);
@@ -252,6 +339,7 @@ Memory::readBE(Word address, FloatWord& data) {
     const std::size_t MAUS = 4;
 
     checkRange(address, MAUS);
+    checkWatches(address, MAUS, false);
 
     union castUnion {
         FloatWord d;
@@ -261,9 +349,7 @@ Memory::readBE(Word address, FloatWord& data) {
     castUnion cast;
 
     for (std::size_t i = 0; i < MAUS; ++i) {
-        UIntWord data;
-        // one byte so endian does not matter
-        readBE(address + i, 1, data);
+        UIntWord data = read(address + i);
         // Byte order must be reversed if host is not bigendian.
         #if WORDS_BIGENDIAN == 1
         cast.maus[i] = data;
@@ -293,6 +379,7 @@ Memory::readLE(Word address, FloatWord& data) {
     const std::size_t MAUS = 4;
 
     checkRange(address, MAUS);
+    checkWatches(address, MAUS, false);
 
     union castUnion {
         FloatWord d;
@@ -302,9 +389,7 @@ Memory::readLE(Word address, FloatWord& data) {
     castUnion cast;
 
     for (std::size_t i = 0; i < MAUS; ++i) {
-        UIntWord data;
-        // one bytes so endian does not matter
-        readLE(address + i, 1, data);
+        UIntWord data = read(address + i);
         // Byte order must be reversed if host is not little endian.
         #if WORDS_BIGENDIAN == 0
         cast.maus[i] = data;
@@ -352,6 +437,7 @@ Memory::writeBE(Word address, FloatWord data) {
     const std::size_t MAUS = 4;
 
     checkRange(address, MAUS);
+    checkWatches(address, MAUS, true);
 
     union castUnion {
         FloatWord d;
@@ -397,6 +483,7 @@ Memory::writeLE(Word address, FloatWord data) {
     const std::size_t MAUS = 4;
 
     checkRange(address, MAUS);
+    checkWatches(address, MAUS, true);
 
     union castUnion {
         FloatWord d;
@@ -442,6 +529,10 @@ Memory::readBE(Word address, DoubleWord& data) {
            "LDD works only with byte sized MAU at the moment.");
 
     const std::size_t MAUS = 8;
+
+    checkRange(address, MAUS);
+    checkWatches(address, MAUS, false);
+
     union castUnion {
         DoubleWord d;
         Byte maus[MAUS];
@@ -450,8 +541,7 @@ Memory::readBE(Word address, DoubleWord& data) {
     castUnion cast;
 
     for (std::size_t i = 0; i < MAUS; ++i) {
-        UIntWord data;
-        readBE(address + i, 1, data);
+        UIntWord data = read(address + i);
         // Byte order must be reversed if host is not bigendian.
         #if WORDS_BIGENDIAN == 1
         cast.maus[i] = data;
@@ -479,6 +569,10 @@ Memory::readLE(Word address, DoubleWord& data) {
            "LDD works only with byte sized MAU at the moment.");
 
     const std::size_t MAUS = 8;
+
+    checkRange(address, MAUS);
+    checkWatches(address, MAUS, false);
+
     union castUnion {
         DoubleWord d;
         Byte maus[MAUS];
@@ -487,8 +581,7 @@ Memory::readLE(Word address, DoubleWord& data) {
     castUnion cast;
 
     for (std::size_t i = 0; i < MAUS; ++i) {
-        UIntWord data;
-        readLE(address + i, 1, data);
+        UIntWord data = read(address + i);
         // Byte order must be reversed if host is not bigendian.
         #if WORDS_BIGENDIAN == 0
         cast.maus[i] = data;
@@ -554,6 +647,7 @@ Memory::writeBE(Word address, DoubleWord data) {
     const std::size_t MAUS = 8;
 
     checkRange(address, MAUS);
+    checkWatches(address, MAUS, true);
 
     union castUnion {
         DoubleWord d;
@@ -599,6 +693,7 @@ Memory::writeLE(Word address, DoubleWord data) {
     const std::size_t MAUS = 8;
 
     checkRange(address, MAUS);
+    checkWatches(address, MAUS, true);
 
     union castUnion {
         DoubleWord d;
@@ -640,6 +735,7 @@ void
 Memory::readBE(Word address, int size, UIntWord& data) {
 
     checkRange(address, size);
+    checkWatches(address, size, false);
 
     data = 0;
     int shiftCount = MAUSize_ * (size - 1);
@@ -682,6 +778,7 @@ void
 Memory::readLE(Word address, int size, UIntWord& data) {
 
     checkRange(address, size);
+    checkWatches(address, size, false);
 
     data = 0;
     int shiftCount = 0;
@@ -853,3 +950,78 @@ Memory::checkRange(Word startAddress, int numberOfMAUs) {
              % startAddress % numberOfMAUs).str());
     }
 }
+
+/**
+ * Adds a watch for the given address range.
+ *
+ * The listener is notified of every access that touches the range, until
+ * the watch is removed.
+ *
+ * @param handle The handle identifying the watch to the listener.
+ * @param first The first watched address.
+ * @param last The last watched address.
+ * @param reads True if reads should trigger the watch.
+ * @param writes True if writes should trigger the watch.
+ * @param listener The listener to notify.
+ */
+void
+Memory::addWatch(
+    unsigned int handle, Word first, Word last, bool reads, bool writes,
+    MemoryWatchListener& listener) {
+
+    WatchRange watch = {handle, first, last, reads, writes, &listener};
+    if (watches_.empty() || first < watchFirst_) {
+        watchFirst_ = first;
+    }
+    if (watches_.empty() || last > watchLast_) {
+        watchLast_ = last;
+    }
+    watches_.push_back(watch);
+}
+
+/**
+ * Removes the watch with the given handle.
+ *
+ * @param handle The handle the watch was added with.
+ */
+void
+Memory::removeWatch(unsigned int handle) {
+    for (std::size_t i = 0; i < watches_.size(); ++i) {
+        if (watches_[i].handle == handle) {
+            watches_.erase(watches_.begin() + i);
+            break;
+        }
+    }
+    for (std::size_t i = 0; i < watches_.size(); ++i) {
+        if (i == 0 || watches_[i].first < watchFirst_) {
+            watchFirst_ = watches_[i].first;
+        }
+        if (i == 0 || watches_[i].last > watchLast_) {
+            watchLast_ = watches_[i].last;
+        }
+    }
+}
+
+/**
+ * Notifies the listeners of the watches the given access touches.
+ *
+ * The listeners may remove watches, so the watches are iterated over a
+ * copy.
+ *
+ * @param address The first accessed address.
+ * @param count Number of accessed MAUs.
+ * @param write True for writes, false for reads.
+ */
+void
+Memory::notifyWatches(Word address, int count, bool write) {
+    const Word last = address + count - 1;
+    const std::vector<WatchRange> watches = watches_;
+    for (std::size_t i = 0; i < watches.size(); ++i) {
+        const WatchRange& watch = watches[i];
+        if (address <= watch.last && last >= watch.first &&
+            (write ? watch.writes : watch.reads)) {
+            watch.listener->memoryWatchTriggered(
+                watch.handle, address, count, write);
+        }
+    }
+}
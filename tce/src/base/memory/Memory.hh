@@ -35,11 +35,36 @@
 #ifndef TTA_MEMORY_MODEL_HH
 #define TTA_MEMORY_MODEL_HH
 
+#include <vector>
+
 #include "BaseType.hh"
 
 struct WriteRequest;
 struct RequestQueue;
 
+//////////////////////////////////////////////////////////////////////////////
+// MemoryWatchListener
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Interface for objects notified of accesses to watched address ranges.
+ */
+class MemoryWatchListener {
+public:
+    virtual ~MemoryWatchListener() {}
+
+    /**
+     * Called when a watched address range is accessed.
+     *
+     * @param handle The handle the watch was added with.
+     * @param address The first accessed address.
+     * @param count Number of accessed MAUs.
+     * @param write True for writes, false for reads.
+     */
+    virtual void memoryWatchTriggered(
+        unsigned int handle, Word address, int count, bool write) = 0;
+};
+
 //////////////////////////////////////////////////////////////////////////////
 // Memory
 //////////////////////////////////////////////////////////////////////////////
@@ -91,6 +116,9 @@ public:
     virtual void writeDirectlyBE(Word address, int size, UIntWord data);
     virtual void writeDirectlyLE(Word address, int size, UIntWord data);
 
+    void writeBlock(Word address, const MAU* data, int count);
+    void readBlock(Word address, MAU* data, int count);
+
     void write(Word address, FloatWord data);
     void write(Word address, DoubleWord data);
     void read(Word address, int size, UIntWord& data);
@@ -116,8 +144,19 @@ public:
     virtual Word MAUSize() { return MAUSize_; }
 
     bool isLittleEndian() { return littleEndian_; }
+
+    void addWatch(
+        unsigned int handle, Word first, Word last, bool reads, bool writes,
+        MemoryWatchListener& listener);
+    void removeWatch(unsigned int handle);
+    inline bool hasWatches() const;
+    inline void checkWatches(Word address, int count, bool write);
+
 protected:
 
+    virtual void writeBlockDirectly(Word address, const MAU* data, int count);
+    virtual void readBlockDirectly(Word address, MAU* data, int count);
+
     void packBE(const Memory::MAUTable data, int size, UIntWord& value);
     void unpackBE(const UIntWord& value, int size, Memory::MAUTable data);
     void packLE(const Memory::MAUTable data, int size, UIntWord& value);
@@ -131,6 +170,23 @@ private:
     Memory& operator=(const Memory&);
 
     void checkRange(Word startAddress, int numberOfMAUs);
+    void notifyWatches(Word address, int count, bool write);
+
+    /// A watched address range.
+    struct WatchRange {
+        /// The handle given by the listener.
+        unsigned int handle;
+        /// The first watched address.
+        Word first;
+        /// The last watched address.
+        Word last;
+        /// Tells whether reads trigger the watch.
+        bool reads;
+        /// Tells whether writes trigger the watch.
+        bool writes;
+        /// The listener to notify.
+        MemoryWatchListener* listener;
+    };
 
     /// Starting point of the address space.
     Word start_;
@@ -144,6 +200,12 @@ private:
     /// Mask bit pattern for unpacking IntWord to MAUs.
     int mask_;
 
+    /// The watched address ranges.
+    std::vector<WatchRange> watches_;
+    /// The lowest watched address.
+    Word watchFirst_;
+    /// The highest watched address.
+    Word watchLast_;
 };
 
 /// Maximum number of MAUs in a single request supported by the interface.
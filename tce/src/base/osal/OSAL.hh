@@ -207,13 +207,17 @@ public:
  * Macro expands to a class structure which derives itself from OperationState
  * and implements the pure virtual method name() trivially by returning the
  * name of the state as a C string. Rest of the class, which are usually public 
- * member variables, are entered by the user.
+ * member variables, are entered by the user. The state is clocked only if
+ * it defines the ADVANCE_CLOCK function.
  *
  */
 #define DEFINE_STATE(STATE_NAME) \
 class STATE_NAME##_State : public OperationState { \
     public: \
-        const char* name() { return #STATE_NAME; };
+        const char* name() { return #STATE_NAME; }; \
+        bool isClocked() const { \
+            return definesAdvanceClock<STATE_NAME##_State>(); \
+        }
 
 #define END_DEFINE_STATE };
 
@@ -326,6 +330,30 @@ bool simulateTrigger( \
  */
 #define BWIDTH(OPERAND) (((io[(OPERAND) - 1])->width()))
 
+/**
+ * Lane accessor macros for vector operands.
+ *
+ * ELEMENT_COUNT gives the count of ELEMENT_WIDTH bit lanes in the operand.
+ * ELEM reads the lane INDEX of the operand as a host value of TYPE and
+ * SET_ELEM writes it. The lane width is the width of TYPE.
+ *
+ * READ_ELEMENTS and WRITE_ELEMENTS copy the COUNT first lanes between the
+ * operand and a host array of TYPE at once. They should be preferred in
+ * elementwise operations: the element loop can then be run over plain
+ * host arrays, which the compiler vectorizes with the SIMD instructions
+ * of the host.
+ */
+#define ELEMENT_COUNT(OPERAND, ELEMENT_WIDTH) \
+    (io[(OPERAND) - 1]->elementCount(ELEMENT_WIDTH))
+#define ELEM(OPERAND, TYPE, INDEX) \
+    (io[(OPERAND) - 1]->element<TYPE>(INDEX))
+#define SET_ELEM(OPERAND, TYPE, INDEX, VALUE) \
+    (io[(OPERAND) - 1]->setElement<TYPE>((INDEX), (VALUE)))
+#define READ_ELEMENTS(OPERAND, TYPE, ARRAY, COUNT) \
+    (io[(OPERAND) - 1]->elements<TYPE>((ARRAY), 0, (COUNT)))
+#define WRITE_ELEMENTS(OPERAND, TYPE, ARRAY, COUNT) \
+    (io[(OPERAND) - 1]->setElements<TYPE>((ARRAY), 0, (COUNT)))
+
 /**
  * Access the program counter register.
  */
@@ -89,6 +89,17 @@ Operation::name() const {
     return pimpl_->name();
 }
 
+/**
+ * Returns the process-wide ID of the Operation.
+ *
+ * @return The ID of the name of the Operation.
+ * @see OperationPool::operationID()
+ */
+unsigned int
+Operation::id() const {
+    return pimpl_->id();
+}
+
 /**
  * Returns the description of the Operation.
  *
@@ -94,6 +94,7 @@ public:
 
     virtual TCEString name() const;
     virtual TCEString description() const;
+    unsigned int id() const;
     
     virtual void addDag(const TCEString& code);
     virtual void removeDag(int index);
@@ -100,7 +100,7 @@ OperationContext::state(const char* name) const {
 }
 
 /**
- * Advances the internal clock of each registered operation state object.
+ * Advances the internal clock of each clocked operation state object.
  */
 void 
 OperationContext::advanceClock() {
@@ -198,6 +198,20 @@ bool
 OperationContext::isEmpty() const {
     return pimpl_->isEmpty();
 }
+
+/**
+ * Returns true if some of the stored operation state objects need to be
+ * clocked.
+ *
+ * Operation states without a clock function are not advanced by
+ * advanceClock().
+ *
+ * @return True if there are clocked operation state objects.
+ */
+bool
+OperationContext::hasClockedStates() const {
+    return pimpl_->hasClockedStates();
+}
         
         
 /**
@@ -77,6 +77,7 @@ public:
 
     void advanceClock();
     bool isEmpty() const;
+    bool hasClockedStates() const;
     bool hasMemoryModel() const;
     const TCEString& functionUnitName();
 
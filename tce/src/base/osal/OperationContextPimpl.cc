@@ -132,14 +132,14 @@ OperationContextPimpl::state(const char* name) const {
 }
 
 /**
- * Advances the internal clock of each registered operation state object.
+ * Advances the internal clock of each clocked operation state object.
  */
 void 
 OperationContextPimpl::advanceClock(OperationContext& context) {
 
-    StateRegistry::iterator i = stateRegistry_.begin();
+    StateRegistry::iterator i = clockedStates_.begin();
 
-    while (i != stateRegistry_.end()) {
+    while (i != clockedStates_.end()) {
         (*i).second->advanceClock(context);
         ++i;
     }
@@ -165,6 +165,9 @@ OperationContextPimpl::registerState(OperationState* stateToRegister) {
     // it's reasonable to assert.
     assert(!hasState(stateName.c_str()));
     stateRegistry_[stateName] = stateToRegister;    
+    if (stateToRegister->isClocked()) {
+        clockedStates_[stateName] = stateToRegister;
+    }
 }
 
 /**
@@ -183,6 +186,7 @@ OperationContextPimpl::unregisterState(const char* name) {
     // it's reasonable to assert.
     assert(hasState(name));
     stateRegistry_.erase(name);
+    clockedStates_.erase(name);
 }
 
 /**
@@ -294,6 +298,16 @@ OperationContextPimpl::isEmpty() const {
     return stateRegistry_.size() == 0;
 }
 
+/**
+ * Returns true if there are state objects that need to be clocked.
+ *
+ * @return True if advanceClock() of the context has something to do.
+ */
+bool
+OperationContextPimpl::hasClockedStates() const {
+    return !clockedStates_.empty();
+}
+
 /**
  * Returns true if the context has memory model associated with it.
  * 
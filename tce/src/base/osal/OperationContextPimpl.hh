@@ -73,6 +73,7 @@ private:
 
     void advanceClock(OperationContext&);
     bool isEmpty() const;
+    bool hasClockedStates() const;
     bool hasMemoryModel() const;
     const TCEString& functionUnitName();
 
@@ -100,6 +101,8 @@ private:
     SimValue& returnAddress_;    
     /// The state registry.
     StateRegistry stateRegistry_;
+    /// The states that need advanceClock() calls.
+    StateRegistry clockedStates_;
     /// Should the return address be saved?
     bool saveReturnAddress_;
     /// Number of times advanceClock() has been called since
@@ -45,6 +45,7 @@
 #include "OperationBuilder.hh"
 #include "OperationBehaviorProxy.hh"
 #include "OperationBehaviorLoader.hh"
+#include "OperationIndexCache.hh"
 
 using std::map;
 using std::string;
@@ -135,6 +136,7 @@ OperationIndex::addPath(const std::string& path) {
         opModules.push_back(module);
     }
     modulesInPath_[path] = opModules;
+    readCachedOperations(path, opModules);
 }
 
 /**
@@ -389,6 +391,64 @@ OperationIndex::readOperations(const OperationModule& module) {
     opDefinitions_[module.propertiesModule()] = tree;
 }
 
+/**
+ * Reads the operation definitions of the modules in a search path from
+ * the binary OSAL cache.
+ *
+ * If the cache is out of date, all the modules of the path are read from
+ * the XML files and the cache is rewritten so that the next runs need not
+ * parse them. If the cache cannot be written the modules are left to be
+ * read on demand.
+ *
+ * @param path The search path.
+ * @param modules The modules in the search path.
+ */
+void
+OperationIndex::readCachedOperations(
+    const std::string& path, const std::vector<OperationModule*>& modules) {
+
+    if (modules.empty()) {
+        return;
+    }
+    vector<string> files;
+    for (unsigned int i = 0; i < modules.size(); i++) {
+        files.push_back(modules[i]->propertiesModule());
+    }
+    OperationIndexCache cache(path, files);
+    OperationIndexCache::DefinitionTable definitions;
+    std::set<string> broken;
+
+    if (cache.read(definitions, broken)) {
+        for (unsigned int i = 0; i < modules.size(); i++) {
+            if (broken.count(files[i])) {
+                brokenModules_.insert(modules[i]);
+            } else if (opDefinitions_.count(files[i]) == 0) {
+                opDefinitions_[files[i]] = definitions[files[i]];
+            } else {
+                delete definitions[files[i]];
+            }
+        }
+        return;
+    }
+
+    if (!cache.isWritable()) {
+        return;
+    }
+    for (unsigned int i = 0; i < modules.size(); i++) {
+        if (opDefinitions_.count(files[i]) == 0) {
+            try {
+                readOperations(*modules[i]);
+            } catch (const SerializerException&) {
+                brokenModules_.insert(modules[i]);
+                broken.insert(files[i]);
+                continue;
+            }
+        }
+        definitions[files[i]] = opDefinitions_[files[i]];
+    }
+    cache.write(definitions, broken);
+}
+
 /**
  * Searches for a module in which a given operation is defined all in a 
  * given path.
@@ -95,6 +95,9 @@ private:
     OperationIndex& operator=(const OperationIndex&);
 
     void readOperations(const OperationModule& module);
+    void readCachedOperations(
+        const std::string& path,
+        const std::vector<OperationModule*>& modules);
 
     OperationModule& moduleOf(
         const std::string& path, 
@@ -0,0 +1,341 @@
+/*
+    Copyright (c) 2002-2026 Tampere University.
+
+    This file is part of TTA-Based Codesign Environment (TCE).
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+ */
+/**
+ * @file OperationIndexCache.cc
+ *
+ * Definition of OperationIndexCache class.
+ *
+ * @note rating: red
+ */
+
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <unistd.h>
+#include <boost/functional/hash.hpp>
+
+#include "OperationIndexCache.hh"
+#include "ObjectState.hh"
+#include "FileSystem.hh"
+#include "Environment.hh"
+#include "Conversion.hh"
+#include "Exception.hh"
+#include "tce_config.h"
+
+using std::string;
+using std::vector;
+
+const string OperationIndexCache::FILE_EXTENSION = ".osaldb";
+
+namespace {
+
+/// Identifies the cache files.
+const char MAGIC[] = "TCEOSALDB";
+/// Version of the cache file format.
+const unsigned int FORMAT_VERSION = 1;
+/// Maximum nesting of the cached ObjectState trees.
+const int MAX_DEPTH = 64;
+
+void
+putUnsigned(string& out, unsigned long long value) {
+    while (value >= 0x80) {
+        out += static_cast<char>((value & 0x7f) | 0x80);
+        value >>= 7;
+    }
+    out += static_cast<char>(value);
+}
+
+void
+putString(string& out, const string& value) {
+    putUnsigned(out, value.size());
+    out += value;
+}
+
+void
+putState(string& out, const ObjectState& state) {
+    putString(out, state.name());
+    putString(out, state.stringValue());
+    putUnsigned(out, state.attributeCount());
+    for (int i = 0; i < state.attributeCount(); i++) {
+        const ObjectState::Attribute& attribute = *state.attribute(i);
+        putString(out, attribute.name);
+        putString(out, attribute.value);
+    }
+    putUnsigned(out, state.childCount());
+    for (int i = 0; i < state.childCount(); i++) {
+        putState(out, *state.child(i));
+    }
+}
+
+/**
+ * Decodes the data written with the put functions.
+ *
+ * Throws IOException if the data ends before the decoded item.
+ */
+class CacheReader {
+public:
+    CacheReader(const string& data, std::size_t position) :
+        data_(data), position_(position) {}
+
+    unsigned long long getUnsigned() {
+        unsigned long long value = 0;
+        for (int shift = 0; shift < 64 && position_ < data_.size();
+             shift += 7) {
+            unsigned char byte = data_[position_++];
+            value |= static_cast<unsigned long long>(byte & 0x7f) << shift;
+            if ((byte & 0x80) == 0) {
+                return value;
+            }
+        }
+        throw IOException(
+            __FILE__, __LINE__, __func__, "Corrupted OSAL cache file.");
+    }
+
+    string getString() {
+        unsigned long long length = getUnsigned();
+        if (length > data_.size() - position_) {
+            throw IOException(
+                __FILE__, __LINE__, __func__, "Corrupted OSAL cache file.");
+        }
+        string value = data_.substr(position_, length);
+        position_ += length;
+        return value;
+    }
+
+    ObjectState* getState(int depth = 0) {
+        if (depth > MAX_DEPTH) {
+            throw IOException(
+                __FILE__, __LINE__, __func__, "Corrupted OSAL cache file.");
+        }
+        ObjectState* state = new ObjectState(getString());
+        try {
+            state->setValue(getString());
+            unsigned long long attributes = getUnsigned();
+            for (unsigned long long i = 0; i < attributes; i++) {
+                string name = getString();
+                state->setAttribute(name, getString());
+            }
+            unsigned long long children = getUnsigned();
+            for (unsigned long long i = 0; i < children; i++) {
+                state->addChild(getState(depth + 1));
+            }
+        } catch (...) {
+            delete state;
+            throw;
+        }
+        return state;
+    }
+
+private:
+    /// The decoded data.
+    const string& data_;
+    /// Position of the next byte to decode.
+    std::size_t position_;
+};
+
+/**
+ * Writes the header that identifies the TCE version, the search path and
+ * the state of its property files.
+ */
+void
+putHeader(
+    string& out,
+    const string& path,
+    const vector<string>& files,
+    const vector<unsigned long long>& sizes,
+    const vector<std::time_t>& modificationTimes) {
+
+    out.append(MAGIC, sizeof(MAGIC));
+    putUnsigned(out, FORMAT_VERSION);
+    putString(out, VERSION);
+    putString(out, path);
+    putUnsigned(out, files.size());
+    for (unsigned int i = 0; i < files.size(); i++) {
+        putString(out, FileSystem::fileOfPath(files[i]));
+        putUnsigned(out, sizes[i]);
+        putUnsigned(out, static_cast<unsigned long long>(
+                         modificationTimes[i]));
+    }
+}
+
+}
+
+/**
+ * Constructor.
+ *
+ * Records the sizes and the modification times of the property files.
+ *
+ * @param path The search path.
+ * @param propertyFiles The operation property files in the search path.
+ */
+OperationIndexCache::OperationIndexCache(
+    const std::string& path,
+    const std::vector<std::string>& propertyFiles) :
+    path_(FileSystem::absolutePathOf(path)), files_(propertyFiles) {
+
+    std::ostringstream name;
+    name << Environment::osalCachePath() << FileSystem::DIRECTORY_SEPARATOR
+         << std::hex << std::setfill('0')
+         << std::setw(sizeof(std::size_t) * 2)
+         << boost::hash<std::string>()(path_) << FILE_EXTENSION;
+    fileName_ = name.str();
+
+    for (unsigned int i = 0; i < files_.size(); i++) {
+        string file = FileSystem::absolutePathOf(files_[i]);
+        sizes_.push_back(FileSystem::sizeInBytes(file));
+        modificationTimes_.push_back(FileSystem::lastModificationTime(file));
+    }
+}
+
+/**
+ * Destructor.
+ */
+OperationIndexCache::~OperationIndexCache() {
+}
+
+/**
+ * Reads the cached definitions of the search path.
+ *
+ * @param definitions The definitions of the modules are added here. The
+ *                    caller owns the added ObjectState trees.
+ * @param brokenModules The property files that could not be parsed are
+ *                      added here.
+ * @return True if the cache was up to date and it was read, false if the
+ *         definitions must be parsed from the property files.
+ */
+bool
+OperationIndexCache::read(
+    DefinitionTable& definitions,
+    std::set<std::string>& brokenModules) const {
+
+    std::ifstream stream(fileName_.c_str(), std::ios::in | std::ios::binary);
+    if (!stream) {
+        return false;
+    }
+    std::ostringstream contents;
+    contents << stream.rdbuf();
+    const string data = contents.str();
+
+    string header;
+    putHeader(header, path_, files_, sizes_, modificationTimes_);
+    if (data.compare(0, header.size(), header) != 0) {
+        // the property files or TCE have changed
+        return false;
+    }
+
+    DefinitionTable read;
+    std::set<string> broken;
+    try {
+        CacheReader reader(data, header.size());
+        for (unsigned int i = 0; i < files_.size(); i++) {
+            if (reader.getUnsigned() != 0) {
+                broken.insert(files_[i]);
+            } else {
+                read[files_[i]] = reader.getState();
+            }
+        }
+    } catch (const IOException&) {
+        for (DefinitionTable::iterator i = read.begin(); i != read.end();
+             i++) {
+            delete i->second;
+        }
+        return false;
+    }
+    definitions.insert(read.begin(), read.end());
+    brokenModules.insert(broken.begin(), broken.end());
+    return true;
+}
+
+/**
+ * Writes the definitions of the search path to the cache.
+ *
+ * The cache is not written if some property file was modified within
+ * the last couple of seconds, because another modification within the
+ * same second would not change its modification time.
+ *
+ * @param definitions Definitions of the modules that could be parsed.
+ * @param brokenModules The property files that could not be parsed.
+ * @return True if the cache was written.
+ */
+bool
+OperationIndexCache::write(
+    const DefinitionTable& definitions,
+    const std::set<std::string>& brokenModules) const {
+
+    const std::time_t now = std::time(NULL);
+    string data;
+    putHeader(data, path_, files_, sizes_, modificationTimes_);
+    for (unsigned int i = 0; i < files_.size(); i++) {
+        if (modificationTimes_[i] == std::time_t(-1) ||
+            modificationTimes_[i] >= now - 1) {
+            return false;
+        }
+        DefinitionTable::const_iterator definition =
+            definitions.find(files_[i]);
+        if (definition != definitions.end()) {
+            putUnsigned(data, 0);
+            putState(data, *definition->second);
+        } else if (brokenModules.count(files_[i])) {
+            putUnsigned(data, 1);
+        } else {
+            return false;
+        }
+    }
+
+    if (!isWritable()) {
+        return false;
+    }
+    // parallel processes may write the same cache, so the file is
+    // written under a temporary name and renamed in place
+    const string tempFile =
+        fileName_ + ".tmp." + Conversion::toString(getpid());
+    std::ofstream stream(
+        tempFile.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+    stream.write(data.c_str(), data.size());
+    stream.close();
+    if (!stream || !FileSystem::renameFile(tempFile, fileName_)) {
+        FileSystem::removeFileOrDirectory(tempFile);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Returns true if the cache directory exists or can be created and files
+ * can be written to it.
+ */
+bool
+OperationIndexCache::isWritable() const {
+    const string directory = Environment::osalCachePath();
+    return FileSystem::createDirectory(directory) &&
+        FileSystem::fileIsWritable(directory);
+}
+
+/**
+ * Returns the name of the cache file of the search path.
+ */
+std::string
+OperationIndexCache::fileName() const {
+    return fileName_;
+}
@@ -0,0 +1,94 @@
+/*
+    Copyright (c) 2002-2026 Tampere University.
+
+    This file is part of TTA-Based Codesign Environment (TCE).
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+ */
+/**
+ * @file OperationIndexCache.hh
+ *
+ * Declaration of OperationIndexCache class.
+ *
+ * @note rating: red
+ */
+
+#ifndef TTA_OPERATION_INDEX_CACHE_HH
+#define TTA_OPERATION_INDEX_CACHE_HH
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+#include <ctime>
+
+class ObjectState;
+
+/**
+ * Binary cache of the operation definitions of an OSAL search path.
+ *
+ * Parsing the XML of the operation property files is the slowest part of
+ * starting OSAL up, so the definitions parsed from a search path are
+ * stored to a binary file in the user's OSAL cache directory and read
+ * back from there in the later runs. The cached definitions are used only
+ * if the search path still has the same property files with the same
+ * sizes and modification times as when the cache was written.
+ */
+class OperationIndexCache {
+public:
+    /// Definitions of operation modules indexed by property file paths.
+    typedef std::map<std::string, ObjectState*> DefinitionTable;
+
+    OperationIndexCache(
+        const std::string& path,
+        const std::vector<std::string>& propertyFiles);
+    virtual ~OperationIndexCache();
+
+    bool read(
+        DefinitionTable& definitions,
+        std::set<std::string>& brokenModules) const;
+    bool write(
+        const DefinitionTable& definitions,
+        const std::set<std::string>& brokenModules) const;
+
+    bool isWritable() const;
+    std::string fileName() const;
+
+    /// Extension of the cache files.
+    static const std::string FILE_EXTENSION;
+
+private:
+    /// Copying not allowed.
+    OperationIndexCache(const OperationIndexCache&);
+    /// Assignment not allowed.
+    OperationIndexCache& operator=(const OperationIndexCache&);
+
+    /// The search path.
+    std::string path_;
+    /// The cache file of the search path.
+    std::string fileName_;
+    /// The property files of the search path.
+    std::vector<std::string> files_;
+    /// Sizes of the property files.
+    std::vector<unsigned long long> sizes_;
+    /// Modification times of the property files.
+    std::vector<std::time_t> modificationTimes_;
+};
+
+#endif
@@ -59,7 +59,7 @@ OperationPimpl::OperationPimpl(
     const TCEString& name, 
     OperationBehavior& behavior) : 
     behavior_(&behavior), name_(StringTools::stringToUpper(name)), 
-    description_(""),
+    id_(OperationPool::operationID(name.c_str())), description_(""),
     inputs_(0), outputs_(0), readsMemory_(false), writesMemory_(false), 
     canTrap_(false), hasSideEffects_(false), isClocked_(false),
     controlFlowOperation_(false), isCall_(false), isBranch_(false) {
@@ -115,6 +115,16 @@ OperationPimpl::name() const {
     return name_;
 }
 
+/**
+ * Returns the ID of the name of the Operation.
+ *
+ * @return The ID of the name of the Operation.
+ */
+unsigned int
+OperationPimpl::id() const {
+    return id_;
+}
+
 /**
  * Returns the description of the Operation.
  *
@@ -502,6 +512,7 @@ OperationPimpl::loadState(const ObjectState* state) {
     try {
         name_ = StringTools::stringToUpper(state->stringAttribute(
             Operation::OPRN_NAME));
+        id_ = OperationPool::operationID(name_.c_str());
 
         description_ = state->stringAttribute(Operation::OPRN_DESCRIPTION);
 
@@ -58,6 +58,7 @@ public:
     int numberOfInputs() const;
     int numberOfOutputs() const;
     TCEString name() const;
+    unsigned int id() const;
     void setCall(bool setting);
     void setBranch(bool setting);
     void setControlFlowOperation(bool setting);
@@ -154,6 +155,8 @@ private:
     OperationBehavior* behavior_;
     /// Name of the Operation.
     std::string name_;
+    /// ID of the name of the Operation.
+    unsigned int id_;
     /// Description of the Operation.
     std::string description_;
     /// Table of DAGs and their source codes of an operation.
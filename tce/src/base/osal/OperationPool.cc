@@ -78,7 +78,8 @@ OperationPool::~OperationPool() {
  * Cleans up the static Operation cache.
  *
  * Deletes also the Operation instances, so be sure you are not using
- * them after calling this!
+ * them after calling this! Other threads must not look up operations
+ * concurrently, as their references would be left dangling.
  */
 void 
 OperationPool::cleanupCache() {
@@ -86,6 +87,31 @@ OperationPool::cleanupCache() {
 }
 
 
+/**
+ * Returns the process-wide integer ID of an operation name.
+ *
+ * The names are case-insensitive. Each distinct name is assigned the next
+ * free ID the first time it is looked up, and the ID stays the same for
+ * the rest of the process also over cleanupCache(). The IDs are dense, so
+ * they can be used to index vectors instead of looking up operations by
+ * their names in maps.
+ *
+ * @param name The name of the operation.
+ * @return The ID of the name, less than operationIDCount().
+ */
+unsigned int
+OperationPool::operationID(const char* name) {
+    return OperationPoolPimpl::operationID(name);
+}
+
+/**
+ * Returns the count of the operation IDs assigned so far.
+ */
+unsigned int
+OperationPool::operationIDCount() {
+    return OperationPoolPimpl::operationIDCount();
+}
+
 /**
  * Looks up an operation identified by its name and returns a reference to it.
  *
@@ -103,6 +129,9 @@ OperationPool::operation(const char* name) {
 /**
  * Returns the operation index of operation pool.
  *
+ * The index is shared by all the operation pools and operation() updates
+ * it, so it must not be used while other threads look up operations.
+ *
  * @return The operation index.
  */
 OperationIndex&
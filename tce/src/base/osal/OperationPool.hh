@@ -60,6 +60,9 @@ public:
 
     static void cleanupCache();
 
+    static unsigned int operationID(const char* name);
+    static unsigned int operationIDCount();
+
     static void setLLVMTargetInstrInfo(const llvm::MCInstrInfo* tid);
 private:
     /// Copying not allowed.
@@ -66,6 +66,7 @@ using std::vector;
 using std::string;
 
 OperationPoolPimpl::OperationTable OperationPoolPimpl::operationCache_;
+boost::mutex OperationPoolPimpl::cacheMutex_;
 OperationIndex* OperationPoolPimpl::index_(NULL);
 const llvm::MCInstrInfo* OperationPoolPimpl::llvmTargetInstrInfo_(NULL);
 
@@ -73,6 +74,7 @@ const llvm::MCInstrInfo* OperationPoolPimpl::llvmTargetInstrInfo_(NULL);
  * The constructor
  */
 OperationPoolPimpl::OperationPoolPimpl() {
+    boost::mutex::scoped_lock lock(cacheMutex_);
     // if this is a first created instance of OperationPool,
     // initialize the OperationIndex instance with the search paths
     if (index_ == NULL) {
@@ -98,7 +100,8 @@ OperationPoolPimpl::~OperationPoolPimpl() {
  */
 void 
 OperationPoolPimpl::cleanupCache() {
-    AssocTools::deleteAllValues(operationCache_);
+    boost::mutex::scoped_lock lock(cacheMutex_);
+    SequenceTools::deleteAllItems(operationCache_);
     delete index_;
     index_ = NULL;
 }
@@ -114,11 +117,16 @@ OperationPoolPimpl::cleanupCache() {
  */
 Operation&
 OperationPoolPimpl::operation(const char* name) {
-  
-    OperationTable::iterator it = 
-        operationCache_.find(StringTools::stringToLower(name));
-    if (it != operationCache_.end()) {
-        return *((*it).second);
+
+    // the code generator and the scheduler may look up operations in
+    // different threads
+    boost::mutex::scoped_lock lock(cacheMutex_);
+    const unsigned int id = operationID(name);
+    if (id < operationCache_.size() && operationCache_[id] != NULL) {
+        return *operationCache_[id];
+    }
+    if (id >= operationCache_.size()) {
+        operationCache_.resize(operationIDCount(), NULL);
     }
     
     // If llvmTargetInstrInfo_ is set, the scheduler is called
@@ -136,7 +144,7 @@ OperationPoolPimpl::operation(const char* name) {
 #endif
             if (operName == TCEString(name).lower()) {
                 Operation* llvmOperation = loadFromLLVM(tid);
-                operationCache_[operName] = llvmOperation;
+                operationCache_[id] = llvmOperation;
                 return *llvmOperation;
             } 
         }
@@ -151,7 +159,7 @@ OperationPoolPimpl::operation(const char* name) {
     
     Operation* effective = index_->effectiveOperation(name);
     if (effective != NULL) {
-        operationCache_[StringTools::stringToLower(name)] = effective;
+        operationCache_[id] = effective;
         return *effective;
     } else {
         return NullOperation::instance();            
@@ -221,18 +229,75 @@ const llvm::MCInstrDesc& tid
  */
 OperationIndex&
 OperationPoolPimpl::index() {
+    boost::mutex::scoped_lock lock(cacheMutex_);
     assert(index_ != NULL);
     return *index_;
 }
 
 bool
 OperationPoolPimpl::sharesState(const Operation& op) {
+    boost::mutex::scoped_lock lock(cacheMutex_);
     if (op.affectsCount() > 0 || op.affectedByCount() > 0)
         return true;
-    for (const auto& entry : operationCache_) {
-        const Operation& other = *entry.second;
-        if (other.dependsOn(op))
+    for (const Operation* other : operationCache_) {
+        if (other != NULL && other->dependsOn(op))
             return true;
     }
     return false;
 }
+
+/**
+ * Returns the ID of an operation name, assigning a new one if needed.
+ *
+ * @see OperationPool::operationID()
+ */
+unsigned int
+OperationPoolPimpl::operationID(const std::string& name) {
+    return internLowercase(StringTools::stringToLower(name));
+}
+
+/**
+ * Returns the count of the operation IDs assigned so far.
+ */
+unsigned int
+OperationPoolPimpl::operationIDCount() {
+    boost::mutex::scoped_lock lock(idMutex());
+    return operationIDs().size();
+}
+
+/**
+ * Returns the ID of a lowercase operation name.
+ */
+unsigned int
+OperationPoolPimpl::internLowercase(const std::string& name) {
+    boost::mutex::scoped_lock lock(idMutex());
+    OperationIDTable& ids = operationIDs();
+    OperationIDTable::const_iterator it = ids.find(name);
+    if (it != ids.end()) {
+        return it->second;
+    }
+    const unsigned int id = ids.size();
+    ids[name] = id;
+    return id;
+}
+
+/**
+ * Returns the table of the assigned operation IDs.
+ *
+ * The table is created on the first use, because the operations created
+ * during static initialization already need their IDs.
+ */
+OperationPoolPimpl::OperationIDTable&
+OperationPoolPimpl::operationIDs() {
+    static OperationIDTable ids;
+    return ids;
+}
+
+/**
+ * Returns the mutex that serializes the accesses to the ID table.
+ */
+boost::mutex&
+OperationPoolPimpl::idMutex() {
+    static boost::mutex mutex;
+    return mutex;
+}
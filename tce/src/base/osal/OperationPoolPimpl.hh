@@ -35,6 +35,8 @@
 
 #include <string>
 #include <map>
+#include <vector>
+#include <boost/thread/mutex.hpp>
 #include "tce_config.h"
 
 class OperationPool;
@@ -61,20 +63,28 @@ public:
 
     static void cleanupCache();
 
+    static unsigned int operationID(const std::string& name);
+    static unsigned int operationIDCount();
+
     static void setLLVMTargetInstrInfo(const llvm::MCInstrInfo* tid) {
         llvmTargetInstrInfo_ = tid;
     }
 private:
     OperationPoolPimpl();
     
-    /// Container for operations indexed by their names.
-    typedef std::map<std::string, Operation*> OperationTable;
+    /// Container for operations indexed by their IDs.
+    typedef std::vector<Operation*> OperationTable;
+    /// Container for operation IDs indexed by the lowercase names.
+    typedef std::map<std::string, unsigned int> OperationIDTable;
 
     /// Copying not allowed.
     OperationPoolPimpl(const OperationPoolPimpl&);
     /// Assignment not allowed.
     OperationPoolPimpl& operator=(const OperationPoolPimpl&);
     Operation* loadFromLLVM(const llvm::MCInstrDesc& tid);
+    static unsigned int internLowercase(const std::string& name);
+    static OperationIDTable& operationIDs();
+    static boost::mutex& idMutex();
     /// Operation pool uses this to load behavior models of the operations.
     static OperationBehaviorLoader* loader_;
     /// Indexed table used to find out which operation module contains the
@@ -83,8 +93,11 @@ private:
     
     OperationSerializer serializer_;
     
-    /// Contains all operations that have been already requested by the client.
+    /// Contains all operations that have been already requested by the
+    /// client, indexed by the operation IDs.
     static OperationTable operationCache_;
+    /// Serializes the accesses to the operation cache and the index.
+    static boost::mutex cacheMutex_;
     /// Contains all operation behavior proxies.
     static std::vector<OperationBehaviorProxy*> proxies_; 
     /// If this is set, OSAL data is loaded from the TargetInstrInfo
@@ -77,6 +77,21 @@ void
 OperationState::advanceClock(OperationContext&) {
 }
 
+/**
+ * Returns true if advanceClock() of the state must be called every cycle.
+ *
+ * States that return false are not clocked by the OperationContext, which
+ * lets the simulator skip idle function units that only have such states.
+ * By default returns true because a derived class can override
+ * advanceClock().
+ *
+ * @return True if the state needs to be clocked.
+ */
+bool
+OperationState::isClocked() const {
+    return true;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // NullOperationState
 ///////////////////////////////////////////////////////////////////////////////
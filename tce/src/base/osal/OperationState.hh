@@ -34,6 +34,8 @@
 #ifndef TTA_OPERATION_STATE_HH
 #define TTA_OPERATION_STATE_HH
 
+#include <type_traits>
+
 class OperationContext;
 class SimValue;
 
@@ -51,6 +53,21 @@ public:
     virtual const char* name() = 0;
     virtual bool isAvailable(const OperationContext& context) const;
     virtual void advanceClock(OperationContext& context);
+    virtual bool isClocked() const;
+
+protected:
+    /**
+     * Returns true if the given state class defines its own advanceClock().
+     *
+     * Used by the states defined with the OSAL.hh macros to find out
+     * whether they need to be clocked.
+     */
+    template <typename StateType>
+    static bool definesAdvanceClock() {
+        return !std::is_same<
+            decltype(&StateType::advanceClock),
+            void (OperationState::*)(OperationContext&)>::value;
+    }
 };
 
 //////////////////////////////////////////////////////////////////////////////
@@ -469,6 +469,30 @@ int main(int argc, char* argv[]) {
             }
 
             if (generateDataImages) {
+                ProgramImageGenerator::OutputFormat format =
+                    ProgramImageGenerator::ASCII;
+                int mausPerLine = dmemMAUsPerLine;
+                if (diFormat == "binary") {
+                    format = ProgramImageGenerator::BINARY;
+                    mausPerLine = 1;
+                } else if (diFormat == "array") {
+                    format = ProgramImageGenerator::ARRAY;
+                } else if (diFormat == "mif") {
+                    format = ProgramImageGenerator::MIF;
+                } else if (diFormat == "vhdl") {
+                    format = ProgramImageGenerator::VHDL;
+                } else if (diFormat == "coe") {
+                    format = ProgramImageGenerator::COE;
+                } else if (diFormat == "hex") {
+                    format = ProgramImageGenerator::HEX;
+                } else {
+                    assert(diFormat == "ascii" || diFormat == "");
+                }
+
+                // the images of different address spaces are independent,
+                // generate them all at once
+                ProgramImageGenerator::DataImageStreams streams;
+                std::vector<string> fileNames;
                 Machine::AddressSpaceNavigator asNav =
                     mach->addressSpaceNavigator();
                 for (int i = 0; i < asNav.count(); i++) {
@@ -477,49 +501,31 @@ int main(int argc, char* argv[]) {
                         string fileName =
                             programDataImageFile(
                                 tpefFile, diFormat, as->name());
-                        ofstream stream(fileName.c_str());
-                        if (diFormat == "binary") {
-                            imageGenerator.generateDataImage(
-                                tpefFile, *program, as->name(), stream,
-                                ProgramImageGenerator::BINARY, 1, true);
-                        } else if (diFormat == "array") {
-                            imageGenerator.generateDataImage(
-                                tpefFile, *program, as->name(), stream,
-                                ProgramImageGenerator::ARRAY,
-                                dmemMAUsPerLine, true);
-                        } else if (diFormat == "mif") {
-                            imageGenerator.generateDataImage(
-                                tpefFile, *program, as->name(), stream,
-                                ProgramImageGenerator::MIF,
-                                dmemMAUsPerLine, true);
-                        } else if (diFormat == "vhdl") {
-                            imageGenerator.generateDataImage(
-                                tpefFile, *program, as->name(), stream,
-                                ProgramImageGenerator::VHDL,
-                                dmemMAUsPerLine, true);
-                        } else if (diFormat == "coe") {
-                            imageGenerator.generateDataImage(
-                                tpefFile, *program, as->name(), stream,
-                                ProgramImageGenerator::COE,
-                                dmemMAUsPerLine, true);
-                        } else if (diFormat == "hex") {
-                            imageGenerator.generateDataImage(
-                                tpefFile, *program, as->name(), stream,
-                                ProgramImageGenerator::HEX,
-                                dmemMAUsPerLine, true);
-                        } else {
-                            assert(diFormat == "ascii" || diFormat == "");
-                            imageGenerator.generateDataImage(
-                                tpefFile, *program, as->name(), stream,
-                                ProgramImageGenerator::ASCII,
-                                dmemMAUsPerLine, true);
-                        }
-                        stream.close();
-
-                        if (diFormat == "ascii" || piFormat == "") {
-                            copyImageToTb(
-                                fileName, progeOutputDir, TB_DMEM_FILE);
-                        }
+                        fileNames.push_back(fileName);
+                        streams[as->name()] = new ofstream(fileName.c_str());
+                    }
+                }
+                try {
+                    imageGenerator.generateDataImages(
+                        tpefFile, *program, streams, format, mausPerLine,
+                        true);
+                } catch (const Exception&) {
+                    for (ProgramImageGenerator::DataImageStreams::iterator
+                             iter = streams.begin(); iter != streams.end();
+                         iter++) {
+                        delete iter->second;
+                    }
+                    throw;
+                }
+                for (ProgramImageGenerator::DataImageStreams::iterator iter =
+                         streams.begin(); iter != streams.end(); iter++) {
+                    delete iter->second;
+                }
+
+                if (diFormat == "ascii" || piFormat == "") {
+                    for (size_t i = 0; i < fileNames.size(); i++) {
+                        copyImageToTb(
+                            fileNames[i], progeOutputDir, TB_DMEM_FILE);
                     }
                 }
             }
@@ -0,0 +1,451 @@
+/*
+    Copyright (c) 2002-2026 Tampere University.
+
+    This file is part of TTA-Based Codesign Environment (TCE).
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+ */
+/**
+ * @file TTACoSim.cc
+ *
+ * Implementation of a co-simulation harness that runs the RTL simulation of
+ * a generated processor and the interpretive simulator concurrently and
+ * compares their bus traces to detect where the RTL implementation diverges
+ * from the architecture simulation.
+ *
+ * The RTL simulation is started as a child process. It must write the
+ * execution bus trace of the IC ("execbus.dump", generated with the
+ * 'bustrace' parameter of the default IC/decoder plugin) to the given file.
+ * Both traces are reduced to rolling hashes that are compared once per
+ * window of cycles. When the hashes of a window differ, the first divergent
+ * cycle is found by bisecting the per-cycle hashes of the window.
+ *
+ * @note rating: red
+ */
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <csignal>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <boost/thread.hpp>
+#include "Application.hh"
+#include "Machine.hh"
+#include "Program.hh"
+#include "SimulatorFrontend.hh"
+#include "SimulationEventHandler.hh"
+#include "BusTracker.hh"
+#include "Listener.hh"
+#include "FileSystem.hh"
+#include "Conversion.hh"
+
+/// Default number of cycles between hash comparisons.
+const ClockCycleCount DEFAULT_WINDOW = 4096;
+/// FNV-1a offset basis.
+const unsigned long long HASH_OFFSET = 14695981039346656037ULL;
+/// FNV-1a prime.
+const unsigned long long HASH_PRIME = 1099511628211ULL;
+/// Separator of the bus values in the trace lines.
+const char COLUMN_SEPARATOR = ',';
+
+/**
+ * Returns the canonical form of a hexadecimal bus value.
+ *
+ * The simulators pad the values differently, so the leading zeros are
+ * dropped and the digits are converted to lower case.
+ */
+std::string
+canonicalValue(const std::string& value) {
+    std::string::size_type start = value.find_first_not_of("0 \t\r");
+    std::string result =
+        (start == std::string::npos) ? "0" : value.substr(start);
+    std::string::size_type end = result.find_last_not_of(" \t\r");
+    result.erase(end + 1);
+    for (std::size_t i = 0; i < result.size(); ++i) {
+        result[i] = static_cast<char>(std::tolower(result[i]));
+    }
+    return result;
+}
+
+/**
+ * Adds one trace line to the rolling hash.
+ *
+ * The first column of the line, the cycle count, is not hashed since the
+ * cycles are counted by the harness.
+ *
+ * @param hash The rolling hash of the preceding cycles.
+ * @param line The trace line.
+ * @return The rolling hash including the line.
+ */
+unsigned long long
+addLineToHash(unsigned long long hash, const std::string& line) {
+    std::string::size_type start = line.find(COLUMN_SEPARATOR);
+    while (start != std::string::npos) {
+        std::string::size_type end = line.find(COLUMN_SEPARATOR, start + 1);
+        std::string value = canonicalValue(
+            line.substr(
+                start + 1,
+                end == std::string::npos ? end : end - start - 1));
+        for (std::size_t i = 0; i < value.size(); ++i) {
+            hash = (hash ^ static_cast<unsigned char>(value[i])) * HASH_PRIME;
+        }
+        hash = (hash ^ static_cast<unsigned char>(COLUMN_SEPARATOR)) *
+            HASH_PRIME;
+        start = end;
+    }
+    return (hash ^ '\n') * HASH_PRIME;
+}
+
+/**
+ * The per-cycle trace lines and rolling hashes of one comparison window.
+ */
+struct TraceWindow {
+    /// Trace lines of the cycles in the window.
+    std::vector<std::string> lines;
+    /// Rolling hashes after each cycle in the window.
+    std::vector<unsigned long long> hashes;
+
+    /// Adds the trace line of the next cycle.
+    void add(const std::string& line, unsigned long long& hash) {
+        hash = addLineToHash(hash, line);
+        lines.push_back(line);
+        hashes.push_back(hash);
+    }
+
+    void clear() {
+        lines.clear();
+        hashes.clear();
+    }
+};
+
+/**
+ * Records the bus trace of the simulator at the end of each cycle.
+ *
+ * The trace lines are formatted by BusTracker like the bus trace of ttasim.
+ */
+class BusTraceHasher : public Listener {
+public:
+    BusTraceHasher(SimulatorFrontend& frontend, TraceWindow& window) :
+        frontend_(frontend), window_(window), hash_(HASH_OFFSET) {
+        frontend_.eventHandler().registerListener(
+            SimulationEventHandler::SE_CYCLE_END, this);
+    }
+
+    virtual ~BusTraceHasher() {
+        frontend_.eventHandler().unregisterListener(
+            SimulationEventHandler::SE_CYCLE_END, this);
+    }
+
+    virtual void handleEvent() {
+        std::ostringstream line;
+        BusTracker::writeTraceLine(frontend_, line);
+        window_.add(line.str(), hash_);
+    }
+
+private:
+    /// The simulator whose buses are traced.
+    SimulatorFrontend& frontend_;
+    /// The window the cycles are recorded to.
+    TraceWindow& window_;
+    /// The rolling hash of all traced cycles.
+    unsigned long long hash_;
+};
+
+/**
+ * Runs the RTL simulation and reads its bus trace while it is written.
+ */
+class RTLTraceReader {
+public:
+    RTLTraceReader(
+        const std::string& command, const std::string& traceFile) :
+        traceFile_(traceFile), pid_(-1), finished_(false), status_(0),
+        linesRead_(0), hash_(HASH_OFFSET) {
+
+        // do not read the trace of a previous run
+        if (FileSystem::fileExists(traceFile_)) {
+            FileSystem::removeFileOrDirectory(traceFile_);
+        }
+
+        std::cout.flush();
+        std::cerr.flush();
+        pid_ = fork();
+        if (pid_ == 0) {
+            // own process group so that the whole simulation can be stopped
+            setpgid(0, 0);
+            execl("/bin/sh", "sh", "-c", command.c_str(),
+                  static_cast<char*>(NULL));
+            _exit(127);
+        } else if (pid_ < 0) {
+            throw IOException(
+                __FILE__, __LINE__, __func__,
+                "Unable to start the RTL simulation: " + command);
+        }
+    }
+
+    ~RTLTraceReader() {
+        if (!finished_) {
+            kill(-pid_, SIGTERM);
+            waitpid(pid_, NULL, 0);
+        }
+    }
+
+    /**
+     * Reads the trace lines of the next cycles to the given window.
+     *
+     * Waits for the RTL simulation to write the lines.
+     *
+     * @param cycles The number of cycles to read.
+     * @param window The window to add the lines to.
+     * @return The number of lines read, less than requested if the RTL
+     *         simulation ended.
+     */
+    ClockCycleCount readCycles(ClockCycleCount cycles, TraceWindow& window) {
+        ClockCycleCount read = 0;
+        std::string line;
+        while (read < cycles && readLine(line)) {
+            window.add(line, hash_);
+            ++read;
+        }
+        linesRead_ += read;
+        return read;
+    }
+
+    /**
+     * Tells whether the RTL simulation ended successfully.
+     *
+     * @return True if the simulation command exited with status zero.
+     */
+    bool succeeded() const {
+        return finished_ && WIFEXITED(status_) && WEXITSTATUS(status_) == 0;
+    }
+
+    /**
+     * Returns the number of trace lines read so far.
+     */
+    ClockCycleCount linesRead() const {
+        return linesRead_;
+    }
+
+private:
+    /**
+     * Reads one complete line of the trace.
+     *
+     * @return False if the RTL simulation ended before writing the line.
+     */
+    bool readLine(std::string& line) {
+        for (;;) {
+            if (!stream_.is_open()) {
+                stream_.open(traceFile_.c_str());
+            }
+            if (stream_.is_open()) {
+                int c;
+                while ((c = stream_.get()) != EOF) {
+                    if (c == '\n') {
+                        line.swap(partialLine_);
+                        partialLine_.clear();
+                        return true;
+                    }
+                    partialLine_ += static_cast<char>(c);
+                }
+                stream_.clear();
+            }
+            if (finished_) {
+                if (partialLine_.empty()) {
+                    return false;
+                }
+                line.swap(partialLine_);
+                partialLine_.clear();
+                return true;
+            }
+            // the rest of the trace is read once more after the
+            // simulation has ended
+            finished_ = waitpid(pid_, &status_, WNOHANG) == pid_;
+            if (!finished_) {
+                boost::this_thread::sleep(boost::posix_time::milliseconds(10));
+            }
+        }
+    }
+
+    /// The trace file written by the RTL simulation.
+    std::string traceFile_;
+    /// The stream the trace is read from.
+    std::ifstream stream_;
+    /// Characters of the line that has not been completely written yet.
+    std::string partialLine_;
+    /// Process id of the RTL simulation.
+    pid_t pid_;
+    /// True if the RTL simulation has ended.
+    bool finished_;
+    /// Exit status of the RTL simulation, valid when it has ended.
+    int status_;
+    /// The number of trace lines read.
+    ClockCycleCount linesRead_;
+    /// The rolling hash of all read cycles.
+    unsigned long long hash_;
+};
+
+/**
+ * Finds the first divergent cycle of the given windows by bisection.
+ *
+ * The rolling hashes of the windows match before the window and differ at
+ * its end, so they differ at every cycle after the first divergent one.
+ *
+ * @return Index of the first divergent cycle in the windows.
+ */
+std::size_t
+firstDivergentCycle(const TraceWindow& sim, const TraceWindow& rtl) {
+    std::size_t low = 0;
+    std::size_t high = std::min(sim.hashes.size(), rtl.hashes.size()) - 1;
+    while (low < high) {
+        std::size_t middle = low + (high - low) / 2;
+        if (sim.hashes[middle] == rtl.hashes[middle]) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+/**
+ * Co-simulates the given program+machine with the RTL simulation.
+ *
+ * @return True if no divergence was found.
+ */
+bool
+coSimulate(
+    TTAMachine::Machine& machine, TTAProgram::Program& program,
+    const std::string& rtlCommand, const std::string& rtlTraceFile,
+    ClockCycleCount window) {
+
+    SimulatorFrontend simulator(SimulatorFrontend::SIM_NORMAL);
+    simulator.loadMachine(machine);
+    simulator.loadProgram(program);
+    assert(simulator.isSimulationInitialized());
+
+    TraceWindow simWindow;
+    TraceWindow rtlWindow;
+    BusTraceHasher hasher(simulator, simWindow);
+    RTLTraceReader rtl(rtlCommand, rtlTraceFile);
+
+    ClockCycleCount windowStart = 0;
+    while (!simulator.hasSimulationEnded()) {
+        simWindow.clear();
+        rtlWindow.clear();
+        try {
+            simulator.step(static_cast<double>(window));
+        } catch (const Exception& e) {
+            std::cerr << "Simulation error: " << e.errorMessage() << std::endl;
+            return false;
+        }
+        ClockCycleCount simCycles = simWindow.hashes.size();
+        if (simCycles == 0) {
+            break;
+        }
+        ClockCycleCount rtlCycles = rtl.readCycles(simCycles, rtlWindow);
+
+        if (rtlCycles > 0 &&
+            simWindow.hashes[rtlCycles - 1] != rtlWindow.hashes.back()) {
+            std::size_t cycle = firstDivergentCycle(simWindow, rtlWindow);
+            std::cerr
+                << "Bus traces diverge at cycle " << windowStart + cycle
+                << ":" << std::endl
+                << "ttasim: " << simWindow.lines[cycle] << std::endl
+                << "RTL:    " << rtlWindow.lines[cycle] << std::endl;
+            return false;
+        }
+        if (rtlCycles < simCycles) {
+            // a testbench may stop after a fixed number of cycles, but a
+            // failed or missing RTL simulation must not pass as a match
+            if (!rtl.succeeded()) {
+                std::cerr
+                    << "RTL simulation failed at cycle "
+                    << windowStart + rtlCycles << "." << std::endl;
+                return false;
+            }
+            if (rtl.linesRead() == 0) {
+                std::cerr
+                    << "RTL simulation wrote no bus trace to "
+                    << rtlTraceFile << "." << std::endl;
+                return false;
+            }
+            std::cerr
+                << "RTL simulation ended at cycle " << windowStart + rtlCycles
+                << " before the program ended. The bus traces match until "
+                << "that." << std::endl;
+            return true;
+        }
+        windowStart += simCycles;
+
+        // print out the cycle count after simulating at least 1M cycles
+        if (windowStart / 1000000 > (windowStart - simCycles) / 1000000) {
+            std::cout
+                << "compared " << windowStart << " cycles" << std::endl;
+        }
+    }
+    std::cout
+        << "Bus traces of " << windowStart << " cycles match." << std::endl;
+    return true;
+}
+
+int
+main(int argc, char* argv[]) {
+
+    Application::initialize();
+
+    if (argc < 5) {
+        std::cerr
+            << "usage: ttacosim machine.adf program.tpef rtl_trace_file "
+            << "rtl_simulation_command [window_cycles]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    ClockCycleCount window = DEFAULT_WINDOW;
+    try {
+        if (argc > 5) {
+            window = Conversion::toUnsignedInt(argv[5]);
+        }
+        if (window == 0) {
+            std::cerr << "Window must be at least one cycle." << std::endl;
+            return EXIT_FAILURE;
+        }
+        TTAMachine::Machine* machine =
+            TTAMachine::Machine::loadFromADF(argv[1]);
+        TTAProgram::Program* program =
+            TTAProgram::Program::loadFromTPEF(argv[2], *machine);
+        bool match = coSimulate(*machine, *program, argv[4], argv[3], window);
+
+        delete program; program = NULL;
+        delete machine; machine = NULL;
+        if (!match) {
+            return EXIT_FAILURE;
+        }
+    } catch (const Exception& e) {
+        std::cerr << e.errorMessage() << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
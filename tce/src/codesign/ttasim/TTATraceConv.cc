@@ -0,0 +1,71 @@
+/*
+    Copyright (c) 2002-2026 Tampere University.
+
+    This file is part of TTA-Based Codesign Environment (TCE).
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+ */
+/**
+ * @file TTATraceConv.cc
+ *
+ * Stores a binary trace written by ttasim in the execution trace database.
+ *
+ * @note rating: red
+ */
+
+#include <iostream>
+#include <string>
+
+#include "Application.hh"
+#include "ExecutionTrace.hh"
+#include "BinaryTraceReader.hh"
+
+int 
+main(int argc, char* argv[]) {
+
+    Application::initialize();    
+
+    if (argc < 2 || argc > 3) {
+        std::cerr 
+            << "usage: ttatraceconv trace_db [binary_trace]" << std::endl
+            << "The binary trace defaults to trace_db.bin. The database is "
+            << "created if it does not exist." << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const std::string traceFileName = argv[1];
+    const std::string binaryFileName =
+        argc == 3 ? std::string(argv[2]) : traceFileName + ".bin";
+
+    ExecutionTrace* traceDB = NULL;
+    try {
+        BinaryTraceReader reader(binaryFileName);
+        traceDB = ExecutionTrace::open(traceFileName);
+        std::size_t records = reader.convert(*traceDB);
+        delete traceDB; traceDB = NULL;
+        std::cout 
+            << records << " records stored in " << traceFileName 
+            << std::endl;
+    } catch (const Exception& e) {
+        delete traceDB; traceDB = NULL;
+        std::cerr << e.errorMessage() << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
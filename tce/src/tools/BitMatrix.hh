@@ -59,6 +59,11 @@ public:
     void shiftLeft();
     void orWith(const BitMatrix& another);
     bool conflictsWith(const BitMatrix& another) const;
+    bool rowConflictsWith(
+        int row, const BitMatrix& another, int anotherRow) const;
+    bool rowConflictsWith(
+        int row, const BitMatrix& another, int anotherRow,
+        const BitMatrix& third, int thirdRow) const;
     
     int rowCount() const;
     int columnCount() const;
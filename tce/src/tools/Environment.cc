@@ -79,7 +79,6 @@ vector<string> Environment::bitmapsPaths_;
 vector<string> Environment::manPaths_;
 vector<string> Environment::iconPaths_;
 vector<string> Environment::errorPaths_;
-vector<string> Environment::pathsToUse_;
 string Environment::newSchemaFileDir_ = "";
 string Environment::newDataFileDir_ = "";
 string Environment::newBitmapsFileDir_ = "";
@@ -161,8 +160,7 @@ string
 Environment::schemaDirPath(const std::string& prog) {
     initialize();
     string path = SCHEMA_DIR_NAME_ + FileSystem::DIRECTORY_SEPARATOR + prog;
-    pathsToUse_.assign(schemaPaths_.begin(), schemaPaths_.end());
-    string schemaPath = pathTo(path);
+    string schemaPath = pathTo(path, schemaPaths_);
     if (schemaPath == "" && newSchemaFileDir_ != "") {
         if (FileSystem::createDirectory(newSchemaFileDir_)) {
             return newSchemaFileDir_;
@@ -186,8 +184,7 @@ string
 Environment::dataDirPath(const std::string& prog) {
     initialize();
     string path = DATA_DIR_NAME_ + FileSystem::DIRECTORY_SEPARATOR + prog;
-    pathsToUse_.assign(dataPaths_.begin(), dataPaths_.end());
-    string dataPath = pathTo(path);
+    string dataPath = pathTo(path, dataPaths_);
     if (dataPath == "" && newDataFileDir_ != "") {
         if (FileSystem::createDirectory(newDataFileDir_)) {
             return newDataFileDir_;
@@ -212,8 +209,7 @@ Environment::bitmapsDirPath(const std::string& prog) {
     initialize();
     string path = DATA_DIR_NAME_ + FileSystem::DIRECTORY_SEPARATOR +
         BITMAPS_DIR_NAME_ + FileSystem::DIRECTORY_SEPARATOR + prog;
-    pathsToUse_.assign(bitmapsPaths_.begin(), bitmapsPaths_.end());
-    string bitmapsPath = pathTo(path);
+    string bitmapsPath = pathTo(path, bitmapsPaths_);
     if (bitmapsPath == "" && newBitmapsFileDir_ != "") {
         if (FileSystem::createDirectory(newBitmapsFileDir_)) {
             return newBitmapsFileDir_;
@@ -236,8 +232,7 @@ Environment::iconDirPath() {
     initialize();
     string path = DATA_DIR_NAME_ + FileSystem::DIRECTORY_SEPARATOR +
         ICON_DIR_NAME_;
-    pathsToUse_.assign(bitmapsPaths_.begin(), bitmapsPaths_.end());
-    string iconPath = pathTo(path);
+    string iconPath = pathTo(path, bitmapsPaths_);
     if (iconPath == "" && newIconFileDir_ != "") {
         if (FileSystem::createDirectory(newIconFileDir_)) {
             return newIconFileDir_;
@@ -260,8 +255,7 @@ string
 Environment::manDirPath(const std::string& prog) {
     initialize();
     string path = MAN_DIR_NAME_ + FileSystem::DIRECTORY_SEPARATOR + prog;
-    pathsToUse_.assign(manPaths_.begin(), manPaths_.end());
-    string manPath = pathTo(path);
+    string manPath = pathTo(path, manPaths_);
     if (manPath == "" && newManFileDir_ != "") {
         if (FileSystem::createDirectory(newManFileDir_)) {
             return newManFileDir_;
@@ -334,8 +328,7 @@ Environment::userConfPath(const std::string& fileName) {
 string
 Environment::errorLogFilePath() {
     initialize();
-    pathsToUse_.assign(errorPaths_.begin(), errorPaths_.end());
-    string errorPath = pathTo(ERROR_LOG_FILE_NAME_);
+    string errorPath = pathTo(ERROR_LOG_FILE_NAME_, errorPaths_);
     if (errorPath == "" && newErrorLogFileDir_ != "") {
         if (FileSystem::createDirectory(newErrorLogFileDir_)) {
             string filePath = newErrorLogFileDir_ +
@@ -446,18 +439,18 @@ Environment::~Environment() {
  * is found. In case the directory/file is not found in any of the search
  * paths, returns an empty string.
  *
- * @fixme this is not thread safe due to the use of pathsToUse_ member
- *        variable for data passing!
  * @param name The name of the searched directory/file.
+ * @param paths The search paths.
  * @return The path of the directory/file.
  */
 string
-Environment::pathTo(const std::string& name) {
+Environment::pathTo(
+    const std::string& name, const std::vector<std::string>& paths) {
 
-    // test the stored paths and try to open the file
-    for (unsigned int i = 0; i < pathsToUse_.size(); ++i) {
+    // test the given paths and try to open the file
+    for (unsigned int i = 0; i < paths.size(); ++i) {
         string path =
-            pathsToUse_[i] + FileSystem::DIRECTORY_SEPARATOR + name;
+            paths[i] + FileSystem::DIRECTORY_SEPARATOR + name;
 
         if (FileSystem::fileExists(path)) {
             return path;
@@ -1108,6 +1101,30 @@ Environment::llvmtceCachePath() {
     return path;
 }
 
+/**
+ * Returns full path to the directory of the cached OSAL operation
+ * definitions.
+ *
+ * The directory can be overridden with the environment variable
+ * TCE_OSAL_CACHE_DIR.
+ */
+string
+Environment::osalCachePath() {
+
+    std::string envPath = environmentVariable("TCE_OSAL_CACHE_DIR");
+    if (envPath != "") {
+        return envPath;
+    }
+
+    std::string path =
+        FileSystem::homeDirectory() +
+        FileSystem::DIRECTORY_SEPARATOR + string(".tce") +
+        FileSystem::DIRECTORY_SEPARATOR + string("osal") +
+        FileSystem::DIRECTORY_SEPARATOR + string("cache");
+
+    return path;
+}
+
 /**
  * Returns full paths to implementation tester vhdl testbench template 
  * directory
@@ -94,6 +94,7 @@ public:
     static std::string defaultTextEditorPath();
 
     static std::string llvmtceCachePath();
+    static std::string osalCachePath();
 
     static std::vector<std::string> implementationTesterTemplatePaths();
     static std::string simTraceDirPath();
@@ -102,7 +103,8 @@ private:
     Environment();
     ~Environment();
 
-    static std::string pathTo(const std::string& name);
+    static std::string pathTo(
+        const std::string& name, const std::vector<std::string>& paths);
     static inline void parsePathEnvVariable(std::vector<std::string>& paths);
 
     /// Name of the XML Schema directory.
@@ -134,8 +136,6 @@ private:
     static std::vector<std::string> iconPaths_;
     /// Error file search paths.
     static std::vector<std::string> errorPaths_;
-    /// Paths used in a particular search.
-    static std::vector<std::string> pathsToUse_;
 
     /// Directory for new schema file.
     static std::string newSchemaFileDir_;
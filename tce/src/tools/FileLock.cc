@@ -0,0 +1,93 @@
+/*
+    Copyright (c) 2002-2026 Tampere University.
+
+    This file is part of TTA-Based Codesign Environment (TCE).
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+ */
+/**
+ * @file FileLock.cc
+ *
+ * Definition of FileLock class.
+ *
+ * @note rating: red
+ */
+
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "FileLock.hh"
+
+/**
+ * Constructor.
+ *
+ * Blocks until the exclusive lock on the file is acquired.
+ *
+ * The previous holder removes the lock file before releasing the lock, so
+ * a lock acquired on a file that is no longer in the path is retried with
+ * a new file.
+ *
+ * @param lockFile Path to the lock file, created if it does not exist.
+ * @exception IOException If the lock file cannot be opened or locked.
+ */
+FileLock::FileLock(const std::string& lockFile) :
+    lockFile_(lockFile), fd_(-1) {
+
+    while (true) {
+        fd_ = open(lockFile.c_str(), O_CREAT | O_RDWR, 0666);
+        if (fd_ < 0) {
+            throw IOException(
+                __FILE__, __LINE__, __func__,
+                "Unable to open lock file " + lockFile + ".");
+        }
+        int result = 0;
+        do {
+            result = flock(fd_, LOCK_EX);
+        } while (result != 0 && errno == EINTR);
+        if (result != 0) {
+            close(fd_);
+            throw IOException(
+                __FILE__, __LINE__, __func__,
+                "Unable to lock file " + lockFile + ".");
+        }
+        struct stat locked;
+        struct stat current;
+        if (fstat(fd_, &locked) == 0 &&
+            stat(lockFile.c_str(), &current) == 0 &&
+            locked.st_dev == current.st_dev &&
+            locked.st_ino == current.st_ino) {
+            return;
+        }
+        close(fd_);
+    }
+}
+
+/**
+ * Destructor.
+ *
+ * Removes the lock file and releases the lock.
+ */
+FileLock::~FileLock() {
+    unlink(lockFile_.c_str());
+    flock(fd_, LOCK_UN);
+    close(fd_);
+}
@@ -0,0 +1,66 @@
+/*
+    Copyright (c) 2002-2026 Tampere University.
+
+    This file is part of TTA-Based Codesign Environment (TCE).
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+ */
+/**
+ * @file FileLock.hh
+ *
+ * Declaration of FileLock class.
+ *
+ * @note rating: red
+ */
+
+#ifndef TTA_FILE_LOCK_HH
+#define TTA_FILE_LOCK_HH
+
+#include <string>
+
+#include "Exception.hh"
+
+/**
+ * An exclusive advisory lock on a file, held for the lifetime of the
+ * object.
+ *
+ * The lock is shared between processes, which makes it usable for
+ * guarding files in directories that several tools write to at the same
+ * time, such as caches. The lock file is created if it does not exist
+ * and it is removed when the lock is released, so lock files are not left
+ * behind in the guarded directory.
+ */
+class FileLock {
+public:
+    FileLock(const std::string& lockFile);
+    virtual ~FileLock();
+
+private:
+    /// Copying not allowed.
+    FileLock(const FileLock&);
+    /// Assignment not allowed.
+    FileLock& operator=(const FileLock&);
+
+    /// Path to the lock file.
+    std::string lockFile_;
+    /// Descriptor of the open lock file.
+    int fd_;
+};
+
+#endif
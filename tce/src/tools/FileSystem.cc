@@ -33,6 +33,7 @@
  */
 
 #include <fstream>
+#include <sstream>
 #include <string>
 #include <vector>
 #include <glob.h>
@@ -364,6 +365,22 @@ FileSystem::lastModificationTime(const std::string& filePath) {
     return lastModTime;
 }
 
+/**
+ * Sets the last modification time of the file to the current time.
+ *
+ * @param filePath Path to the file.
+ * @return True if the time was updated, false otherwise.
+ */
+bool
+FileSystem::updateModificationTime(const std::string& filePath) {
+    try {
+        boost::filesystem::last_write_time(filePath, std::time(NULL));
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
 /**
  * Returns current size of the file in bytes.
  *
@@ -501,6 +518,22 @@ FileSystem::removeFileOrDirectory(const std::string& path) {
     }
 }
 
+/**
+ * Renames a file, replacing the target file if it exists.
+ *
+ * When the source and the target are in the same file system, the target
+ * is replaced atomically: other processes see either the old or the new
+ * file, never a partially written one.
+ *
+ * @param source The file to rename.
+ * @param target The new name of the file.
+ * @return True if the file was renamed, false otherwise.
+ */
+bool
+FileSystem::renameFile(const std::string& source, const std::string& target) {
+    return std::rename(source.c_str(), target.c_str()) == 0;
+}
+
 /**
  * Copies source file to target file.
  *
@@ -540,6 +573,82 @@ FileSystem::copy(const std::string& source, const std::string& target) {
     }
 }
 
+/**
+ * Reads the whole contents of the given file.
+ *
+ * @param file The file to read.
+ * @param contents Set to the contents of the file.
+ * @return True if the file could be read.
+ */
+static bool
+readFileContents(const std::string& file, std::string& contents) {
+    std::ifstream stream(file.c_str(), std::ios::in | std::ios::binary);
+    if (!stream.is_open()) {
+        return false;
+    }
+    std::ostringstream buffer;
+    buffer << stream.rdbuf();
+    contents = buffer.str();
+    return !stream.bad();
+}
+
+/**
+ * Copies source file to target file unless the target already has the same
+ * contents.
+ *
+ * Leaving an identical target untouched keeps its modification time, so
+ * tools that rebuild files by their timestamps do not redo the work.
+ *
+ * @param source File to be copied.
+ * @param target Target file of the copy operation.
+ * @return True if the file was copied, false if the target was up to date.
+ * @exception IOException in case the copying failed.
+ */
+bool
+FileSystem::copyIfChanged(
+    const std::string& source, const std::string& target) {
+
+    std::string sourceContents;
+    std::string targetContents;
+    if (!fileIsDirectory(target) &&
+        readFileContents(source, sourceContents) &&
+        readFileContents(target, targetContents) &&
+        sourceContents == targetContents) {
+        return false;
+    }
+    copy(source, target);
+    return true;
+}
+
+/**
+ * Writes the given contents to a file unless the file already has the same
+ * contents.
+ *
+ * @param file The file to write.
+ * @param contents The new contents of the file.
+ * @return True if the file was written, false if it was up to date.
+ * @exception IOException in case the file could not be written.
+ */
+bool
+FileSystem::writeIfChanged(
+    const std::string& file, const std::string& contents) {
+
+    std::string oldContents;
+    if (readFileContents(file, oldContents) && oldContents == contents) {
+        return false;
+    }
+    std::ofstream stream(
+        file.c_str(), std::ios::out | std::ios::trunc | std::ios::binary);
+    stream << contents;
+    stream.close();
+    if (!stream) {
+        throw IOException(
+            __FILE__, __LINE__, __func__,
+            "Unable to write file '" + file + "'.");
+    }
+    return true;
+}
+
 /**
  * Searches the given file in the given search paths and returns the
  * absolute path to the file.
@@ -112,6 +112,7 @@ public:
 
     // file detail functions
     static std::time_t lastModificationTime(const std::string& filePath);
+    static bool updateModificationTime(const std::string& filePath);
     static uintmax_t sizeInBytes(const std::string& filePath);
     
     // should this be moved to Application instead?
@@ -126,8 +127,14 @@ public:
     static std::string createTempDirectory(const std::string& path="/tmp");
     static bool createFile(const std::string& file);
     static bool removeFileOrDirectory(const std::string& path);
+    static bool renameFile(
+        const std::string& source, const std::string& target);
 
     static void copy(const std::string& source, const std::string& target);
+    static bool copyIfChanged(
+        const std::string& source, const std::string& target);
+    static bool writeIfChanged(
+        const std::string& file, const std::string& contents);
 
     static std::string findFileInSearchPaths(
         const std::vector<std::string>& searchPaths, const std::string& file);
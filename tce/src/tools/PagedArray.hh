@@ -78,7 +78,7 @@ public:
     PagedArray(std::size_t size);
     virtual ~PagedArray();
 
-    void write(IndexType index, const ValueTable data, std::size_t size);
+    void write(IndexType index, const ValueType* data, std::size_t size);
     void writeData(IndexType index, const ValueType& data);
     ValueType readData(IndexType index);
     void read(IndexType index, ValueVector& data, size_t size);
@@ -157,6 +157,40 @@ RelationalDBQueryResult::bindString(
     return;
 }
 
+/**
+ * Binds 64 bit integer type variable to a prepared sql statement.
+ */
+void
+RelationalDBQueryResult::bindInt64(
+    unsigned int /*position*/, long long /*value*/) {
+    return;
+}
+
+/**
+ * Binds floating point type variable to a prepared sql statement.
+ */
+void
+RelationalDBQueryResult::bindDouble(
+    unsigned int /*position*/, double /*value*/) {
+    return;
+}
+
+/**
+ * Binds NULL to a parameter of a prepared sql statement.
+ */
+void
+RelationalDBQueryResult::bindNull(unsigned int /*position*/) {
+    return;
+}
+
+/**
+ * Executes a prepared update statement with the current bindings.
+ */
+void
+RelationalDBQueryResult::execute() {
+    return;
+}
+
 /**
  * Resets s prepared sql statement.
  */
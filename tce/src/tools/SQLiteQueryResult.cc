@@ -225,6 +225,52 @@ SQLiteQueryResult::bindString(unsigned int position, const std::string& value) {
                 -1, NULL));
 }
 
+/**
+ * Binds 64 bit integer to sqlite statement at given position (1->)
+ */
+void
+SQLiteQueryResult::bindInt64(unsigned int position, long long value) {
+    connection_->throwIfSQLiteError(
+        sqlite3_bind_int64(statement_, position, value));
+}
+
+/**
+ * Binds double to sqlite statement at given position (1->)
+ */
+void
+SQLiteQueryResult::bindDouble(unsigned int position, double value) {
+    connection_->throwIfSQLiteError(
+        sqlite3_bind_double(statement_, position, value));
+}
+
+/**
+ * Binds NULL to sqlite statement at given position (1->)
+ */
+void
+SQLiteQueryResult::bindNull(unsigned int position) {
+    connection_->throwIfSQLiteError(sqlite3_bind_null(statement_, position));
+}
+
+/**
+ * Executes a compiled update statement with the current bindings.
+ *
+ * The statement is reset afterwards so it can be executed again with
+ * new bindings. Unlike next(), reports the errors of the execution.
+ *
+ * @exception RelationalDBException In case a database error occured.
+ */
+void
+SQLiteQueryResult::execute() {
+    int result = sqlite3_step(statement_);
+    if (result != SQLITE_DONE && result != SQLITE_ROW) {
+        // the detailed error code of the legacy interface is returned
+        // by reset
+        sqlite3_reset(statement_);
+        connection_->throwIfSQLiteError(result);
+    }
+    connection_->throwIfSQLiteError(sqlite3_reset(statement_));
+}
+
 /**
  * Resets compiled sqlite statement for new bindings and execution.
  */
@@ -63,6 +63,10 @@ public:
     virtual bool next();
     virtual void bindInt(unsigned int position, int value);
     virtual void bindString(unsigned int position, const std::string& value);
+    virtual void bindInt64(unsigned int position, long long value);
+    virtual void bindDouble(unsigned int position, double value);
+    virtual void bindNull(unsigned int position);
+    virtual void execute();
     virtual void reset();
 
 private:
@@ -159,6 +159,16 @@ public:
     void clearToZero();
     TCEString dump() const;
 
+    int elementCount(int elementWidth) const;
+    template <typename T>
+    T element(int index) const;
+    template <typename T>
+    void setElement(int index, const T& value);
+    template <typename T>
+    void elements(T* target, int first, int count) const;
+    template <typename T>
+    void setElements(const T* source, int first, int count);
+
     /// Array that contains SimValue's underlaying bytes in little endian.
     Byte rawData_[SIMVALUE_MAX_BYTE_SIZE];
 
@@ -200,4 +210,6 @@ private:
 
 #define SIMULATOR_MAX_INTWORD_BITWIDTH 32
 
+#include "SimValue.icc"
+
 #endif
@@ -0,0 +1,287 @@
+/*
+    Copyright (c) 2002-2026 Tampere University.
+
+    This file is part of TTA-Based Codesign Environment (TCE).
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+ */
+/**
+ * @file BitVectorTest.hh
+ *
+ * A test suite for BitVector.
+ *
+ * @note rating: red
+ */
+
+#ifndef TTA_BIT_VECTOR_TEST_HH
+#define TTA_BIT_VECTOR_TEST_HH
+
+#include <vector>
+#include <TestSuite.h>
+
+#include "BitVector.hh"
+
+/**
+ * Class that tests BitVector.
+ */
+class BitVectorTest : public CxxTest::TestSuite {
+public:
+    void setUp();
+    void tearDown();
+
+    void testPushBack();
+    void testFields();
+    void testSubVector();
+    void testComparison();
+
+private:
+    static void randomBits(
+        std::vector<bool>& reference, BitVector& bits, std::size_t count);
+    static BitVector::StorageWord referenceField(
+        const std::vector<bool>& reference, std::size_t position,
+        unsigned int width);
+};
+
+
+/**
+ * Called before each test.
+ */
+void
+BitVectorTest::setUp() {
+}
+
+
+/**
+ * Called after each test.
+ */
+void
+BitVectorTest::tearDown() {
+}
+
+
+/**
+ * Tests appending bits and integers, also across the storage words.
+ */
+void
+BitVectorTest::testPushBack() {
+    BitVector bits;
+    TS_ASSERT(bits.empty());
+
+    // 60 bits of 1010...
+    for (int i = 0; i < 30; i++) {
+        bits.pushBack(true);
+        bits.push_back(false);
+    }
+    TS_ASSERT_EQUALS(bits.size(), 60u);
+
+    // crosses the first word boundary
+    bits.pushBack(0xf0fULL, 12);
+    TS_ASSERT_EQUALS(bits.size(), 72u);
+    TS_ASSERT_EQUALS(bits.field(60, 12), 0xf0fULL);
+    TS_ASSERT_EQUALS(bits.field(56, 8), 0xafULL);
+    TS_ASSERT(bits[63]);
+    TS_ASSERT(!bits[64]);
+    TS_ASSERT(!bits[67]);
+    TS_ASSERT(bits[68]);
+
+    // only the low bits of the integer are appended
+    bits.pushBack(6ULL, 2);
+    TS_ASSERT_EQUALS(bits.field(72, 2), 2ULL);
+
+    // sizes over 64 bits are zero extended
+    bits.pushBack(~0ULL, 70);
+    TS_ASSERT_EQUALS(bits.size(), 144u);
+    TS_ASSERT_EQUALS(bits.field(74, 6), 0ULL);
+    TS_ASSERT_EQUALS(bits.field(80, 64), ~0ULL);
+
+    // vectors of any alignment
+    BitVector tail;
+    tail.pushBack(0x123456789abcdefULL, 61);
+    tail.pushBack(0x5ULL, 3);
+    tail.pushBack(0x1ULL, 1);
+    bits.pushBack(tail);
+    TS_ASSERT_EQUALS(bits.size(), 209u);
+    TS_ASSERT_EQUALS(bits.field(144, 61), 0x123456789abcdefULL);
+    TS_ASSERT_EQUALS(bits.field(205, 4), 0xbULL);
+
+    TS_ASSERT_THROWS(bits.at(209), OutOfRange);
+    TS_ASSERT(bits.at(208));
+
+    // new bits are zeroes even after shrinking
+    bits.resize(100);
+    bits.resize(200);
+    for (std::size_t i = 100; i < 200; i++) {
+        TS_ASSERT(!bits[i]);
+    }
+
+    bits.clear();
+    TS_ASSERT(bits.empty());
+    TS_ASSERT(bits.begin() == bits.end());
+}
+
+
+/**
+ * Tests reading and writing fields at all the word alignments.
+ */
+void
+BitVectorTest::testFields() {
+    std::vector<bool> reference;
+    BitVector bits;
+    randomBits(reference, bits, 300);
+
+    const unsigned int widths[] = {1, 3, 8, 31, 32, 33, 63, 64};
+    for (std::size_t position = 0; position < 200; position++) {
+        for (unsigned int w = 0; w < sizeof(widths) / sizeof(widths[0]);
+             w++) {
+            unsigned int width = widths[w];
+            TS_ASSERT_EQUALS(
+                bits.field(position, width),
+                referenceField(reference, position, width));
+        }
+    }
+
+    // overwrite fields that cross the word boundaries
+    BitVector::StorageWord value = 0xdeadbeefcafebabeULL;
+    bits.setField(100, value, 64);
+    TS_ASSERT_EQUALS(bits.field(100, 64), value);
+    for (unsigned int i = 0; i < 64; i++) {
+        reference[100 + i] = (value >> (63 - i)) & 1;
+    }
+    bits.setField(120, 0x5ULL, 20);
+    TS_ASSERT_EQUALS(bits.field(120, 20), 0x5ULL);
+    for (unsigned int i = 0; i < 20; i++) {
+        reference[120 + i] = (0x5ULL >> (19 - i)) & 1;
+    }
+    // the high bits of the value do not leak outside the field
+    bits.setField(190, ~0ULL, 3);
+    for (unsigned int i = 0; i < 3; i++) {
+        reference[190 + i] = true;
+    }
+    // wide fields are zero extended
+    bits.setField(200, 0x1ULL, 80);
+    for (unsigned int i = 0; i < 80; i++) {
+        reference[200 + i] = (i == 79);
+    }
+
+    for (std::size_t i = 0; i < reference.size(); i++) {
+        TS_ASSERT_EQUALS(bits[i], reference[i]);
+    }
+    for (std::size_t position = 90; position < 230; position++) {
+        TS_ASSERT_EQUALS(
+            bits.field(position, 64), referenceField(reference, position, 64));
+    }
+}
+
+
+/**
+ * Tests creating sub vectors.
+ */
+void
+BitVectorTest::testSubVector() {
+    std::vector<bool> reference;
+    BitVector bits;
+    randomBits(reference, bits, 200);
+
+    BitVector sub(bits, 60, 140);
+    TS_ASSERT_EQUALS(sub.size(), 81u);
+    for (std::size_t i = 0; i < sub.size(); i++) {
+        TS_ASSERT_EQUALS(sub[i], reference[60 + i]);
+    }
+
+    BitVector whole(bits, 0, 199);
+    TS_ASSERT(whole == bits);
+
+    BitVector single(bits, 64, 64);
+    TS_ASSERT_EQUALS(single.size(), 1u);
+    TS_ASSERT_EQUALS(single[0], reference[64]);
+
+    TS_ASSERT_THROWS(BitVector(bits, 10, 200), OutOfRange);
+    TS_ASSERT_THROWS(BitVector(bits, 10, 9), OutOfRange);
+}
+
+
+/**
+ * Tests the comparison operators.
+ */
+void
+BitVectorTest::testComparison() {
+    std::vector<bool> reference;
+    BitVector bits;
+    randomBits(reference, bits, 130);
+
+    BitVector copy;
+    copy.pushBack(bits);
+    TS_ASSERT(copy == bits);
+    TS_ASSERT(!(copy != bits));
+    TS_ASSERT(!(copy < bits));
+
+    // a prefix is smaller
+    BitVector prefix(bits, 0, 100);
+    TS_ASSERT(prefix != bits);
+    TS_ASSERT(prefix < bits);
+    TS_ASSERT(!(bits < prefix));
+
+    // the order is decided by the first differing bit
+    copy.setBit(129, !reference[129]);
+    TS_ASSERT(copy != bits);
+    TS_ASSERT_EQUALS(copy < bits, reference[129]);
+    TS_ASSERT_EQUALS(bits < copy, !reference[129]);
+
+    // bits dropped by shrinking do not affect the comparison
+    copy.resize(100);
+    copy.resize(101);
+    copy.setBit(100, reference[100]);
+    TS_ASSERT(copy == prefix);
+}
+
+
+/**
+ * Appends the given number of pseudo random bits to the vector and the
+ * reference.
+ */
+void
+BitVectorTest::randomBits(
+    std::vector<bool>& reference, BitVector& bits, std::size_t count) {
+
+    unsigned int seed = 12345;
+    for (std::size_t i = 0; i < count; i++) {
+        seed = seed * 1103515245 + 12345;
+        bool bit = (seed >> 16) & 1;
+        reference.push_back(bit);
+        bits.pushBack(bit);
+    }
+}
+
+
+/**
+ * Returns the given field of the reference bits.
+ */
+BitVector::StorageWord
+BitVectorTest::referenceField(
+    const std::vector<bool>& reference, std::size_t position,
+    unsigned int width) {
+
+    BitVector::StorageWord value = 0;
+    for (unsigned int i = 0; i < width; i++) {
+        value = (value << 1) | reference[position + i];
+    }
+    return value;
+}
+
+#endif
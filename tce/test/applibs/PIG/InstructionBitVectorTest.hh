@@ -0,0 +1,197 @@
+/*
+    Copyright (c) 2002-2026 Tampere University.
+
+    This file is part of TTA-Based Codesign Environment (TCE).
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+ */
+/**
+ * @file InstructionBitVectorTest.hh
+ *
+ * A test suite for InstructionBitVector.
+ *
+ * @note rating: red
+ */
+
+#ifndef TTA_INSTRUCTION_BIT_VECTOR_TEST_HH
+#define TTA_INSTRUCTION_BIT_VECTOR_TEST_HH
+
+#include <TestSuite.h>
+
+#include "InstructionBitVector.hh"
+#include "IndexBound.hh"
+#include "Machine.hh"
+#include "AddressSpace.hh"
+#include "Procedure.hh"
+#include "Instruction.hh"
+
+using TTAMachine::Machine;
+using TTAMachine::AddressSpace;
+using TTAProgram::Procedure;
+using TTAProgram::Instruction;
+
+/**
+ * Class that tests InstructionBitVector.
+ */
+class InstructionBitVectorTest : public CxxTest::TestSuite {
+public:
+    void setUp();
+    void tearDown();
+
+    void testInstructionBoundaries();
+    void testReferences();
+    void testPushBack();
+
+private:
+    /// Machine owning the address space.
+    Machine* machine_;
+    /// Procedure of the referenced instructions.
+    Procedure* procedure_;
+};
+
+
+/**
+ * Creates a procedure of three instructions to refer to.
+ */
+void
+InstructionBitVectorTest::setUp() {
+    machine_ = new Machine();
+    AddressSpace* space = new AddressSpace(
+        "instructions", 8, 0, 255, *machine_);
+    procedure_ = new Procedure("main", *space, 0);
+    for (int i = 0; i < 3; i++) {
+        procedure_->add(new Instruction());
+    }
+}
+
+
+/**
+ * Called after each test.
+ */
+void
+InstructionBitVectorTest::tearDown() {
+    delete procedure_;
+    delete machine_;
+}
+
+
+/**
+ * Tests marking the instruction starting points.
+ */
+void
+InstructionBitVectorTest::testInstructionBoundaries() {
+    InstructionBitVector bits;
+    TS_ASSERT_EQUALS(bits.instructionCount(), 0u);
+
+    bits.markInstructionStartingPoint(0);
+    bits.markInstructionStartingPoint(70);
+    bits.markInstructionStartingPoint(30);
+    // marking twice has no effect
+    bits.markInstructionStartingPoint(30);
+
+    TS_ASSERT_EQUALS(bits.instructionCount(), 3u);
+    TS_ASSERT_EQUALS(bits.instructionStartingPoint(0), 0u);
+    TS_ASSERT_EQUALS(bits.instructionStartingPoint(1), 30u);
+    TS_ASSERT_EQUALS(bits.instructionStartingPoint(2), 70u);
+    TS_ASSERT_THROWS(bits.instructionStartingPoint(3), OutOfRange);
+
+    InstructionBitVector copy(bits);
+    TS_ASSERT_EQUALS(copy.instructionCount(), 3u);
+}
+
+
+/**
+ * Tests fixing instruction references that cross the storage words.
+ */
+void
+InstructionBitVectorTest::testReferences() {
+    InstructionBitVector bits;
+    bits.resize(140);
+    bits.setField(0, ~0ULL, 60);
+
+    // one field that crosses the first word boundary
+    bits.startSettingInstructionReference(procedure_->instructionAt(2));
+    bits.addIndexBoundsForReference(IndexBound(60, 71));
+
+    // the address split in two fields, the second one crossing the
+    // second word boundary
+    bits.startSettingInstructionReference(procedure_->instructionAt(1));
+    bits.addIndexBoundsForReference(IndexBound(72, 75));
+    bits.addIndexBoundsForReference(IndexBound(125, 130));
+
+    bits.fixInstructionAddress(procedure_->instructionAt(2), 0xabc);
+    TS_ASSERT_EQUALS(bits.field(56, 4), 0xfULL);
+    TS_ASSERT_EQUALS(bits.field(60, 12), 0xabcULL);
+    TS_ASSERT_EQUALS(bits.field(72, 4), 0ULL);
+
+    // 0x3a5 = 1110 100101
+    bits.fixInstructionAddress(procedure_->instructionAt(1), 0x3a5);
+    TS_ASSERT_EQUALS(bits.field(72, 4), 0xeULL);
+    TS_ASSERT_EQUALS(bits.field(125, 6), 0x25ULL);
+    TS_ASSERT_EQUALS(bits.field(124, 1), 0ULL);
+    TS_ASSERT_EQUALS(bits.field(131, 9), 0ULL);
+
+    // refixing with a smaller address clears the high bits
+    bits.fixInstructionAddress(procedure_->instructionAt(2), 0x3);
+    TS_ASSERT_EQUALS(bits.field(60, 12), 0x3ULL);
+
+    // too large address
+    TS_ASSERT_THROWS(
+        bits.fixInstructionAddress(procedure_->instructionAt(2), 0x1000),
+        OutOfRange);
+}
+
+
+/**
+ * Tests that the references are moved and fixed when the vectors are
+ * concatenated.
+ */
+void
+InstructionBitVectorTest::testPushBack() {
+    InstructionBitVector bits;
+    bits.resize(70);
+    bits.fixInstructionAddress(procedure_->instructionAt(0), 0x5a);
+
+    InstructionBitVector tail;
+    tail.startSettingInstructionReference(procedure_->instructionAt(0));
+    tail.addIndexBoundsForReference(IndexBound(0, 7));
+    tail.startSettingInstructionReference(procedure_->instructionAt(2));
+    tail.addIndexBoundsForReference(IndexBound(8, 15));
+    tail.resize(16);
+
+    // the known address is fixed while concatenating
+    bits.pushBack(tail);
+    TS_ASSERT_EQUALS(bits.size(), 86u);
+    TS_ASSERT_EQUALS(bits.field(70, 8), 0x5aULL);
+    TS_ASSERT_EQUALS(bits.field(78, 8), 0ULL);
+
+    // the rest are fixed at their new position
+    bits.fixInstructionAddress(procedure_->instructionAt(2), 0xc3);
+    TS_ASSERT_EQUALS(bits.field(78, 8), 0xc3ULL);
+    TS_ASSERT_EQUALS(bits.field(0, 64), 0ULL);
+    TS_ASSERT_EQUALS(bits.field(64, 6), 0ULL);
+
+    // plain bit vectors do not carry references
+    BitVector plain;
+    plain.pushBack(0x1ffULL, 9);
+    bits.pushBack(plain);
+    TS_ASSERT_EQUALS(bits.field(86, 9), 0x1ffULL);
+}
+
+#endif
@@ -0,0 +1,281 @@
+/*
+    Copyright (c) 2002-2026 Tampere University.
+
+    This file is part of TTA-Based Codesign Environment (TCE).
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+ */
+/**
+ * @file MemorySystemTest.hh
+ *
+ * A test suite for loading memory images with MemorySystem.
+ *
+ * @note rating: red
+ */
+
+#ifndef TTA_MEMORY_SYSTEM_TEST_HH
+#define TTA_MEMORY_SYSTEM_TEST_HH
+
+#include <TestSuite.h>
+#include <string>
+#include <fstream>
+
+#include "MemorySystem.hh"
+#include "IdealSRAM.hh"
+#include "Machine.hh"
+#include "AddressSpace.hh"
+#include "FileSystem.hh"
+
+using TTAMachine::Machine;
+using TTAMachine::AddressSpace;
+
+/// The memory image file written by the tests.
+const std::string MEMORY_IMAGE_FILE = "memory_image.tmp";
+
+/**
+ * Class that tests loading memory images.
+ */
+class MemorySystemTest : public CxxTest::TestSuite {
+public:
+    void setUp();
+    void tearDown();
+
+    void testBinaryImage();
+    void testAsciiImage();
+    void testMemoryLines();
+    void testErrors();
+
+private:
+    void addMemory(
+        const std::string& name, int mauBits, bool littleEndian);
+    MemorySystem::MemoryPtr memory(const std::string& name);
+    static void writeImage(const std::string& content);
+
+    /// Machine owning the address spaces.
+    Machine* machine_;
+    /// The tested memory system.
+    MemorySystem* memorySystem_;
+};
+
+
+/**
+ * Creates memories of 16 MAUs with different MAU widths.
+ */
+void
+MemorySystemTest::setUp() {
+    machine_ = new Machine();
+    memorySystem_ = new MemorySystem(*machine_);
+    addMemory("bytes", 8, false);
+    addMemory("wide", 12, false);
+    addMemory("narrow", 5, false);
+    addMemory("little", 8, true);
+}
+
+
+/**
+ * Removes the memories and the image file.
+ */
+void
+MemorySystemTest::tearDown() {
+    delete memorySystem_;
+    delete machine_;
+    FileSystem::removeFileOrDirectory(MEMORY_IMAGE_FILE);
+}
+
+
+/**
+ * Tests loading binary images.
+ */
+void
+MemorySystemTest::testBinaryImage() {
+    writeImage(std::string("\x01\x02\x03\x04\x05", 5));
+    TS_ASSERT_EQUALS(
+        memorySystem_->loadImage(
+            "bytes", 2, MEMORY_IMAGE_FILE, MemorySystem::BINARY_IMAGE),
+        5u);
+    MemorySystem::MemoryPtr bytes = memory("bytes");
+    TS_ASSERT_EQUALS(bytes->read(1), 0u);
+    for (int i = 0; i < 5; i++) {
+        TS_ASSERT_EQUALS(bytes->read(2 + i), Memory::MAU(i + 1));
+    }
+    TS_ASSERT_EQUALS(bytes->read(7), 0u);
+
+    // 12-bit MAUs 0xabc, 0x123 and 0xfff followed by four padding bits
+    writeImage(std::string("\xab\xc1\x23\xff\xf0", 5));
+    TS_ASSERT_EQUALS(
+        memorySystem_->loadImage(
+            "wide", 0, MEMORY_IMAGE_FILE, MemorySystem::BINARY_IMAGE),
+        3u);
+    MemorySystem::MemoryPtr wide = memory("wide");
+    TS_ASSERT_EQUALS(wide->read(0), 0xabcu);
+    TS_ASSERT_EQUALS(wide->read(1), 0x123u);
+    TS_ASSERT_EQUALS(wide->read(2), 0xfffu);
+    TS_ASSERT_EQUALS(wide->read(3), 0u);
+}
+
+
+/**
+ * Tests loading ASCII and array images.
+ */
+void
+MemorySystemTest::testAsciiImage() {
+    writeImage("101010111100\n000100100011\n");
+    TS_ASSERT_EQUALS(
+        memorySystem_->loadImage(
+            "wide", 1, MEMORY_IMAGE_FILE, MemorySystem::ASCII_IMAGE),
+        2u);
+    MemorySystem::MemoryPtr wide = memory("wide");
+    TS_ASSERT_EQUALS(wide->read(0), 0u);
+    TS_ASSERT_EQUALS(wide->read(1), 0xabcu);
+    TS_ASSERT_EQUALS(wide->read(2), 0x123u);
+
+    // array image of 5-bit MAUs, the last row padded with two bits
+    writeImage("\"1010100011\",\n\"1111100\"");
+    TS_ASSERT_EQUALS(
+        memorySystem_->loadImage(
+            "narrow", 0, MEMORY_IMAGE_FILE, MemorySystem::ASCII_IMAGE),
+        3u);
+    MemorySystem::MemoryPtr narrow = memory("narrow");
+    TS_ASSERT_EQUALS(narrow->read(0), 21u);
+    TS_ASSERT_EQUALS(narrow->read(1), 3u);
+    TS_ASSERT_EQUALS(narrow->read(2), 31u);
+    TS_ASSERT_EQUALS(narrow->read(3), 0u);
+}
+
+
+/**
+ * Tests that the MAU order of the little-endian memory lines is restored.
+ */
+void
+MemorySystemTest::testMemoryLines() {
+    // generatebits -w 4 writes the MAUs 1, 2, 3, 4 as 4, 3, 2, 1
+    writeImage("00000100000000110000001000000001\n");
+    TS_ASSERT_EQUALS(
+        memorySystem_->loadImage(
+            "little", 0, MEMORY_IMAGE_FILE, MemorySystem::ASCII_IMAGE, 4),
+        4u);
+    MemorySystem::MemoryPtr little = memory("little");
+    for (int i = 0; i < 4; i++) {
+        TS_ASSERT_EQUALS(little->read(i), Memory::MAU(i + 1));
+    }
+
+    // the last line is padded before the reversal
+    writeImage(std::string("\x02\x01\x00\x03", 4));
+    TS_ASSERT_EQUALS(
+        memorySystem_->loadImage(
+            "little", 8, MEMORY_IMAGE_FILE, MemorySystem::BINARY_IMAGE, 2),
+        4u);
+    TS_ASSERT_EQUALS(little->read(8), 1u);
+    TS_ASSERT_EQUALS(little->read(9), 2u);
+    TS_ASSERT_EQUALS(little->read(10), 3u);
+    TS_ASSERT_EQUALS(little->read(11), 0u);
+
+    // big-endian images are loaded in the file order
+    writeImage(std::string("\x04\x03\x02\x01", 4));
+    TS_ASSERT_EQUALS(
+        memorySystem_->loadImage(
+            "bytes", 0, MEMORY_IMAGE_FILE, MemorySystem::BINARY_IMAGE, 4),
+        4u);
+    MemorySystem::MemoryPtr bytes = memory("bytes");
+    for (int i = 0; i < 4; i++) {
+        TS_ASSERT_EQUALS(bytes->read(i), Memory::MAU(4 - i));
+    }
+}
+
+
+/**
+ * Tests that nothing is written from images that do not fit.
+ */
+void
+MemorySystemTest::testErrors() {
+    writeImage(std::string(10, '\x55'));
+    TS_ASSERT_THROWS(
+        memorySystem_->loadImage(
+            "bytes", 8, MEMORY_IMAGE_FILE, MemorySystem::BINARY_IMAGE),
+        OutOfRange);
+    MemorySystem::MemoryPtr bytes = memory("bytes");
+    for (int i = 0; i < 16; i++) {
+        TS_ASSERT_EQUALS(bytes->read(i), 0u);
+    }
+    TS_ASSERT_THROWS(
+        memorySystem_->loadImage(
+            "bytes", 17, MEMORY_IMAGE_FILE, MemorySystem::BINARY_IMAGE),
+        OutOfRange);
+    TS_ASSERT_THROWS(
+        memorySystem_->loadImage(
+            "bytes", 0, MEMORY_IMAGE_FILE, MemorySystem::BINARY_IMAGE, 0),
+        OutOfRange);
+
+    // 80 ASCII bits are 16 MAUs of 5 bits, one more than fits at offset 1
+    writeImage(std::string(80, '1'));
+    TS_ASSERT_THROWS(
+        memorySystem_->loadImage(
+            "narrow", 1, MEMORY_IMAGE_FILE, MemorySystem::ASCII_IMAGE),
+        OutOfRange);
+    TS_ASSERT_EQUALS(memory("narrow")->read(1), 0u);
+    TS_ASSERT_EQUALS(
+        memorySystem_->loadImage(
+            "narrow", 0, MEMORY_IMAGE_FILE, MemorySystem::ASCII_IMAGE),
+        16u);
+    TS_ASSERT_EQUALS(memory("narrow")->read(15), 31u);
+
+    TS_ASSERT_THROWS(
+        memorySystem_->loadImage(
+            "bytes", 0, "no_such_image", MemorySystem::BINARY_IMAGE),
+        IOException);
+    TS_ASSERT_THROWS(
+        memorySystem_->loadImage(
+            "none", 0, MEMORY_IMAGE_FILE, MemorySystem::BINARY_IMAGE),
+        InstanceNotFound);
+}
+
+
+/**
+ * Adds a memory of 16 MAUs to the memory system.
+ */
+void
+MemorySystemTest::addMemory(
+    const std::string& name, int mauBits, bool littleEndian) {
+
+    AddressSpace* space = new AddressSpace(name, mauBits, 0, 15, *machine_);
+    memorySystem_->addAddressSpace(
+        *space, MemorySystem::MemoryPtr(
+            new IdealSRAM(0, 15, mauBits, littleEndian)));
+}
+
+
+/**
+ * Returns the memory of the given address space.
+ */
+MemorySystem::MemoryPtr
+MemorySystemTest::memory(const std::string& name) {
+    return memorySystem_->memory(name);
+}
+
+
+/**
+ * Writes the memory image file.
+ */
+void
+MemorySystemTest::writeImage(const std::string& content) {
+    std::ofstream image(MEMORY_IMAGE_FILE.c_str(), std::ios::binary);
+    image << content;
+}
+
+#endif
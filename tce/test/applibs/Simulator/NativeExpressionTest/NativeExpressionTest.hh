@@ -0,0 +1,204 @@
+/*
+    Copyright (c) 2002-2026 Tampere University.
+
+    This file is part of TTA-Based Codesign Environment (TCE).
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+ */
+/**
+ * @file NativeExpressionTest.hh
+ *
+ * A test suite for NativeExpression and its use in the stop points.
+ *
+ * @note rating: red
+ */
+
+#ifndef TTA_NATIVE_EXPRESSION_TEST_HH
+#define TTA_NATIVE_EXPRESSION_TEST_HH
+
+#include <TestSuite.h>
+#include <string>
+
+#include "NativeExpression.hh"
+#include "SimulatorFrontend.hh"
+#include "StopPointManager.hh"
+#include "Breakpoint.hh"
+#include "Watch.hh"
+#include "RegisterState.hh"
+#include "TclConditionScript.hh"
+#include "ExpressionScript.hh"
+#include "SimValue.hh"
+
+/// A machine and a program scheduled for it.
+const std::string NATIVE_TEST_DATA =
+    "../../Scheduler/ProgramRepresentations/ControlFlowGraph/"
+    "ControlFlowGraphTest/data/";
+const std::string NATIVE_TEST_MACHINE =
+    NATIVE_TEST_DATA + "3_bus_reduced_connectivity_shortimms.adf";
+const std::string NATIVE_TEST_PROGRAM =
+    NATIVE_TEST_DATA + "3_bus_reduced_connectivity_shortimms.tpef";
+
+/**
+ * Class that tests NativeExpression.
+ */
+class NativeExpressionTest : public CxxTest::TestSuite {
+public:
+    void setUp();
+    void tearDown();
+
+    void testConditions();
+    void testCommands();
+    void testStopPoints();
+
+private:
+    void setRegister(int value);
+
+    /// The simulator whose state the expressions read.
+    SimulatorFrontend* frontend_;
+};
+
+/**
+ * Called before each test.
+ *
+ * Loads the machine and the program, which initializes the simulation.
+ */
+void
+NativeExpressionTest::setUp() {
+    frontend_ = new SimulatorFrontend();
+    frontend_->loadMachine(NATIVE_TEST_MACHINE);
+    frontend_->loadProgram(NATIVE_TEST_PROGRAM);
+}
+
+/**
+ * Called after each test.
+ */
+void
+NativeExpressionTest::tearDown() {
+    delete frontend_;
+    frontend_ = NULL;
+}
+
+/**
+ * Sets the value of the register the tested expressions read.
+ */
+void
+NativeExpressionTest::setRegister(int value) {
+    RegisterState& reg =
+        dynamic_cast<RegisterState&>(frontend_->findRegister("integer0", 1));
+    SimValue simValue(32);
+    simValue = value;
+    reg.setValue(simValue);
+}
+
+/**
+ * Tests compiling and evaluating conditions.
+ */
+void
+NativeExpressionTest::testConditions() {
+    NativeExpression::Pointer condition = NativeExpression::compile(
+        "[info registers integer0 1] == 5 && [info proc cycles] >= 0",
+        *frontend_);
+    TS_ASSERT(condition);
+
+    setRegister(5);
+    TS_ASSERT_EQUALS(condition->value(), 1);
+    setRegister(6);
+    TS_ASSERT_EQUALS(condition->value(), 0);
+
+    NativeExpression::Pointer arithmetic = NativeExpression::compile(
+        "([info registers integer0 1] + 0x10) * 2 - 1", *frontend_);
+    TS_ASSERT(arithmetic);
+    TS_ASSERT_EQUALS(arithmetic->value(), (6 + 16) * 2 - 1);
+
+    // forms that are left to Tcl
+    TS_ASSERT(!NativeExpression::compile(
+                  "[info registers integer0 1] << 2", *frontend_));
+    TS_ASSERT(!NativeExpression::compile(
+                  "[info registers nonexisting 1] == 0", *frontend_));
+    TS_ASSERT(!NativeExpression::compile("$foo == 1", *frontend_));
+    TS_ASSERT(!NativeExpression::compile("010 == 8", *frontend_));
+}
+
+/**
+ * Tests compiling and evaluating watched commands.
+ */
+void
+NativeExpressionTest::testCommands() {
+    NativeExpression::Pointer reg = NativeExpression::compileCommand(
+        "info registers integer0 1", *frontend_);
+    TS_ASSERT(reg);
+    setRegister(42);
+    TS_ASSERT_EQUALS(reg->value(), 42);
+
+    NativeExpression::Pointer expression = NativeExpression::compileCommand(
+        "expr {[info registers integer0 1] + 1}", *frontend_);
+    TS_ASSERT(expression);
+    TS_ASSERT_EQUALS(expression->value(), 43);
+
+    NativeExpression::Pointer cycles = NativeExpression::compileCommand(
+        "info proc cycles", *frontend_);
+    TS_ASSERT(cycles);
+    TS_ASSERT_EQUALS(cycles->value(), 0);
+
+    // a watched command is not an expression
+    TS_ASSERT(!NativeExpression::compileCommand(
+                  "[info registers integer0 1] + 1", *frontend_));
+    TS_ASSERT(!NativeExpression::compileCommand("puts foo", *frontend_));
+}
+
+/**
+ * Tests that the stop point manager gives the compiled expressions to the
+ * conditions and the watches.
+ *
+ * The scripts have no interpreter, so they could not be evaluated with Tcl.
+ */
+void
+NativeExpressionTest::testStopPoints() {
+    StopPointManager& manager = frontend_->stopPointManager();
+
+    Breakpoint breakpoint(*frontend_, 0);
+    const unsigned int breakpointHandle = manager.add(breakpoint);
+    TS_ASSERT(!manager.stopPointWithHandleConst(
+                  breakpointHandle).hasNativeCondition());
+    manager.setCondition(
+        breakpointHandle,
+        TclConditionScript(NULL, "[info registers integer0 1] == 5"));
+    TS_ASSERT(manager.stopPointWithHandleConst(
+                  breakpointHandle).hasNativeCondition());
+    manager.setCondition(breakpointHandle, TclConditionScript(NULL, "$foo"));
+    TS_ASSERT(!manager.stopPointWithHandleConst(
+                  breakpointHandle).hasNativeCondition());
+
+    Watch watch(
+        *frontend_, ExpressionScript(NULL, "info registers integer0 1"));
+    const unsigned int watchHandle = manager.add(watch);
+    const Watch& addedWatch = dynamic_cast<const Watch&>(
+        manager.stopPointWithHandleConst(watchHandle));
+    TS_ASSERT(addedWatch.hasNativeExpression());
+
+    Watch tclWatch(*frontend_, ExpressionScript(NULL, "puts foo"));
+    const unsigned int tclWatchHandle = manager.add(tclWatch);
+    TS_ASSERT(!dynamic_cast<const Watch&>(
+                  manager.stopPointWithHandleConst(
+                      tclWatchHandle)).hasNativeExpression());
+
+    manager.deleteAll();
+}
+
+#endif
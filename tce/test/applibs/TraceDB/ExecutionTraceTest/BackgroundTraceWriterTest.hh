@@ -0,0 +1,124 @@
+/*
+    Copyright (c) 2002-2026 Tampere University.
+
+    This file is part of TTA-Based Codesign Environment (TCE).
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+ */
+/**
+ * @file BackgroundTraceWriterTest.hh
+ *
+ * A test suite for BackgroundTraceWriter.
+ *
+ * @note rating: red
+ */
+
+#ifndef TTA_BACKGROUND_TRACE_WRITER_TEST_HH
+#define TTA_BACKGROUND_TRACE_WRITER_TEST_HH
+
+#include <TestSuite.h>
+#include <string>
+
+#include "Exception.hh"
+#include "ExecutionTrace.hh"
+#include "InstructionExecution.hh"
+#include "BackgroundTraceWriter.hh"
+
+/**
+ * Class that tests writing the trace in a background thread.
+ */
+class BackgroundTraceWriterTest : public CxxTest::TestSuite {
+public:
+    void testBlockWhenFull();
+    void testDropWhenFull();
+};
+
+/**
+ * Tests that all records are written when the simulation waits for the
+ * writer.
+ *
+ * The buffers are kept small to make them fill up.
+ */
+void
+BackgroundTraceWriterTest::testBlockWhenFull() {
+
+    const int RECORDS = 10000;
+    ExecutionTrace* traceDB = NULL;
+    TS_ASSERT_THROWS_NOTHING(
+        traceDB = ExecutionTrace::open("data/background.tdb"));
+    traceDB->startBackgroundWriter(16, false);
+    for (int i = 0; i < RECORDS; ++i) {
+        traceDB->addInstructionExecution(i, i % 100);
+    }
+    traceDB->addProcedureTransfer(3, 10, 1, ExecutionTrace::PT_ENTRY);
+    traceDB->stopBackgroundWriter();
+
+    const BackgroundTraceWriter* writer = traceDB->backgroundWriter();
+    TS_ASSERT(writer != NULL);
+    TS_ASSERT_EQUALS(
+        writer->writtenRecords(), static_cast<std::size_t>(RECORDS + 1));
+    TS_ASSERT_EQUALS(writer->droppedRecords(), static_cast<std::size_t>(0));
+    TS_ASSERT_EQUALS(writer->failedRecords(), static_cast<std::size_t>(0));
+
+    // records added after stopping are written directly
+    TS_ASSERT_THROWS_NOTHING(
+        traceDB->addInstructionExecution(RECORDS, 0));
+    TS_ASSERT_THROWS(traceDB->addInstructionExecution(0, 0), IOException);
+
+    InstructionExecution& ie = traceDB->instructionExecutions();
+    for (int i = 0; i < RECORDS; ++i) {
+        TS_ASSERT_EQUALS(ie.cycle(), static_cast<ClockCycleCount>(i));
+        TS_ASSERT_EQUALS(
+            ie.address(), static_cast<InstructionAddress>(i % 100));
+        ie.next();
+    }
+    TS_ASSERT_EQUALS(ie.cycle(), static_cast<ClockCycleCount>(RECORDS));
+    TS_ASSERT_EQUALS(ie.hasNext(), false);
+    delete traceDB;
+    traceDB = NULL;
+}
+
+/**
+ * Tests that the dropped and the written records add up when records
+ * are dropped from full buffers.
+ */
+void
+BackgroundTraceWriterTest::testDropWhenFull() {
+
+    const int RECORDS = 10000;
+    ExecutionTrace* traceDB = NULL;
+    TS_ASSERT_THROWS_NOTHING(
+        traceDB = ExecutionTrace::open("data/background2.tdb"));
+    traceDB->startBackgroundWriter(16, true);
+    for (int i = 0; i < RECORDS; ++i) {
+        traceDB->addInstructionExecution(i, 0);
+    }
+    traceDB->stopBackgroundWriter();
+
+    const BackgroundTraceWriter* writer = traceDB->backgroundWriter();
+    TS_ASSERT_EQUALS(
+        writer->writtenRecords() + writer->droppedRecords(),
+        static_cast<std::size_t>(RECORDS));
+    TS_ASSERT_EQUALS(
+        writer->backpressuredRecords(), static_cast<std::size_t>(0));
+    delete traceDB;
+    traceDB = NULL;
+}
+
+#endif
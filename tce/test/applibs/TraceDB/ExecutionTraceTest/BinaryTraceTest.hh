@@ -0,0 +1,153 @@
+/*
+    Copyright (c) 2002-2026 Tampere University.
+
+    This file is part of TTA-Based Codesign Environment (TCE).
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+ */
+/**
+ * @file BinaryTraceTest.hh
+ *
+ * A test suite for BinaryTraceWriter and BinaryTraceReader.
+ *
+ * @note rating: red
+ */
+
+#ifndef TTA_BINARY_TRACE_TEST_HH
+#define TTA_BINARY_TRACE_TEST_HH
+
+#include <TestSuite.h>
+#include <string>
+#include <fstream>
+
+#include "Exception.hh"
+#include "ExecutionTrace.hh"
+#include "InstructionExecution.hh"
+#include "BinaryTraceWriter.hh"
+#include "BinaryTraceReader.hh"
+#include "SQLite.hh"
+#include "RelationalDBConnection.hh"
+#include "RelationalDBQueryResult.hh"
+#include "DataObject.hh"
+
+/**
+ * Class that tests the binary trace format.
+ */
+class BinaryTraceTest : public CxxTest::TestSuite {
+public:
+    void testRoundTrip();
+    void testInvalidFile();
+};
+
+const std::string binaryTraceFile = "data/binary.tdb.bin";
+const std::string convertedDBFile = "data/binary.tdb";
+
+/**
+ * Tests that the records written to a binary trace end up in the
+ * trace database.
+ *
+ * More records than fit in one block are written to test that the
+ * delta encoding continues correctly in the following blocks.
+ */
+void
+BinaryTraceTest::testRoundTrip() {
+
+    const int RECORDS = 10000;
+    BinaryTraceWriter* writer = NULL;
+    TS_ASSERT_THROWS_NOTHING(writer = new BinaryTraceWriter(binaryTraceFile));
+    for (int i = 0; i < RECORDS; ++i) {
+        // addresses jump backwards every now and then like in loops
+        writer->addInstructionExecution(i, (i * 7) % 1000);
+    }
+    SimValue value(32);
+    value = static_cast<UIntWord>(42);
+    writer->addBusActivity(0, "B1", "seg1", false, value);
+    writer->addBusActivity(0, "B2", "seg1", true);
+    writer->addProcedureTransfer(5, 100, 2, ExecutionTrace::PT_ENTRY);
+    delete writer;
+    writer = NULL;
+
+    ExecutionTrace* traceDB = NULL;
+    TS_ASSERT_THROWS_NOTHING(
+        traceDB = ExecutionTrace::open(convertedDBFile));
+    BinaryTraceReader reader(binaryTraceFile);
+    TS_ASSERT_EQUALS(
+        reader.convert(*traceDB), static_cast<std::size_t>(RECORDS + 3));
+
+    InstructionExecution& ie = traceDB->instructionExecutions();
+    for (int i = 0; i < RECORDS; ++i) {
+        TS_ASSERT_EQUALS(ie.cycle(), static_cast<ClockCycleCount>(i));
+        TS_ASSERT_EQUALS(
+            ie.address(), static_cast<InstructionAddress>((i * 7) % 1000));
+        if (ie.hasNext()) {
+            ie.next();
+        }
+    }
+    TS_ASSERT_EQUALS(ie.hasNext(), false);
+    delete traceDB;
+    traceDB = NULL;
+
+    // the procedure transfers are stored in the call trace file
+    std::ifstream calls((convertedDBFile + ".calls").c_str());
+    ClockCycleCount cycle = 0;
+    InstructionAddress address = 0;
+    InstructionAddress sourceAddress = 0;
+    int type = -1;
+    TS_ASSERT(calls >> cycle >> address >> sourceAddress >> type);
+    TS_ASSERT_EQUALS(cycle, static_cast<ClockCycleCount>(5));
+    TS_ASSERT_EQUALS(address, static_cast<InstructionAddress>(100));
+    TS_ASSERT_EQUALS(sourceAddress, static_cast<InstructionAddress>(2));
+    TS_ASSERT_EQUALS(type, static_cast<int>(ExecutionTrace::PT_ENTRY));
+    TS_ASSERT(!(calls >> cycle));
+    calls.close();
+
+    SQLite db;
+    RelationalDBConnection& connection = db.connect(convertedDBFile);
+    RelationalDBQueryResult* result = connection.query(
+        "SELECT cycle, bus, segment, squash, data_as_int "
+        "FROM bus_activity ORDER BY bus;");
+    TS_ASSERT(result->hasNext());
+    result->next();
+    TS_ASSERT_EQUALS(result->data(0).integerValue(), 0);
+    TS_ASSERT_EQUALS(result->data(1).stringValue(), "B1");
+    TS_ASSERT_EQUALS(result->data(2).stringValue(), "seg1");
+    TS_ASSERT_EQUALS(result->data(3).stringValue(), "FALSE");
+    TS_ASSERT_EQUALS(result->data(4).integerValue(), 42);
+    TS_ASSERT(result->hasNext());
+    result->next();
+    TS_ASSERT_EQUALS(result->data(0).integerValue(), 0);
+    TS_ASSERT_EQUALS(result->data(1).stringValue(), "B2");
+    TS_ASSERT_EQUALS(result->data(2).stringValue(), "seg1");
+    TS_ASSERT_EQUALS(result->data(3).stringValue(), "TRUE");
+    TS_ASSERT(!result->hasNext());
+    delete result;
+    db.close(connection);
+}
+
+/**
+ * Tests that files which are not binary traces are rejected.
+ */
+void
+BinaryTraceTest::testInvalidFile() {
+    TS_ASSERT_THROWS(
+        BinaryTraceReader reader("data/nonexisting.bin"), IOException);
+    TS_ASSERT_THROWS(BinaryTraceReader reader(convertedDBFile), IOException);
+}
+
+#endif
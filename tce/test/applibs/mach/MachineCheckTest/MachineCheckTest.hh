@@ -37,6 +37,8 @@
 #include "MachineConnectivityCheck.hh"
 #include "FUPort.hh"
 #include "Machine.hh"
+#include "FunctionUnit.hh"
+#include "Socket.hh"
 #include "OperationBindingCheck.hh"
 #include "RegisterQuantityCheck.hh"
 #include "MachineCheckResults.hh"
@@ -125,6 +127,16 @@ MachineCheckTest::testMachineConnectivityCheck() {
         !MachineConnectivityCheck::isConnected(
             findFUPort(*targetMachine, "fu15", "r0"),
             findRFPort(*targetMachine, "integer0", "wr0")));
+
+    // editing the machine invalidates the cached connectivity
+    TTAMachine::BaseFUPort* trigger =
+        targetMachine->functionUnitNavigator().item("fu16")->port("trigger");
+    trigger->detachSocket(*trigger->inputSocket());
+    TS_ASSERT(
+        !MachineConnectivityCheck::isConnected(
+            findFUPort(*targetMachine, "fu16", "r0"), *trigger));
+
+    delete targetMachine;
 }
 
 void
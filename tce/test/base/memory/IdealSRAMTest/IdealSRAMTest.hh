@@ -35,7 +35,10 @@
 
 #include <TestSuite.h>
 
+#include <vector>
+
 #include "IdealSRAM.hh"
+#include "Exception.hh"
 
 /**
  * Class for testing IdealSRAM.
@@ -46,6 +49,9 @@ public:
     void tearDown();
 
     void testBasicInterface();
+    void testWatches();
+    void testWriteBlock();
+    void testReadBlock();
 
 private:
     /// Starting point of the memory.
@@ -60,6 +66,28 @@ private:
     static const int ALIGNMENT;
 };
 
+/**
+ * Records the watch notifications.
+ */
+class WatchRecorder : public MemoryWatchListener {
+public:
+    WatchRecorder() : reads(0), writes(0), lastHandle(0), lastAddress(0) {}
+    virtual void memoryWatchTriggered(
+        unsigned int handle, Word address, int, bool write) {
+        if (write) {
+            ++writes;
+        } else {
+            ++reads;
+        }
+        lastHandle = handle;
+        lastAddress = address;
+    }
+    int reads;
+    int writes;
+    unsigned int lastHandle;
+    Word lastAddress;
+};
+
 const Word IdealSRAMTest::START = 100;
 const Word IdealSRAMTest::END = 1000;
 const Word IdealSRAMTest::MAUSIZE = 8;
@@ -127,4 +155,121 @@ IdealSRAMTest::testBasicInterface() {
 }
 
 
+/**
+ * Tests that the watches are notified of the accesses to their ranges only.
+ */
+void
+IdealSRAMTest::testWatches() {
+
+    IdealSRAM memory(START, END, MAUSIZE, false);
+    WatchRecorder recorder;
+    UIntWord result;
+
+    TS_ASSERT(!memory.hasWatches());
+    memory.addWatch(1, 200, 203, false, true, recorder);
+    memory.addWatch(2, 300, 300, true, false, recorder);
+    TS_ASSERT(memory.hasWatches());
+
+    // accesses outside the ranges
+    memory.write(196, 4, 1);
+    memory.write(204, 4, 1);
+    memory.read(200, 4, result);
+    memory.write(301, 1, 1);
+    TS_ASSERT_EQUALS(recorder.reads, 0);
+    TS_ASSERT_EQUALS(recorder.writes, 0);
+
+    // a write overlapping the end of the first range
+    memory.write(198, 4, 1);
+    TS_ASSERT_EQUALS(recorder.writes, 1);
+    TS_ASSERT_EQUALS(recorder.lastHandle, 1u);
+    TS_ASSERT_EQUALS(recorder.lastAddress, 198u);
+
+    memory.read(298, 4, result);
+    TS_ASSERT_EQUALS(recorder.reads, 1);
+    TS_ASSERT_EQUALS(recorder.lastHandle, 2u);
+
+    memory.removeWatch(1);
+    memory.write(200, 1, 1);
+    TS_ASSERT_EQUALS(recorder.writes, 1);
+
+    // a floating point load notifies a watch only once
+    FloatWord f;
+    DoubleWord d;
+    memory.read(300, f);
+    TS_ASSERT_EQUALS(recorder.reads, 2);
+    memory.readLE(297, f);
+    TS_ASSERT_EQUALS(recorder.reads, 3);
+    memory.readBE(296, d);
+    TS_ASSERT_EQUALS(recorder.reads, 4);
+    memory.readLE(300, d);
+    TS_ASSERT_EQUALS(recorder.reads, 5);
+    memory.read(301, d);
+    TS_ASSERT_EQUALS(recorder.reads, 5);
+
+    memory.removeWatch(2);
+    TS_ASSERT(!memory.hasWatches());
+    memory.read(300, 1, result);
+    TS_ASSERT_EQUALS(recorder.reads, 5);
+}
+
+/**
+ * Tests that block writes are visible immediately, also across the pages
+ * of the storage, and that they are range checked.
+ */
+void
+IdealSRAMTest::testWriteBlock() {
+
+    IdealSRAM memory(0, 5000, MAUSIZE, false);
+    WatchRecorder recorder;
+    memory.addWatch(1, 3000, 3000, false, true, recorder);
+
+    std::vector<Memory::MAU> data(2500);
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        data[i] = i % 256;
+    }
+    memory.writeBlock(1000, &data[0], data.size());
+    TS_ASSERT_EQUALS(recorder.writes, 1);
+
+    UIntWord result;
+    memory.read(999, 1, result);
+    TS_ASSERT_EQUALS(result, static_cast<UIntWord>(0));
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        memory.read(1000 + i, 1, result);
+        TS_ASSERT_EQUALS(result, data[i]);
+    }
+    memory.read(3500, 1, result);
+    TS_ASSERT_EQUALS(result, static_cast<UIntWord>(0));
+
+    TS_ASSERT_THROWS(
+        memory.writeBlock(4000, &data[0], data.size()), OutOfRange);
+}
+
+/**
+ * Tests that block reads see the committed data, also across the pages of
+ * the storage and from unwritten pages.
+ */
+void
+IdealSRAMTest::testReadBlock() {
+
+    IdealSRAM memory(0, 5000, MAUSIZE, false);
+    for (Word address = 1020; address < 1030; ++address) {
+        memory.write(address, 1, address % 256);
+    }
+    memory.advanceClock();
+
+    std::vector<Memory::MAU> data(2000, 0xff);
+    memory.readBlock(1010, &data[0], data.size());
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        const Word address = 1010 + i;
+        if (address >= 1020 && address < 1030) {
+            TS_ASSERT_EQUALS(data[i], address % 256);
+        } else {
+            TS_ASSERT_EQUALS(data[i], static_cast<Memory::MAU>(0));
+        }
+    }
+
+    TS_ASSERT_THROWS(
+        memory.readBlock(4000, &data[0], data.size()), OutOfRange);
+}
+
 #endif
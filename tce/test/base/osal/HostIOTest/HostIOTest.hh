@@ -0,0 +1,328 @@
+/*
+    Copyright (c) 2002-2026 Tampere University.
+
+    This file is part of TTA-Based Codesign Environment (TCE).
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+ */
+/**
+ * @file HostIOTest.hh
+ *
+ * A test suite for the host call operations of the host_io module.
+ *
+ * @note rating: red
+ */
+
+#ifndef TTA_HOST_IO_TEST_HH
+#define TTA_HOST_IO_TEST_HH
+
+#include <TestSuite.h>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <unistd.h>
+
+#include "OperationPool.hh"
+#include "Operation.hh"
+#include "OperationContext.hh"
+#include "SimValue.hh"
+#include "IdealSRAM.hh"
+#include "FileSystem.hh"
+#include "Exception.hh"
+
+/// The host_io flags of HOST_OPEN.
+const int HOST_IO_READ = 0x01;
+const int HOST_IO_WRITE = 0x02;
+const int HOST_IO_CREATE = 0x08;
+const int HOST_IO_TRUNCATE = 0x10;
+
+/**
+ * Class that tests the host call operations.
+ */
+class HostIOTest : public CxxTest::TestSuite {
+public:
+    void setUp();
+    void tearDown();
+
+    void testPathRejection();
+    void testReadWrite();
+    void testMemoryOperations();
+    void testBusyCycles();
+
+private:
+    int trigger(
+        const std::string& operation, UIntWord input1 = 0,
+        UIntWord input2 = 0, UIntWord input3 = 0);
+    int open(const std::string& path, int flags);
+    void writeString(Word address, const std::string& text);
+
+    /// The temporary directory of the test.
+    std::string directory_;
+    /// The directory the simulated program can access.
+    std::string sandbox_;
+    /// The simulated memory.
+    IdealSRAM* memory_;
+    /// The program counter of the context.
+    InstructionAddress programCounter_;
+    /// The return address of the context.
+    SimValue returnAddress_;
+    /// The cycle counter of the context.
+    CycleCount cycle_;
+    /// The context the operations are executed in.
+    OperationContext* context_;
+    /// The operations.
+    OperationPool pool_;
+};
+
+
+/**
+ * Creates the sandbox directory and a context with an 8-bit memory.
+ *
+ * A host call costs 10 cycles plus half a cycle per MAU.
+ */
+void
+HostIOTest::setUp() {
+    directory_ = FileSystem::createTempDirectory();
+    sandbox_ = directory_ + "/sandbox";
+    FileSystem::createDirectory(sandbox_ + "/sub");
+    setenv("TTASIM_HOSTIO_DIR", sandbox_.c_str(), 1);
+    setenv("TTASIM_HOSTIO_CALL_CYCLES", "10", 1);
+    setenv("TTASIM_HOSTIO_MAU_CYCLES", "0.5", 1);
+
+    memory_ = new IdealSRAM(0, 1023, 8, false);
+    programCounter_ = 0;
+    cycle_ = 0;
+    context_ = new OperationContext(memory_, programCounter_, returnAddress_);
+    context_->setCycleCountVariable(cycle_);
+}
+
+
+/**
+ * Removes the context and the temporary files.
+ */
+void
+HostIOTest::tearDown() {
+    // closes the files left open
+    pool_.operation("HOST_OPEN").deleteState(*context_);
+    delete context_;
+    delete memory_;
+    unsetenv("TTASIM_HOSTIO_DIR");
+    unsetenv("TTASIM_HOSTIO_CALL_CYCLES");
+    unsetenv("TTASIM_HOSTIO_MAU_CYCLES");
+    FileSystem::removeFileOrDirectory(directory_);
+}
+
+
+/**
+ * Tests that no file outside the sandbox directory can be opened.
+ */
+void
+HostIOTest::testPathRejection() {
+    std::ofstream(std::string(directory_ + "/outside.txt").c_str())
+        << "secret";
+    TS_ASSERT_EQUALS(
+        symlink("../outside.txt", (sandbox_ + "/link.txt").c_str()), 0);
+    TS_ASSERT_EQUALS(symlink("..", (sandbox_ + "/up").c_str()), 0);
+    TS_ASSERT_EQUALS(
+        symlink(directory_.c_str(), (sandbox_ + "/sub/root").c_str()), 0);
+
+    TS_ASSERT_EQUALS(open("../outside.txt", HOST_IO_READ), -1);
+    TS_ASSERT_EQUALS(open("sub/../../outside.txt", HOST_IO_READ), -1);
+    TS_ASSERT_EQUALS(
+        open(directory_ + "/outside.txt", HOST_IO_READ), -1);
+    TS_ASSERT_EQUALS(open("link.txt", HOST_IO_READ), -1);
+    TS_ASSERT_EQUALS(open("up/outside.txt", HOST_IO_READ), -1);
+    TS_ASSERT_EQUALS(open("sub/root/outside.txt", HOST_IO_READ), -1);
+    TS_ASSERT_EQUALS(
+        open("link.txt", HOST_IO_WRITE | HOST_IO_TRUNCATE), -1);
+    TS_ASSERT_EQUALS(open("", HOST_IO_READ), -1);
+
+    // the file outside was not touched
+    std::ifstream outside(std::string(directory_ + "/outside.txt").c_str());
+    std::string content;
+    outside >> content;
+    TS_ASSERT_EQUALS(content, "secret");
+
+    // files in the sandbox can be opened
+    const int file = open(
+        "./sub/inside.txt", HOST_IO_WRITE | HOST_IO_CREATE);
+    TS_ASSERT(file >= 3);
+    TS_ASSERT(FileSystem::fileExists(sandbox_ + "/sub/inside.txt"));
+    TS_ASSERT_EQUALS(trigger("HOST_CLOSE", file), 0);
+}
+
+
+/**
+ * Tests writing a block to a file and reading it back.
+ */
+void
+HostIOTest::testReadWrite() {
+    for (int i = 0; i < 100; i++) {
+        memory_->write(i, Memory::MAU(i * 7 & 0xff));
+    }
+    const int output = open(
+        "data.bin", HOST_IO_WRITE | HOST_IO_CREATE | HOST_IO_TRUNCATE);
+    TS_ASSERT(output >= 3);
+    TS_ASSERT_EQUALS(trigger("HOST_WRITE", output, 0, 100), 100);
+    TS_ASSERT_EQUALS(trigger("HOST_CLOSE", output), 0);
+    TS_ASSERT_EQUALS(trigger("HOST_CLOSE", output), -1);
+    TS_ASSERT_EQUALS(FileSystem::sizeInBytes(sandbox_ + "/data.bin"), 100u);
+
+    const int input = open("data.bin", HOST_IO_READ);
+    TS_ASSERT(input >= 3);
+    TS_ASSERT_EQUALS(trigger("HOST_READ", input, 200, 150), 100);
+    for (int i = 0; i < 100; i++) {
+        TS_ASSERT_EQUALS(memory_->read(200 + i), Memory::MAU(i * 7 & 0xff));
+    }
+    // end of file
+    TS_ASSERT_EQUALS(trigger("HOST_READ", input, 200, 10), 0);
+
+    TS_ASSERT_EQUALS(trigger("HOST_LSEEK", input, 10, 0), 10);
+    TS_ASSERT_EQUALS(trigger("HOST_READ", input, 500, 5), 5);
+    for (int i = 0; i < 5; i++) {
+        TS_ASSERT_EQUALS(
+            memory_->read(500 + i), Memory::MAU((10 + i) * 7 & 0xff));
+    }
+    TS_ASSERT_EQUALS(trigger("HOST_CLOSE", input), 0);
+
+    // unknown file descriptors
+    TS_ASSERT_EQUALS(trigger("HOST_READ", 99, 0, 10), -1);
+    TS_ASSERT_EQUALS(trigger("HOST_WRITE", 99, 0, 10), -1);
+
+    // buffers out of the memory
+    const int again = open("data.bin", HOST_IO_READ);
+    TS_ASSERT_THROWS(
+        trigger("HOST_READ", again, 1000, 100), SimulationExecutionError);
+}
+
+
+/**
+ * Tests the block copy and fill operations.
+ */
+void
+HostIOTest::testMemoryOperations() {
+    // the value is truncated to the MAU
+    trigger("HOST_MEMSET", 0, 0x1ab, 64);
+    for (int i = 0; i < 64; i++) {
+        TS_ASSERT_EQUALS(memory_->read(i), 0xabu);
+    }
+    TS_ASSERT_EQUALS(memory_->read(64), 0u);
+
+    for (int i = 0; i < 64; i++) {
+        memory_->write(i, Memory::MAU(i));
+    }
+    trigger("HOST_MEMCPY", 100, 0, 64);
+    for (int i = 0; i < 64; i++) {
+        TS_ASSERT_EQUALS(memory_->read(100 + i), Memory::MAU(i));
+    }
+    TS_ASSERT_EQUALS(memory_->read(164), 0u);
+
+    // a zero length does nothing
+    trigger("HOST_MEMSET", 0, 0xff, 0);
+    TS_ASSERT_EQUALS(memory_->read(0), 0u);
+
+    TS_ASSERT_THROWS(
+        trigger("HOST_MEMCPY", 1000, 0, 64), SimulationExecutionError);
+    TS_ASSERT_THROWS(
+        trigger("HOST_MEMSET", 1000, 0, 64), SimulationExecutionError);
+}
+
+
+/**
+ * Tests that HOST_BUSY models the cycle cost of the latest host call.
+ */
+void
+HostIOTest::testBusyCycles() {
+    TS_ASSERT_EQUALS(trigger("HOST_BUSY"), 0);
+
+    // 10 + 40 * 0.5 cycles
+    cycle_ = 100;
+    trigger("HOST_MEMSET", 0, 0, 40);
+    TS_ASSERT_EQUALS(trigger("HOST_BUSY"), 1);
+    cycle_ = 129;
+    TS_ASSERT_EQUALS(trigger("HOST_BUSY"), 1);
+    cycle_ = 130;
+    TS_ASSERT_EQUALS(trigger("HOST_BUSY"), 0);
+
+    // the cost of a read depends on the MAUs actually read
+    std::ofstream(std::string(sandbox_ + "/four.bin").c_str()) << "1234";
+    const int file = open("four.bin", HOST_IO_READ);
+    cycle_ = 200;
+    TS_ASSERT_EQUALS(trigger("HOST_READ", file, 0, 100), 4);
+    cycle_ = 211;
+    TS_ASSERT_EQUALS(trigger("HOST_BUSY"), 1);
+    cycle_ = 212;
+    TS_ASSERT_EQUALS(trigger("HOST_BUSY"), 0);
+}
+
+
+/**
+ * Triggers the given host call operation.
+ *
+ * @return The output of the operation, 0 if it has no output.
+ */
+int
+HostIOTest::trigger(
+    const std::string& operation, UIntWord input1, UIntWord input2,
+    UIntWord input3) {
+
+    Operation& op = pool_.operation(operation.c_str());
+    TS_ASSERT_EQUALS(op.name(), operation);
+    op.createState(*context_);
+    const UIntWord inputs[] = {input1, input2, input3};
+    SimValue values[4] = {
+        SimValue(32), SimValue(32), SimValue(32), SimValue(32)};
+    SimValue* io[4];
+    for (int i = 0; i < op.numberOfInputs() + op.numberOfOutputs(); i++) {
+        if (i < op.numberOfInputs()) {
+            values[i] = inputs[i];
+        }
+        io[i] = &values[i];
+    }
+    op.simulateTrigger(io, *context_);
+    return op.numberOfOutputs() > 0 ?
+        values[op.numberOfInputs()].intValue() : 0;
+}
+
+
+/**
+ * Opens a file with HOST_OPEN.
+ *
+ * @return The file descriptor, or -1 on an error.
+ */
+int
+HostIOTest::open(const std::string& path, int flags) {
+    writeString(800, path);
+    return trigger("HOST_OPEN", 800, flags);
+}
+
+
+/**
+ * Writes a null terminated string to the memory.
+ */
+void
+HostIOTest::writeString(Word address, const std::string& text) {
+    for (std::size_t i = 0; i < text.size(); i++) {
+        memory_->write(
+            address + i, Memory::MAU(static_cast<unsigned char>(text[i])));
+    }
+    memory_->write(address + text.size(), Memory::MAU(0));
+}
+
+#endif
@@ -51,6 +51,7 @@ public:
     void testNonExistingState();
 
     void testAdvanceClock();
+    void testClockedStates();
 
 private:
     OperationContext context;
@@ -66,6 +67,12 @@ private:
         string name_;
         bool advanced_;
     };
+
+    class MyUnclockedState : public MyDummyState {
+    public:
+        MyUnclockedState(string n) : MyDummyState(n) {};
+        bool isClocked() const { return false; };
+    };
 };
 
 
@@ -142,5 +149,31 @@ OpContextTest::testAdvanceClock() {
     TS_ASSERT_EQUALS(s4.advanced(), true);
 }
 
+/**
+ * Tests that advanceClock() skips the states that are not clocked.
+ */
+void
+OpContextTest::testClockedStates() {
+    OperationContext con;
+    MyUnclockedState unclocked("unclocked");
+    MyDummyState clocked("clocked");
+
+    con.registerState(&unclocked);
+    TS_ASSERT_EQUALS(con.isEmpty(), false);
+    TS_ASSERT_EQUALS(con.hasClockedStates(), false);
+
+    con.registerState(&clocked);
+    TS_ASSERT_EQUALS(con.hasClockedStates(), true);
+
+    con.advanceClock();
+    TS_ASSERT_EQUALS(unclocked.advanced(), false);
+    TS_ASSERT_EQUALS(clocked.advanced(), true);
+
+    con.unregisterState("clocked");
+    TS_ASSERT_EQUALS(con.hasClockedStates(), false);
+    con.unregisterState("unclocked");
+    TS_ASSERT_EQUALS(con.isEmpty(), true);
+}
+
 
 #endif
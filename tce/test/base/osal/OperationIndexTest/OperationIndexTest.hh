@@ -36,8 +36,12 @@
 
 #include <TestSuite.h>
 #include <string>
+#include <fstream>
+#include <cstdlib>
+#include <utime.h>
 
 #include "OperationIndex.hh"
+#include "OperationIndexCache.hh"
 #include "FileSystem.hh"
 #include "OperationModule.hh"
 
@@ -51,6 +55,7 @@ public:
     void testPathsAndModules();
     void testOperations();
     void testAddAndRemoveModule();
+    void testCachedOperations();
 
 private:
     /// Path where modules are searched.
@@ -193,4 +198,75 @@ OperationIndexTest::testAddAndRemoveModule() {
     TS_ASSERT_EQUALS(index.moduleCount(SEARCH_PATH), 0);
 }
 
+/**
+ * Test that the second index of a search path reads the operation
+ * definitions from the cache written by the first one.
+ */
+void
+OperationIndexTest::testCachedOperations() {
+
+    const string DS = FileSystem::DIRECTORY_SEPARATOR;
+    const string tempDir = FileSystem::createTempDirectory();
+    TS_ASSERT(tempDir != "");
+    const string cacheDir = tempDir + DS + "cache";
+    const string searchPath = tempDir + DS + "opset";
+    const string propertyFile = searchPath + DS + "correct.opp";
+    TS_ASSERT(FileSystem::createDirectory(searchPath));
+    FileSystem::copy(SEARCH_PATH + DS + "correct.opp", propertyFile);
+
+    // the cache is not written for property files modified within the
+    // last second
+    struct utimbuf times;
+    times.actime = times.modtime =
+        FileSystem::lastModificationTime(propertyFile) - 10;
+    TS_ASSERT_EQUALS(utime(propertyFile.c_str(), &times), 0);
+
+    const char* oldCacheDir = getenv("TCE_OSAL_CACHE_DIR");
+    const string savedCacheDir = oldCacheDir != NULL ? oldCacheDir : "";
+    setenv("TCE_OSAL_CACHE_DIR", cacheDir.c_str(), 1);
+
+    string name = "";
+    {
+        OperationIndex index;
+        TS_ASSERT_THROWS_NOTHING(index.addPath(searchPath));
+        OperationModule& module = index.moduleOf("oper1");
+        TS_ASSERT_EQUALS(module.name(), "correct");
+        TS_ASSERT_THROWS_NOTHING(name = index.operationName(0, module));
+    }
+
+    std::vector<string> files;
+    files.push_back(propertyFile);
+    OperationIndexCache cache(searchPath, files);
+    TS_ASSERT(FileSystem::fileExists(cache.fileName()));
+    TS_ASSERT_EQUALS(
+        FileSystem::directoryOfPath(cache.fileName()), cacheDir);
+
+    // replace the property file with garbage of the same size and time,
+    // so the operations can be found only from the cache
+    const uintmax_t size = FileSystem::sizeInBytes(propertyFile);
+    std::ofstream garbage(propertyFile.c_str(), std::ios::trunc);
+    garbage << string(size, '#');
+    garbage.close();
+    TS_ASSERT_EQUALS(utime(propertyFile.c_str(), &times), 0);
+
+    {
+        OperationIndex index;
+        TS_ASSERT_THROWS_NOTHING(index.addPath(searchPath));
+        OperationModule& module = index.moduleOf("OPER1");
+        TS_ASSERT_EQUALS(module.name(), "correct");
+        TS_ASSERT_EQUALS(index.operationCount(module), 1);
+        TS_ASSERT_EQUALS(index.operationName(0, module), name);
+        TS_ASSERT_EQUALS(
+            &index.moduleOf("foobariehbfa"),
+            &NullOperationModule::instance());
+    }
+
+    if (oldCacheDir != NULL) {
+        setenv("TCE_OSAL_CACHE_DIR", savedCacheDir.c_str(), 1);
+    } else {
+        unsetenv("TCE_OSAL_CACHE_DIR");
+    }
+    FileSystem::removeFileOrDirectory(tempDir);
+}
+
 #endif
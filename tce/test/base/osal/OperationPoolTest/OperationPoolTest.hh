@@ -55,6 +55,7 @@ public:
 
     void testOperation();
     void testDAGOperation();
+    void testOperationID();
 
 private:
 };
@@ -152,4 +153,35 @@ OperationPoolTest::testDAGOperation() {
     OperationPool::cleanupCache();
 }
 
+/**
+ * Test that the operations get dense case-insensitive IDs.
+ */
+void
+OperationPoolTest::testOperationID() {
+
+    OperationPool pool;
+
+    unsigned int callID = OperationPool::operationID("call");
+    TS_ASSERT_EQUALS(OperationPool::operationID("CALL"), callID);
+    TS_ASSERT(callID < OperationPool::operationIDCount());
+
+    unsigned int count = OperationPool::operationIDCount();
+    unsigned int newID = OperationPool::operationID("foobarIDtest");
+    TS_ASSERT_EQUALS(newID, count);
+    TS_ASSERT_EQUALS(OperationPool::operationIDCount(), count + 1);
+    TS_ASSERT_DIFFERS(newID, callID);
+
+    Operation& call = pool.operation("Call");
+    TS_ASSERT_EQUALS(call.id(), callID);
+    TS_ASSERT_EQUALS(&pool.operation("call"), &call);
+    TS_ASSERT_DIFFERS(pool.operation("jump").id(), callID);
+
+    // the IDs are kept over cleaning up the cache
+    OperationPool::cleanupCache();
+    TS_ASSERT_EQUALS(OperationPool::operationID("call"), callID);
+    OperationPool pool2;
+    TS_ASSERT_EQUALS(pool2.operation("call").id(), callID);
+    OperationPool::cleanupCache();
+}
+
 #endif
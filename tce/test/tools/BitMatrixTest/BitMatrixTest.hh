@@ -42,6 +42,7 @@
 class BitMatrixTest : public CxxTest::TestSuite {
 public:
     void testBasic();
+    void testRowConflicts();
 };
 
 /**
@@ -119,4 +120,29 @@ BitMatrixTest::testBasic() {
 
 }
 
+/**
+ * Tests the row-wise conflict checks.
+ */
+void
+BitMatrixTest::testRowConflicts() {
+
+    BitMatrix first(40, 3, false);
+    BitMatrix second(40, 2, false);
+    BitMatrix third(40, 2, true);
+
+    first.setBit(35, 1, true);
+    second.setBit(35, 0, true);
+    second.setBit(2, 1, true);
+
+    TS_ASSERT(first.rowConflictsWith(1, second, 0));
+    TS_ASSERT(!first.rowConflictsWith(1, second, 1));
+    TS_ASSERT(!first.rowConflictsWith(0, second, 0));
+    TS_ASSERT(!first.rowConflictsWith(2, second, 0));
+
+    TS_ASSERT(first.rowConflictsWith(1, second, 0, third, 1));
+    third.setBit(35, 1, false);
+    TS_ASSERT(!first.rowConflictsWith(1, second, 0, third, 1));
+    TS_ASSERT(first.rowConflictsWith(1, second, 0, third, 0));
+}
+
 #endif
@@ -38,6 +38,7 @@
 #include <unistd.h>
 
 #include "FileSystem.hh"
+#include "FileLock.hh"
 #include "ContainerTools.hh"
 #include "tce_config.h"
 
@@ -61,6 +62,9 @@ public:
     void testFileExtensionAndBody();
     void testCreationAndRemoval();
     void testCopy();
+    void testCopyIfChanged();
+    void testRenameFile();
+    void testFileLock();
     void testToAbsolutePath();
     void testFindFileInSearchPaths();
     void testDirectoryContents();
@@ -261,6 +265,72 @@ FileSystemTest::testCopy() {
     FileSystem::removeFileOrDirectory(target);
 }
 
+/**
+ * Tests that files are copied and written only when their contents change.
+ */
+void
+FileSystemTest::testCopyIfChanged() {
+    string DS = FileSystem::DIRECTORY_SEPARATOR;
+    string source = FileSystem::currentWorkingDir() + DS + writableFile_;
+    string target = FileSystem::currentWorkingDir() + DS + "data" +
+        DS + "foo";
+
+    TS_ASSERT_EQUALS(FileSystem::copyIfChanged(source, target), true);
+    TS_ASSERT_EQUALS(FileSystem::copyIfChanged(source, target), false);
+
+    TS_ASSERT_EQUALS(FileSystem::writeIfChanged(target, "foo\n"), true);
+    TS_ASSERT_EQUALS(FileSystem::writeIfChanged(target, "foo\n"), false);
+    TS_ASSERT_EQUALS(FileSystem::sizeInBytes(target), 4u);
+    TS_ASSERT_EQUALS(FileSystem::copyIfChanged(source, target), true);
+
+    FileSystem::removeFileOrDirectory(target);
+}
+
+/**
+ * Tests renaming a file.
+ */
+void
+FileSystemTest::testRenameFile() {
+    string DS = FileSystem::DIRECTORY_SEPARATOR;
+    string source = FileSystem::currentWorkingDir() + DS + "data" +
+        DS + "foo";
+    string target = FileSystem::currentWorkingDir() + DS + "data" +
+        DS + "bar";
+
+    FileSystem::copy(FileSystem::currentWorkingDir() + DS + writableFile_,
+        source);
+    TS_ASSERT_EQUALS(FileSystem::renameFile(source, target), true);
+    TS_ASSERT_EQUALS(FileSystem::fileExists(source), false);
+    TS_ASSERT_EQUALS(FileSystem::fileExists(target), true);
+    TS_ASSERT_EQUALS(FileSystem::renameFile(source, target), false);
+
+    FileSystem::removeFileOrDirectory(target);
+}
+
+/**
+ * Tests acquiring and releasing a file lock.
+ */
+void
+FileSystemTest::testFileLock() {
+    string DS = FileSystem::DIRECTORY_SEPARATOR;
+    string lockFile = FileSystem::currentWorkingDir() + DS + "data" +
+        DS + "foo.lock";
+
+    {
+        FileLock lock(lockFile);
+        TS_ASSERT_EQUALS(FileSystem::fileExists(lockFile), true);
+    }
+    // the lock file is removed when the lock is released
+    TS_ASSERT_EQUALS(FileSystem::fileExists(lockFile), false);
+    // the lock is released so it can be acquired again
+    {
+        FileLock lock(lockFile);
+    }
+    TS_ASSERT_EQUALS(FileSystem::fileExists(lockFile), false);
+
+    TS_ASSERT_THROWS(FileLock lock(nonExistingFile_), IOException);
+}
+
 
 /**
  * Tests converting relative path to absolute path.
@@ -51,6 +51,7 @@ public:
     void testEqualities();
 
     void testMisc();
+    void testElements();
     
     
 private:
@@ -412,4 +413,41 @@ SimValueTest::testMisc() {
     TS_ASSERT_EQUALS(simValue.hexValue(), "0x0000");
 }
 
+/**
+ * Tests the lane accessors.
+ */
+void
+SimValueTest::testElements() {
+    SimValue simValue(128);
+    TS_ASSERT_EQUALS(simValue.elementCount(32), 4);
+    TS_ASSERT_EQUALS(simValue.elementCount(8), 16);
+    TS_ASSERT_EQUALS(simValue.elementCount(48), 2);
+
+    // lane 0 is at the least significant end
+    simValue.setValue("0x0000000400000003000000020000abcd");
+    TS_ASSERT_EQUALS(simValue.element<UIntWord>(0), 0xabcdu);
+    TS_ASSERT_EQUALS(simValue.element<UIntWord>(3), 4u);
+    TS_ASSERT_EQUALS(simValue.element<uint16_t>(1), 0);
+    TS_ASSERT_EQUALS(simValue.element<Byte>(1), 0xab);
+
+    simValue.setElement<UIntWord>(1, 0x12345678);
+    TS_ASSERT_EQUALS(simValue.width(), 128);
+    TS_ASSERT_EQUALS(
+        simValue.hexValue(), "0x0000000400000003123456780000abcd");
+
+    FloatWord lanes[4] = {1.5f, -2.0f, 0.25f, 8.0f};
+    simValue.setElements(lanes, 0, 4);
+    TS_ASSERT_EQUALS(simValue.element<FloatWord>(2), 0.25f);
+    FloatWord copy[2] = {0.0f, 0.0f};
+    simValue.elements(copy, 2, 2);
+    TS_ASSERT_EQUALS(copy[0], 0.25f);
+    TS_ASSERT_EQUALS(copy[1], 8.0f);
+
+    // a scalar value is a vector of one lane
+    SimValue scalar(32);
+    scalar = UIntWord(0xcafe);
+    TS_ASSERT_EQUALS(scalar.elementCount(32), 1);
+    TS_ASSERT_EQUALS(scalar.element<UIntWord>(0), 0xcafeu);
+}
+
 #endif
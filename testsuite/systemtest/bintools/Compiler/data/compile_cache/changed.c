@@ -0,0 +1,7 @@
+#include <lwpr.h>
+
+int main() {
+    lwpr_print_int(2);
+    lwpr_newline();
+    return 0;
+}
@@ -0,0 +1,8 @@
+#include <lwpr.h>
+
+const char* provider();
+
+int main() {
+    lwpr_print_str((char*)provider());
+    return 0;
+}
@@ -0,0 +1,3 @@
+const char* provider() {
+    return "second\n";
+}
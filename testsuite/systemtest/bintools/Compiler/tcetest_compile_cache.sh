@@ -0,0 +1,29 @@
+#!/bin/sh
+### TCE TESTCASE
+### title: The compile cache reuses outputs until an input changes
+### xstdout: 1\nprogram 0 1\nmachine 0 1\n1\nprogram 1 1\nmachine 1 1\n2\nprogram 1 2\nmachine 1 2\n
+
+mach=data/minimal_with_stdout.adf
+srcdir=data/compile_cache
+workdir=$(mktemp -d tmpXXXXXX)
+program=$(mktemp tmpXXXXXX)
+cache=$workdir/cache
+
+# Prints the hits and misses of the program and machine stages.
+compile_and_run() {
+    tcecc $workdir/main.c -llwpr -O0 -a $mach -o $program \
+        --compile-cache --compile-cache-dir=$cache && \
+    ttasim -a $mach -p $program --no-debugmode
+    tcecc --compile-cache-stats --compile-cache-dir=$cache | \
+        awk '$1 != "source" { print $1, $2, $4 }'
+}
+
+cp $srcdir/main.c $workdir/main.c
+compile_and_run
+# The same input and tools are found in the cache.
+compile_and_run
+# A changed input misses the cache.
+cp $srcdir/changed.c $workdir/main.c
+compile_and_run
+
+rm -rf $program $workdir
@@ -0,0 +1,24 @@
+#!/bin/sh
+### TCE TESTCASE
+### title: A symbol defined in several libraries is linked from the first one
+### xstdout: first\nsecond\n
+
+mach=data/minimal_with_stdout.adf
+srcdir=data/lib_symbol_order
+libdir=$(mktemp -d tmpXXXXXX)
+program=$(mktemp tmpXXXXXX)
+
+tcecc -O0 -c $srcdir/first.c -o $libdir/first.o && \
+tcecc -O0 -c $srcdir/second.c -o $libdir/second.o && \
+ar rc $libdir/libfirst.a $libdir/first.o && \
+ar rc $libdir/libsecond.a $libdir/second.o || exit 1
+
+tcecc $srcdir/main.c -llwpr -O0 -a $mach -o $program -L$libdir \
+    --lib-cache-dir=$libdir/cache -lfirst -lsecond && \
+ttasim -a $mach -p $program --no-debugmode
+
+tcecc $srcdir/main.c -llwpr -O0 -a $mach -o $program -L$libdir \
+    --lib-cache-dir=$libdir/cache -lsecond -lfirst && \
+ttasim -a $mach -p $program --no-debugmode
+
+rm -rf $program $libdir
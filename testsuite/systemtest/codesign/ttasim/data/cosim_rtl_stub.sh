@@ -0,0 +1,19 @@
+#!/bin/sh
+# Stands in for the RTL simulation in tcetest_cosim.sh. Writes the given
+# ttasim bus trace as the RTL bus trace.
+#
+# usage: cosim_rtl_stub.sh match|mutate CYCLE|fail TRACE RTL_TRACE
+
+case $1 in
+    match)
+        cp $2 $3
+        ;;
+    mutate)
+        awk -F, -v cycle=$2 'BEGIN { OFS = "," }
+            $1 == cycle { $2 = "deadbeef" } { print }' $3 > $4
+        ;;
+    fail)
+        head -n 3 $2 > $3
+        exit 1
+        ;;
+esac
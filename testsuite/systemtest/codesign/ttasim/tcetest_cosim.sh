@@ -0,0 +1,34 @@
+#!/bin/bash
+### TCE TESTCASE
+### title: Co-simulation of ttasim and a stub RTL simulation with ttacosim
+### xstdout: exit 0\nBus traces of all cycles match.\nexit 1\nBus traces diverge at cycle 5:\nexit 1\nRTL simulation failed at cycle 3.\n
+
+ADF=./data/guard_latencies.adf
+SRC=./data/guard_latencies.tceasm
+STUB=./data/cosim_rtl_stub.sh
+TPEF=$(mktemp tmpXXXXXX.tpef)
+RTL_TRACE=$(mktemp tmpXXXXXX)
+LOG=$(mktemp tmpXXXXXX)
+
+function on_exit {
+    rm -f $TPEF $TPEF.bustrace $RTL_TRACE $LOG
+}
+trap on_exit EXIT
+
+# Runs ttacosim with the given RTL simulation command and a window of 4
+# cycles, so the comparison spans several windows.
+function cosim {
+    ttacosim $ADF $TPEF $RTL_TRACE "$1" 4 > $LOG 2>&1
+    echo "exit $?"
+    head -n 1 $LOG | sed "s/ $CYCLES cycles/ all cycles/"
+}
+
+tceasm -o $TPEF $ADF $SRC || exit 1
+ttasim --no-debugmode \
+    -e "setting bus_trace 1; mach $ADF; prog $TPEF; run; quit;" \
+    > /dev/null || exit 1
+CYCLES=$(( $(wc -l < $TPEF.bustrace) ))
+
+cosim "$STUB match $TPEF.bustrace $RTL_TRACE"
+cosim "$STUB mutate 5 $TPEF.bustrace $RTL_TRACE"
+cosim "$STUB fail $TPEF.bustrace $RTL_TRACE"